@@ -0,0 +1,102 @@
+#include "async.h"
+#include "speed.h"
+#include "retry.h"
+#include "trace.h"
+#include "stats.h"
+
+/* ============================================
+ * Conclusão da requisição
+ * ============================================ */
+static void async_finish(sfp_async_read_t *req, int result)
+{
+    req->result = result;
+    req->end_us = sfp_transport_now_us(req->t);
+
+    /* Contadores do dispositivo; timeout/erro dispara a recuperação do barramento.
+       No caminho bloqueante sfp_read_block() já contabilizou. */
+    if (req->t->ops->read_start && req->t->ops->read_poll) {
+        int rec = result;
+        if (rec >= 0 && rec != req->length)
+            rec = SFP_XFER_ERR_IO;
+        sfp_retry_record(req->t, req->dev_addr, rec, false);
+        sfp_trace_record(req->t->trace, SFP_TRACE_READ, req->dev_addr, req->offset,
+                         req->buffer, req->length, rec, req->start_us, req->end_us);
+        sfp_stats_record(req->t->stats, req->dev_addr,
+                         (uint32_t)(req->end_us - req->start_us), rec >= 0);
+    }
+
+    req->state  = (result == req->length) ? SFP_ASYNC_DONE : SFP_ASYNC_ERROR;
+
+    if (req->cb)
+        req->cb(req, req->state == SFP_ASYNC_DONE, req->user);
+}
+
+/* ============================================
+ * Início da leitura
+ * ============================================ */
+bool sfp_read_block_async_start(sfp_async_read_t *req, const sfp_transport_t *t,
+                                uint8_t dev_addr, uint8_t start_offset,
+                                uint8_t *buffer, uint8_t length,
+                                sfp_async_cb_t cb, void *user)
+{
+    if (!req || !t || !t->ops || !buffer || length == 0)
+        return false;
+
+    if (req->state == SFP_ASYNC_BUSY)
+        return false;
+
+    req->t        = t;
+    req->dev_addr = dev_addr;
+    req->offset   = start_offset;
+    req->length   = length;
+    req->buffer   = buffer;
+    req->cb       = cb;
+    req->user     = user;
+    req->result   = 0;
+    req->start_us = sfp_transport_now_us(t);
+    req->end_us   = 0;
+
+    if (t->ops->read_start && t->ops->read_poll) {
+        if (!sfp_speed_apply(t, dev_addr))
+            return false;
+        if (!t->ops->read_start(t->ctx, dev_addr, start_offset, buffer, length))
+            return false;
+        req->state = SFP_ASYNC_BUSY;
+        return true;
+    }
+
+    /* Backend sem suporte assíncrono: leitura bloqueante, entregue no próximo poll */
+    req->result = sfp_read_block(t, dev_addr, start_offset, buffer, length) ? length : SFP_XFER_ERR_IO;
+    req->state  = SFP_ASYNC_BUSY;
+    return true;
+}
+
+/* ============================================
+ * Avanço da máquina de estados
+ * ============================================ */
+sfp_async_state_t sfp_read_block_async_poll(sfp_async_read_t *req)
+{
+    if (!req)
+        return SFP_ASYNC_ERROR;
+
+    if (req->state != SFP_ASYNC_BUSY)
+        return req->state;
+
+    const sfp_transport_ops_t *ops = req->t->ops;
+
+    if (ops->read_start && ops->read_poll) {
+        int ret = ops->read_poll(req->t->ctx);
+        if (ret == SFP_XFER_BUSY)
+            return SFP_ASYNC_BUSY;
+        async_finish(req, ret);
+    } else {
+        async_finish(req, req->result);
+    }
+
+    return req->state;
+}
+
+bool sfp_read_block_async_busy(const sfp_async_read_t *req)
+{
+    return req && req->state == SFP_ASYNC_BUSY;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file async.h
+ * @brief Leitura não bloqueante de blocos da EEPROM SFP
+ *
+ * @details
+ *  Máquina de estados independente de hardware sobre as operações
+ *  read_start/read_poll do transporte. No RP2040 a transferência é
+ *  conduzida pela ISR do I2C (I2C/i2c_fsm.h); no host é emulada pelo backend de
+ *  arquivos. O laço principal chama sfp_read_block_async_poll() a cada
+ *  iteração e continua tratando joystick/display enquanto o bloco chega.
+ *
+ *  Fluxo:
+ *   IDLE --start--> BUSY --poll--> DONE  (callback com sucesso)
+ *                              \-> ERROR (callback com falha)
+ *
+ *  Se o backend não implementa leitura assíncrona, o start cai para o
+ *  sfp_read_block() bloqueante e o resultado é entregue no primeiro poll.
+ */
+
+#ifndef ASYNC_H
+#define ASYNC_H
+
+#include "transport.h"
+
+typedef enum {
+    SFP_ASYNC_IDLE = 0,
+    SFP_ASYNC_BUSY,
+    SFP_ASYNC_DONE,
+    SFP_ASYNC_ERROR
+} sfp_async_state_t;
+
+struct sfp_async_read;
+
+/* Callback de conclusão (chamado a partir do poll, no contexto do laço principal) */
+typedef void (*sfp_async_cb_t)(struct sfp_async_read *req, bool ok, void *user);
+
+typedef struct sfp_async_read {
+    const sfp_transport_t *t;
+    uint8_t  dev_addr;
+    uint8_t  offset;
+    uint8_t  length;
+    uint8_t *buffer;
+
+    sfp_async_state_t state;
+    int      result;       /* bytes lidos ou código SFP_XFER_ERR_* */
+    uint64_t start_us;
+    uint64_t end_us;
+
+    sfp_async_cb_t cb;
+    void    *user;
+} sfp_async_read_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+bool sfp_read_block_async_start(sfp_async_read_t *req, const sfp_transport_t *t,
+                                uint8_t dev_addr, uint8_t start_offset,
+                                uint8_t *buffer, uint8_t length,
+                                sfp_async_cb_t cb, void *user);
+
+sfp_async_state_t sfp_read_block_async_poll(sfp_async_read_t *req);
+
+bool sfp_read_block_async_busy(const sfp_async_read_t *req);
+
+#endif /* ASYNC_H */
@@ -0,0 +1,156 @@
+#include "cage.h"
+#include <string.h>
+
+/* ============================================
+ * Inicialização
+ * ============================================ */
+bool sfp_cages_init(sfp_cage_table_t *tbl, sfp_mux_t *mux, uint8_t count, uint32_t period_us)
+{
+    if (!tbl || !mux || count == 0 || count > SFP_MUX_CHANNELS)
+        return false;
+
+    memset(tbl, 0, sizeof(*tbl));
+    tbl->mux       = mux;
+    tbl->count     = count;
+    tbl->period_us = period_us;
+
+    for (uint8_t i = 0; i < count; i++)
+        tbl->cage[i].channel = i;
+
+    if (!sfp_a2_dynamic_window(&tbl->dyn_offset, &tbl->dyn_length))
+        return false;
+
+    return true;
+}
+
+/* ============================================
+ * Inserção: dados estáticos (A0h + A2h completo)
+ * ============================================ */
+static void cage_load(sfp_cage_table_t *tbl, sfp_cage_t *c)
+{
+    if (!sfp_mux_probe(tbl->mux, c->channel, SFP_I2C_ADDR_A0)) {
+        c->state = SFP_CAGE_EMPTY;
+        return;
+    }
+
+    if (!sfp_mux_read_block(tbl->mux, c->channel, SFP_I2C_ADDR_A0, 0, c->a0_raw, sizeof(c->a0_raw))) {
+        c->state = SFP_CAGE_FAULT;
+        c->errors++;
+        return;
+    }
+
+    sfp_a0_view_t v = sfp_cage_a0(c);
+    uint32_t fp = sfp_a0_fingerprint(c->a0_raw);
+
+    c->a0_idx.fingerprint = fp;
+    c->a0_idx.identifier  = (uint8_t)sfp_a0v_identifier(v);
+    c->a0_idx.variant     = (uint8_t)sfp_a0v_variant(v);
+    c->a0_idx.cc_base_ok  = sfp_a0v_cc_base_is_valid(v);
+    c->a0_idx.cc_ext_ok   = sfp_a0v_cc_ext_is_valid(v);
+
+    const sfp_module_cache_entry_t *known = sfp_module_cache_lookup(tbl->cache, fp);
+
+    /* Módulo conhecido: só a parte dinâmica do A2h vem do barramento */
+    uint8_t a2_from = 0;
+
+    if (known) {
+        c->a2      = known->a2;
+        c->has_dmi = known->has_dmi;
+        memcpy(c->a2_raw, known->a2_static, SFP_CACHE_A2_STATIC_LEN);
+        a2_from = SFP_CACHE_A2_STATIC_LEN;
+    } else {
+        memset(&c->a2, 0, sizeof(c->a2));
+        c->has_dmi = sfp_a0v_dmi_implemented(v);
+    }
+
+    if (c->has_dmi &&
+        !sfp_mux_read_block(tbl->mux, c->channel, SFP_I2C_ADDR_A2, a2_from,
+                            c->a2_raw + a2_from, (uint8_t)(SFP_A2_SIZE - a2_from))) {
+        c->state = SFP_CAGE_FAULT;
+        c->errors++;
+        return;
+    }
+
+    if (!known && tbl->cache) {
+        if (c->has_dmi)
+            sfp_parse_a2h_thresholds(c->a2_raw, &c->a2);
+
+        /* O cache é compartilhável com quem usa o A0h decodificado */
+        sfp_module_cache_entry_t *e = sfp_module_cache_insert(tbl->cache, fp);
+        memset(&e->a0, 0, sizeof(e->a0));
+        memset(&e->a0_ext, 0, sizeof(e->a0_ext));
+        sfp_parse_a0_all(c->a0_raw, &e->a0, &e->a0_ext);
+        e->a2      = c->a2;
+        e->has_dmi = c->has_dmi;
+        memcpy(e->a2_static, c->a2_raw, SFP_CACHE_A2_STATIC_LEN);
+    }
+
+    c->state       = SFP_CAGE_READY;
+    c->inserted_us = sfp_transport_now_us(tbl->mux->t);
+    c->insertions++;
+}
+
+/* ============================================
+ * Amostra periódica: só a janela dinâmica do A2h
+ * ============================================ */
+static void cage_sample(sfp_cage_table_t *tbl, sfp_cage_t *c)
+{
+    bool ok;
+
+    if (c->has_dmi) {
+        ok = sfp_mux_read_block(tbl->mux, c->channel, SFP_I2C_ADDR_A2, tbl->dyn_offset,
+                                c->a2_raw + tbl->dyn_offset, tbl->dyn_length);
+        if (ok) {
+            sfp_parse_a2h_rx_power(c->a2_raw, &c->a2);
+        }
+    } else {
+        /* Sem DMI: apenas confirma a presença */
+        ok = sfp_mux_probe(tbl->mux, c->channel, SFP_I2C_ADDR_A0);
+    }
+
+    if (!ok) {
+        /* Módulo removido: a próxima fatia tenta recarregar */
+        c->state = SFP_CAGE_EMPTY;
+        c->errors++;
+    }
+}
+
+/* ============================================
+ * Poller round-robin
+ * ============================================ */
+bool sfp_cages_poll(sfp_cage_table_t *tbl)
+{
+    if (!tbl || !tbl->mux || tbl->count == 0)
+        return false;
+
+    uint64_t now  = sfp_transport_now_us(tbl->mux->t);
+    uint32_t slot = tbl->period_us / tbl->count;
+
+    if (now < tbl->next_slot_us)
+        return false;
+
+    /* Atrasado mais de um período: ressincroniza em vez de acumular rajadas */
+    if (now - tbl->next_slot_us > tbl->period_us)
+        tbl->next_slot_us = now;
+    tbl->next_slot_us += slot;
+
+    sfp_cage_t *c = &tbl->cage[tbl->next];
+    tbl->next = (uint8_t)((tbl->next + 1) % tbl->count);
+
+    if (c->state == SFP_CAGE_READY)
+        cage_sample(tbl, c);
+    else
+        cage_load(tbl, c);
+
+    c->last_poll_us = now;
+    c->polls++;
+    return true;
+}
+
+const sfp_cage_t *sfp_cages_get(const sfp_cage_table_t *tbl, uint8_t index)
+{
+    if (!tbl || index >= tbl->count)
+        return NULL;
+
+    return &tbl->cage[index];
+}
@@ -0,0 +1,106 @@
+/**
+ * @file cage.h
+ * @brief Tabela de gaiolas SFP atrás de um multiplexador + poller round-robin
+ *
+ * @details
+ *  Cada gaiola guarda a imagem crua do A0h (bytes 0-95, lida uma única vez
+ *  por inserção) com um índice mínimo, a imagem/diagnósticos do A2h e o
+ *  instante da última amostra. Os campos do A0h são decodificados sob
+ *  demanda pela visão de sfp_8472/a0_view.h (sfp_cage_a0()), sem uma
+ *  cópia de sfp_a0h_base_t por gaiola.
+ *
+ *  O poller atende no máximo uma gaiola por fatia de tempo
+ *  (period_us / count), em ordem circular. Assim cada gaiola é amostrada
+ *  a cada period_us e a taxa agregada do barramento é previsível:
+ *  count amostras de 24 bytes (janela dinâmica do A2h) por período,
+ *  com uma única troca de canal por amostra. Leituras longas (A0h e
+ *  regiões estáticas do A2h) só acontecem quando um módulo é inserido.
+ *
+ *  Com um cache de módulos (tbl->cache, sfp_8472/cache.h), a reinserção
+ *  de um módulo já visto em qualquer gaiola lê só o A0h (fingerprint) e
+ *  a parte dinâmica do A2h, sem decodificar nada de novo.
+ *
+ *  É biblioteca para placas com várias gaiolas atrás de um TCA9548A: a
+ *  placa atual tem uma gaiola direto no i2c0 e main.c não instancia o
+ *  poller. O comportamento é coberto por tools/tests/test_cage.c sobre o
+ *  multiplexador emulado (I2C/transport_host.h).
+ */
+
+#ifndef CAGE_H
+#define CAGE_H
+
+#include "mux.h"
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a0_view.h"
+#include "sfp_8472/a2h.h"
+#include "sfp_8472/cache.h"
+
+typedef enum {
+    SFP_CAGE_EMPTY = 0,   /* sem módulo (NAK em 0x50) */
+    SFP_CAGE_READY,       /* módulo presente, dados estáticos carregados */
+    SFP_CAGE_FAULT        /* módulo responde mas a leitura falhou */
+} sfp_cage_state_t;
+
+/* Índice do A0h: o suficiente para listar/filtrar gaiolas sem decodificar */
+typedef struct {
+    uint32_t fingerprint;
+    uint8_t  identifier;      /* byte 0 */
+    uint8_t  variant;         /* sfp_variant_t (byte 8) */
+    bool     cc_base_ok;
+    bool     cc_ext_ok;
+} sfp_cage_a0_index_t;
+
+typedef struct {
+    uint8_t channel;
+    sfp_cage_state_t state;
+
+    /* Dados estáticos do A0h (uma leitura por inserção) */
+    uint8_t a0_raw[SFP_A0_VIEW_LEN];
+    sfp_cage_a0_index_t a0_idx;
+    bool has_dmi;
+
+    /* A2h: imagem completa (estática na inserção, janela dinâmica a cada amostra) */
+    uint8_t  a2_raw[SFP_A2_SIZE];
+    sfp_a2h_t a2;
+
+    uint64_t inserted_us;
+    uint64_t last_poll_us;
+    uint32_t polls;
+    uint32_t errors;
+    uint32_t insertions;
+} sfp_cage_t;
+
+typedef struct {
+    sfp_mux_t *mux;
+    sfp_cage_t cage[SFP_MUX_CHANNELS];
+    uint8_t  count;
+    uint8_t  next;
+
+    uint32_t period_us;       /* intervalo entre amostras da mesma gaiola */
+    uint64_t next_slot_us;
+
+    uint8_t  dyn_offset;      /* janela dinâmica do A2h */
+    uint8_t  dyn_length;
+
+    sfp_module_cache_t *cache;  /* opcional (NULL após sfp_cages_init) */
+} sfp_cage_table_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* count gaiolas nos canais 0..count-1 do mux */
+bool sfp_cages_init(sfp_cage_table_t *tbl, sfp_mux_t *mux, uint8_t count, uint32_t period_us);
+
+/* Atende a próxima gaiola se a fatia de tempo chegou; true se houve amostra */
+bool sfp_cages_poll(sfp_cage_table_t *tbl);
+
+const sfp_cage_t *sfp_cages_get(const sfp_cage_table_t *tbl, uint8_t index);
+
+/* Visão sobre o A0h da gaiola (válida enquanto state == SFP_CAGE_READY) */
+static inline sfp_a0_view_t sfp_cage_a0(const sfp_cage_t *c)
+{
+    return sfp_a0_view(c->a0_raw);
+}
+
+#endif /* CAGE_H */
@@ -0,0 +1,115 @@
+#include "dmi.h"
+#include <string.h>
+
+/* ============================================
+ * Decodificação
+ * ============================================ */
+static uint16_t dmi_u16(const uint8_t *raw, uint8_t offset)
+{
+    const uint8_t *p = &raw[offset - SFP_DMI_OFFSET];
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static void dmi_decode(sfp_dmi_snapshot_t *s)
+{
+    s->temperature_c = TEMP_TO_DEGC(dmi_u16(s->raw, A2_TEMP_CURR));
+    s->vcc_v         = (float)VCC_TO_VOLTS(dmi_u16(s->raw, A2_VCC_CURR));
+    s->tx_bias_ma    = (float)TX_BIAS_TO_MA(dmi_u16(s->raw, A2_TX_BIAS_CURR));
+    s->tx_power      = POWER_TO_UW(dmi_u16(s->raw, A2_TX_POWER_CURR));
+    s->rx_power      = POWER_TO_UW(dmi_u16(s->raw, A2_RX_POWER));
+
+    s->status        = s->raw[STATUS_CONTROL - SFP_DMI_OFFSET];
+    s->data_ready    = (s->status & (1 << SFP_A2_BIT_DATA_NOT_READY)) == 0;
+    s->alarm_flags   = dmi_u16(s->raw, A2_ALARM_FLAGS);
+    s->warning_flags = dmi_u16(s->raw, A2_WARNING_FLAGS);
+}
+
+/* Monta o snapshot no buffer de trás e troca (o publicado não é alterado) */
+static const sfp_dmi_snapshot_t *dmi_commit(sfp_dmi_t *d, const uint8_t *raw,
+                                            uint64_t timestamp_us, uint8_t reads, bool coherent)
+{
+    uint8_t back = d->valid ? (uint8_t)(d->live ^ 1) : 0;
+    sfp_dmi_snapshot_t *s = &d->snap[back];
+
+    memcpy(s->raw, raw, SFP_DMI_LEN);
+    s->seq          = ++d->seq;
+    s->timestamp_us = timestamp_us;
+    s->reads        = reads;
+    s->coherent     = coherent;
+    dmi_decode(s);
+
+    d->live  = back;
+    d->valid = true;
+    d->captures++;
+    if (!coherent)
+        d->incoherent++;
+    return s;
+}
+
+/* ============================================
+ * API
+ * ============================================ */
+void sfp_dmi_init(sfp_dmi_t *d, const sfp_transport_t *t, uint8_t dev_addr, bool double_read)
+{
+    if (!d)
+        return;
+
+    memset(d, 0, sizeof(*d));
+    d->t           = t;
+    d->dev_addr    = dev_addr;
+    d->double_read = double_read;
+}
+
+bool sfp_dmi_capture(sfp_dmi_t *d)
+{
+    if (!d || !d->t)
+        return false;
+
+    uint8_t buf[2][SFP_DMI_LEN];
+    uint8_t cur = 0;
+    uint8_t reads = 0;
+
+    if (!sfp_read_block(d->t, d->dev_addr, SFP_DMI_OFFSET, buf[cur], SFP_DMI_LEN)) {
+        d->failures++;
+        return false;
+    }
+    reads++;
+
+    /* Sem dupla leitura: uma transação já garante cada campo de 2 bytes */
+    bool coherent = !d->double_read;
+
+    while (!coherent && reads < SFP_DMI_MAX_READS) {
+        uint8_t next = cur ^ 1;
+
+        if (!sfp_read_block(d->t, d->dev_addr, SFP_DMI_OFFSET, buf[next], SFP_DMI_LEN)) {
+            d->failures++;
+            return false;
+        }
+        reads++;
+
+        coherent = memcmp(buf[cur], buf[next], SFP_DMI_MEAS_LEN) == 0;
+        if (!coherent)
+            d->torn++;
+        cur = next;
+    }
+
+    dmi_commit(d, buf[cur], sfp_transport_now_us(d->t), reads, coherent);
+    return true;
+}
+
+const sfp_dmi_snapshot_t *sfp_dmi_publish(sfp_dmi_t *d, const uint8_t raw[SFP_DMI_LEN],
+                                          uint64_t timestamp_us)
+{
+    if (!d || !raw)
+        return NULL;
+
+    return dmi_commit(d, raw, timestamp_us, 1, true);
+}
+
+const sfp_dmi_snapshot_t *sfp_dmi_latest(const sfp_dmi_t *d)
+{
+    if (!d || !d->valid)
+        return NULL;
+
+    return &d->snap[d->live];
+}
@@ -0,0 +1,93 @@
+/**
+ * @file dmi.h
+ * @brief Amostra coerente dos diagnósticos em tempo real (A2h 96-119)
+ *
+ * @details
+ *  A SFF-8472 só garante a coerência de um campo de 2 bytes quando ele é
+ *  lido numa única sequência. Ler os campos separadamente pode misturar
+ *  medidas de conversões A/D diferentes. Aqui toda a janela 96-119
+ *  (medidas, status e flags) vem de uma única transação.
+ *
+ *  Com double_read, a janela é lida novamente e as medidas (96-109) são
+ *  comparadas. Se diferirem (conversão A/D no meio da leitura ou MSB/LSB
+ *  de amostras diferentes), novas leituras são feitas até duas seguidas
+ *  coincidirem, no máximo SFP_DMI_MAX_READS. Se não coincidirem, a amostra
+ *  é publicada com coherent = false.
+ *
+ *  Cada captura gera um sfp_dmi_snapshot_t com número de sequência e
+ *  instante. Os consumidores (menu, log, exportação) leem o mesmo
+ *  snapshot por sfp_dmi_latest() em vez de irem ao barramento. O snapshot
+ *  publicado não é alterado: a próxima captura é montada no outro buffer.
+ *  O ponteiro vale até a captura seguinte à próxima; para guardar por mais
+ *  tempo, copie a struct.
+ */
+
+#ifndef DMI_H
+#define DMI_H
+
+#include "transport.h"
+#include "sfp_8472/defs.h"
+
+/** @brief Janela lida: medidas A/D (96-109) + status/flags (110-119) */
+#define SFP_DMI_OFFSET      A2_TEMP_CURR
+#define SFP_DMI_LEN         (A2_EXT_STATUS_CONTROL + 2 - A2_TEMP_CURR)
+#define SFP_DMI_MEAS_LEN    (STATUS_CONTROL - A2_TEMP_CURR)
+
+#define SFP_DMI_MAX_READS   4
+
+typedef struct {
+    uint32_t seq;
+    uint64_t timestamp_us;    /* fim da leitura (relógio do backend) */
+    uint8_t  reads;           /* leituras feitas nesta captura */
+    bool     coherent;        /* false = dupla leitura não convergiu */
+
+    uint8_t  raw[SFP_DMI_LEN];
+
+    /* Medidas (calibração interna) */
+    float    temperature_c;
+    float    vcc_v;
+    float    tx_bias_ma;
+    float    tx_power;
+    float    rx_power;
+
+    /* Status e flags */
+    uint8_t  status;          /* byte 110 */
+    bool     data_ready;
+    uint16_t alarm_flags;     /* bytes 112-113 */
+    uint16_t warning_flags;   /* bytes 116-117 */
+} sfp_dmi_snapshot_t;
+
+typedef struct {
+    const sfp_transport_t *t;
+    uint8_t dev_addr;
+    bool    double_read;
+
+    sfp_dmi_snapshot_t snap[2];
+    uint8_t  live;            /* índice do snapshot publicado */
+    bool     valid;           /* já houve alguma publicação */
+    uint32_t seq;
+
+    /* Estatísticas */
+    uint32_t captures;
+    uint32_t torn;            /* leituras descartadas por divergência */
+    uint32_t incoherent;      /* capturas publicadas sem confirmação */
+    uint32_t failures;
+} sfp_dmi_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+void sfp_dmi_init(sfp_dmi_t *d, const sfp_transport_t *t, uint8_t dev_addr, bool double_read);
+
+/* Lê a janela (bloqueante) e publica um novo snapshot */
+bool sfp_dmi_capture(sfp_dmi_t *d);
+
+/* Publica uma janela lida por outro caminho (ex.: escalonador) numa única transação */
+const sfp_dmi_snapshot_t *sfp_dmi_publish(sfp_dmi_t *d, const uint8_t raw[SFP_DMI_LEN],
+                                          uint64_t timestamp_us);
+
+/* Último snapshot publicado ou NULL */
+const sfp_dmi_snapshot_t *sfp_dmi_latest(const sfp_dmi_t *d);
+
+#endif /* DMI_H */
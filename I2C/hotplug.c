@@ -0,0 +1,63 @@
+#include "hotplug.h"
+
+void sfp_hotplug_init(sfp_hotplug_t *hp, const sfp_transport_t *t, uint8_t addr, uint32_t settle_us)
+{
+    if (!hp)
+        return;
+
+    hp->t          = t;
+    hp->addr       = addr;
+    hp->settle_us  = settle_us;
+    hp->present    = false;
+    hp->seen_us    = 0;
+    hp->misses     = 0;
+    hp->probes     = 0;
+    hp->insertions = 0;
+    hp->removals   = 0;
+}
+
+/* ============================================
+ * Sondagem
+ * ============================================ */
+sfp_hotplug_event_t sfp_hotplug_poll(sfp_hotplug_t *hp)
+{
+    if (!hp || !hp->t)
+        return SFP_HOTPLUG_NONE;
+
+    bool ack = sfp_probe(hp->t, hp->addr);
+    hp->probes++;
+
+    if (hp->present) {
+        if (ack) {
+            hp->misses = 0;
+            return SFP_HOTPLUG_NONE;
+        }
+        if (++hp->misses < SFP_HOTPLUG_REMOVE_MISSES)
+            return SFP_HOTPLUG_NONE;
+
+        hp->present = false;
+        hp->misses  = 0;
+        hp->removals++;
+        return SFP_HOTPLUG_REMOVED;
+    }
+
+    if (!ack) {
+        hp->seen_us = 0;
+        return SFP_HOTPLUG_NONE;
+    }
+
+    /* Backend sem relógio: confirma na segunda sondagem com ACK */
+    uint64_t now = sfp_transport_now_us(hp->t);
+    if (hp->seen_us == 0) {
+        hp->seen_us = now ? now : 1;
+        if (hp->settle_us)
+            return SFP_HOTPLUG_NONE;
+    } else if (now && now - hp->seen_us < hp->settle_us) {
+        return SFP_HOTPLUG_NONE;
+    }
+
+    hp->present = true;
+    hp->seen_us = 0;
+    hp->insertions++;
+    return SFP_HOTPLUG_INSERTED;
+}
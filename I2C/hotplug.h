@@ -0,0 +1,58 @@
+/**
+ * @file hotplug.h
+ * @brief Detecção de inserção/remoção do módulo por sondagem de presença
+ *
+ * @details
+ *  A cada chamada de sfp_hotplug_poll() é feita uma única sondagem de
+ *  1 byte em 0x50 (sfp_probe). Não há pino MOD_ABS ligado ao RP2040,
+ *  então a presença é inferida pelo ACK da EEPROM.
+ *
+ *  - Inserção: o primeiro ACK inicia uma espera de settle_us (o módulo
+ *    pode levar até t_serial = 300 ms para servir o Serial ID após ser
+ *    energizado). O evento é gerado se ainda houver ACK ao fim da espera.
+ *  - Remoção: exige SFP_HOTPLUG_REMOVE_MISSES NAKs seguidos, para que um
+ *    NAK isolado (ruído, ciclo de escrita) não descarte o módulo.
+ *
+ *  O chamador decide a cadência das sondagens e não deve sondar enquanto
+ *  houver transação em andamento no mesmo barramento.
+ */
+
+#ifndef HOTPLUG_H
+#define HOTPLUG_H
+
+#include "transport.h"
+
+#define SFP_HOTPLUG_SETTLE_US      300000u   /* t_serial (SFF-8472) */
+#define SFP_HOTPLUG_REMOVE_MISSES  2
+
+typedef enum {
+    SFP_HOTPLUG_NONE = 0,
+    SFP_HOTPLUG_INSERTED,
+    SFP_HOTPLUG_REMOVED
+} sfp_hotplug_event_t;
+
+typedef struct {
+    const sfp_transport_t *t;
+    uint8_t  addr;
+    uint32_t settle_us;
+
+    bool     present;       /* estado confirmado */
+    uint64_t seen_us;       /* primeiro ACK ainda não confirmado (0 = nenhum) */
+    uint8_t  misses;        /* NAKs seguidos com o módulo presente */
+
+    /* Estatísticas */
+    uint32_t probes;
+    uint32_t insertions;
+    uint32_t removals;
+} sfp_hotplug_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+void sfp_hotplug_init(sfp_hotplug_t *hp, const sfp_transport_t *t, uint8_t addr, uint32_t settle_us);
+
+/* Uma sondagem; retorna a mudança de estado confirmada, se houver */
+sfp_hotplug_event_t sfp_hotplug_poll(sfp_hotplug_t *hp);
+
+#endif /* HOTPLUG_H */
@@ -1,47 +1,487 @@
 #include "i2c.h"
 #include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
 #include "pico/stdlib.h"
 #include <stdint.h>
+#include <string.h>
 
-bool sfp_i2c_init(i2c_inst_t *i2c, uint sda, uint scl, uint baudrate)
-{
-    i2c_init(i2c, baudrate);
+_Static_assert(SFP_I2C_CMD_READ    == I2C_IC_DATA_CMD_CMD_BITS &&
+               SFP_I2C_CMD_STOP    == I2C_IC_DATA_CMD_STOP_BITS &&
+               SFP_I2C_CMD_RESTART == I2C_IC_DATA_CMD_RESTART_BITS,
+               "i2c_fsm.h fora do layout de IC_DATA_CMD");
+
+/* ============================================
+ * Estado por barramento (i2c0 / i2c1)
+ * ============================================ */
+typedef struct {
+    i2c_inst_t *i2c;
+
+    /* Pinos (necessários para liberar o barramento) e clock atual */
+    bool     has_pins;
+    uint     sda;
+    uint     scl;
+    uint32_t baud;
+
+    /* Fila de descritores atendida pela ISR */
+    sfp_i2c_fsm_t fsm;
+    bool          irq_ready;
 
+    /* Escrita com nostop (offset da EEPROM): encadeada na próxima
+       transferência para o mesmo endereço, sem STOP entre as duas */
+    uint8_t  latch[SFP_I2C_LATCH_MAX];
+    size_t   latch_len;
+    uint8_t  latch_addr;
+
+    /* Leitura assíncrona */
+    sfp_i2c_xfer_t async;
+    uint8_t        async_offset;
+    bool           busy;
+    uint64_t       start_us;
+    uint32_t       timeout_us;
+} sfp_i2c_bus_t;
+
+static sfp_i2c_bus_t buses[2];
+
+static void i2c_pins_attach(uint sda, uint scl)
+{
     gpio_set_function(sda, GPIO_FUNC_I2C);
     gpio_set_function(scl, GPIO_FUNC_I2C);
 
     gpio_pull_up(sda);
     gpio_pull_up(scl);
+}
+
+/* ============================================
+ * Driver por interrupção
+ *
+ * A ISR reabastece a FIFO de TX com as palavras de comando da fila
+ * (I2C/i2c_fsm.c), drena a FIFO de RX para o buffer do descritor e
+ * conclui o descritor no STOP_DET, programando o próximo da fila. A CPU
+ * só é envolvida a cada meia FIFO, em vez de a cada byte.
+ *
+ * RX_FULL dispara com rxflr > rx_tl. Com o limiar em meia FIFO, um resto
+ * menor que isso nunca o dispara, mas a fila já emitiu todas as leituras
+ * (inclusive a do STOP) quando sobram menos de SFP_I2C_FIFO_DEPTH
+ * pendentes: o STOP_DET chega depois do último byte e a ISR drena a FIFO.
+ * ============================================ */
+static void i2c_hw_setup(sfp_i2c_bus_t *bus)
+{
+    i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+
+    hw->intr_mask = 0;
+    hw->rx_tl     = SFP_I2C_RX_TL;              /* RX_FULL com meia FIFO */
+    hw->tx_tl     = SFP_I2C_FIFO_DEPTH / 2;     /* TX_EMPTY com meia FIFO */
+    (void)hw->clr_intr;
+}
+
+static void i2c_hw_refill(sfp_i2c_bus_t *bus)
+{
+    i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+    uint32_t cmd;
+
+    while (hw->txflr < SFP_I2C_FIFO_DEPTH && sfp_i2c_fsm_next_cmd(&bus->fsm, &cmd))
+        hw->data_cmd = cmd;
+
+    if (!sfp_i2c_fsm_active(&bus->fsm)) {
+        hw->intr_mask = 0;
+        return;
+    }
+
+    uint32_t mask = I2C_IC_INTR_MASK_M_TX_ABRT_BITS |
+                    I2C_IC_INTR_MASK_M_STOP_DET_BITS |
+                    I2C_IC_INTR_MASK_M_RX_FULL_BITS;
+    if (!sfp_i2c_fsm_cmds_done(&bus->fsm))
+        mask |= I2C_IC_INTR_MASK_M_TX_EMPTY_BITS;
+    hw->intr_mask = mask;
+}
+
+/* Endereço do escravo só pode ser trocado com o bloco desabilitado */
+static void i2c_hw_begin(sfp_i2c_bus_t *bus, const sfp_i2c_xfer_t *x)
+{
+    i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+
+    hw->enable = 0;
+    hw->tar    = x->addr;
+    hw->enable = 1;
+    (void)hw->clr_tx_abrt;
+    (void)hw->clr_stop_det;
+
+    i2c_hw_refill(bus);
+}
+
+static void i2c_irq_service(sfp_i2c_bus_t *bus)
+{
+    i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+    uint32_t stat = hw->intr_stat;
+
+    /* NAK no endereço/dado: o bloco descarta a FIFO de TX e emite STOP */
+    if (stat & I2C_IC_INTR_STAT_R_TX_ABRT_BITS) {
+        uint32_t src = hw->tx_abrt_source;
+        (void)hw->clr_tx_abrt;
+
+        bool nak = src & (I2C_IC_TX_ABRT_SOURCE_ABRT_7B_ADDR_NOACK_BITS |
+                          I2C_IC_TX_ABRT_SOURCE_ABRT_TXDATA_NOACK_BITS);
+        sfp_i2c_fsm_abort(&bus->fsm, nak ? SFP_XFER_ERR_NAK : SFP_XFER_ERR_IO);
+    }
+
+    while (hw->rxflr)
+        sfp_i2c_fsm_rx(&bus->fsm, (uint8_t)hw->data_cmd);
+
+    if (stat & I2C_IC_INTR_STAT_R_STOP_DET_BITS) {
+        (void)hw->clr_stop_det;
+
+        sfp_i2c_xfer_t *next = sfp_i2c_fsm_stop(&bus->fsm);
+        if (next) {
+            i2c_hw_begin(bus, next);
+            return;
+        }
+    }
+
+    i2c_hw_refill(bus);
+}
 
+static void i2c0_irq_handler(void) { i2c_irq_service(&buses[0]); }
+static void i2c1_irq_handler(void) { i2c_irq_service(&buses[1]); }
+
+static void i2c_irq_attach(sfp_i2c_bus_t *bus)
+{
+    if (bus->irq_ready)
+        return;
+
+    uint idx = i2c_hw_index(bus->i2c);
+
+    sfp_i2c_fsm_init(&bus->fsm);
+    i2c_hw_setup(bus);
+
+    irq_set_exclusive_handler(idx ? I2C1_IRQ : I2C0_IRQ,
+                              idx ? i2c1_irq_handler : i2c0_irq_handler);
+    irq_set_enabled(idx ? I2C1_IRQ : I2C0_IRQ, true);
+    bus->irq_ready = true;
+}
+
+static void i2c_submit(sfp_i2c_bus_t *bus, sfp_i2c_xfer_t *x)
+{
+    i2c_irq_attach(bus);
+
+    uint32_t irq = save_and_disable_interrupts();
+    if (sfp_i2c_fsm_submit(&bus->fsm, x))
+        i2c_hw_begin(bus, x);
+    restore_interrupts(irq);
+}
+
+/* Timeout/travamento: interrompe o bloco (STOP + descarte das FIFOs) e
+   conclui toda a fila com SFP_XFER_ERR_TIMEOUT */
+static void i2c_hw_abort(sfp_i2c_bus_t *bus)
+{
+    if (!bus->irq_ready)
+        return;
+
+    i2c_hw_t *hw = i2c_get_hw(bus->i2c);
+
+    uint32_t irq = save_and_disable_interrupts();
+    hw->intr_mask = 0;
+    if (hw->enable & I2C_IC_ENABLE_ENABLE_BITS)
+        hw->enable = I2C_IC_ENABLE_ENABLE_BITS | I2C_IC_ENABLE_ABORT_BITS;
+    sfp_i2c_fsm_cancel(&bus->fsm, SFP_XFER_ERR_TIMEOUT);
+    restore_interrupts(irq);
+}
+
+/* Espera o descritor com o núcleo em WFE (acordado pela ISR) */
+static int i2c_wait(sfp_i2c_bus_t *bus, sfp_i2c_xfer_t *x, uint32_t timeout_us)
+{
+    absolute_time_t deadline = make_timeout_time_us(timeout_us);
+
+    while (x->state != SFP_I2C_XFER_DONE) {
+        if (best_effort_wfe_or_timeout(deadline) && x->state != SFP_I2C_XFER_DONE) {
+            i2c_hw_abort(bus);
+            break;
+        }
+    }
+    return x->result;
+}
+
+/* Prefixa a escrita com nostop pendente para o mesmo endereço */
+static const uint8_t *i2c_take_latch(sfp_i2c_bus_t *bus, uint8_t addr, size_t *len)
+{
+    *len = 0;
+    if (!bus->latch_len)
+        return NULL;
+
+    size_t n = bus->latch_len;
+    bus->latch_len = 0;
+    if (bus->latch_addr != addr)
+        return NULL;
+
+    *len = n;
+    return bus->latch;
+}
+
+/* ============================================
+ * Inicialização
+ * ============================================ */
+bool sfp_i2c_init(i2c_inst_t *i2c, uint sda, uint scl, uint baudrate)
+{
+    sfp_i2c_bus_t *bus = &buses[i2c_hw_index(i2c)];
+
+    i2c_hw_abort(bus);
+
+    bus->i2c      = i2c;
+    bus->sda      = sda;
+    bus->scl      = scl;
+    bus->has_pins = true;
+    bus->baud     = i2c_init(i2c, baudrate);
+
+    i2c_pins_attach(sda, scl);
+
+    /* i2c_init() reinicia o bloco e com ele as máscaras de interrupção */
+    bus->irq_ready = false;
+    i2c_irq_attach(bus);
     return true;
 }
 
-bool sfp_read_block(i2c_inst_t *i2c,uint8_t dev_addr,uint8_t start_offset,uint8_t *buffer,uint8_t length)
+/* Limite de tempo de uma transferência: 2x o tempo nominal + margem
+   para clock stretching e acesso interno da EEPROM */
+static uint32_t i2c_timeout_us(const sfp_i2c_bus_t *bus, size_t len)
 {
-    if (!buffer || length == 0)
-        return false;
+    uint32_t baud = bus->baud ? bus->baud : 100000u;
+    uint64_t bits = (uint64_t)(len + 1) * 9u;
 
-    /* 1. Envia offset interno */
-    int ret = i2c_write_blocking(
-        i2c,
-        dev_addr,
-        &start_offset,
-        1,
-        true               // repeated start
-    );
+    return SFP_I2C_TIMEOUT_BASE_US + (uint32_t)(2u * bits * 1000000u / baud);
+}
 
-    if (ret != 1)
+/* Transferência bloqueante; enfileira atrás de uma leitura assíncrona
+   em andamento, cujo prazo entra no timeout */
+static int i2c_xfer_blocking(sfp_i2c_bus_t *bus, sfp_i2c_xfer_t *x)
+{
+    size_t len = 0;
+    for (uint8_t i = 0; i < x->nseg; i++)
+        len += x->seg[i].len;
+
+    uint32_t timeout = i2c_timeout_us(bus, len);
+    if (bus->busy)
+        timeout += bus->timeout_us;
+
+    i2c_submit(bus, x);
+    return i2c_wait(bus, x, timeout);
+}
+
+int sfp_i2c_write(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len)
+{
+    sfp_i2c_bus_t *bus = &buses[i2c_hw_index(i2c)];
+    sfp_i2c_xfer_t x;
+
+    bus->i2c = i2c;
+    sfp_i2c_xfer_write(&x, addr, src, len);
+    return i2c_xfer_blocking(bus, &x);
+}
+
+/* ============================================
+ * Backend RP2040 (hardware/i2c)
+ * ============================================ */
+static int rp2040_write(void *ctx, uint8_t addr, const uint8_t *src, size_t len, bool nostop)
+{
+    sfp_i2c_bus_t *bus = ctx;
+
+    if (nostop) {
+        if (len > SFP_I2C_LATCH_MAX)
+            return SFP_XFER_ERR_IO;
+
+        memcpy(bus->latch, src, len);
+        bus->latch_len  = len;
+        bus->latch_addr = addr;
+        return (int)len;
+    }
+
+    size_t plen;
+    const uint8_t *prefix = i2c_take_latch(bus, addr, &plen);
+
+    sfp_i2c_xfer_t x;
+    sfp_i2c_xfer_write(&x, addr, prefix ? prefix : src, prefix ? plen : len);
+    if (prefix) {
+        x.seg[1] = (sfp_i2c_seg_t){ .dir = SFP_I2C_SEG_WRITE, .src = src, .len = len };
+        x.nseg   = 2;
+    }
+
+    int ret = i2c_xfer_blocking(bus, &x);
+    return (ret >= 0) ? (int)len : ret;
+}
+
+static int rp2040_read(void *ctx, uint8_t addr, uint8_t *dst, size_t len, bool nostop)
+{
+    sfp_i2c_bus_t *bus = ctx;
+    (void)nostop;   /* Leituras sempre terminam a transação */
+
+    size_t plen;
+    const uint8_t *prefix = i2c_take_latch(bus, addr, &plen);
+
+    sfp_i2c_xfer_t x;
+    if (prefix)
+        sfp_i2c_xfer_write_read(&x, addr, prefix, plen, dst, len);
+    else
+        sfp_i2c_xfer_read(&x, addr, dst, len);
+
+    return i2c_xfer_blocking(bus, &x);
+}
+
+static bool rp2040_probe(void *ctx, uint8_t addr)
+{
+    uint8_t dummy;
+    return rp2040_read(ctx, addr, &dummy, 1, false) == 1;
+}
+
+static uint64_t rp2040_now_us(void *ctx)
+{
+    (void)ctx;
+    return time_us_64();
+}
+
+static uint32_t rp2040_set_baudrate(void *ctx, uint32_t baud)
+{
+    sfp_i2c_bus_t *bus = ctx;
+
+    /* Não troca o clock com transferências na fila */
+    if (sfp_i2c_fsm_active(&bus->fsm))
+        return 0;
+
+    bus->baud = i2c_set_baudrate(bus->i2c, baud);
+    return bus->baud;
+}
+
+static void rp2040_sleep_us(void *ctx, uint32_t us)
+{
+    (void)ctx;
+    sleep_us(us);
+}
+
+/* ============================================
+ * Liberação do barramento
+ *
+ * Um escravo interrompido no meio de um byte (reset do mestre, glitch
+ * na inserção do módulo) pode manter SDA em nível baixo indefinidamente.
+ * Com os pinos em GPIO, gera até 9 pulsos em SCL até o escravo soltar
+ * SDA, emite uma condição de STOP e reinicializa o bloco I2C.
+ * Saídas em dreno aberto emuladas: nível baixo = saída 0, alto = entrada.
+ * ============================================ */
+static bool rp2040_recover(void *ctx)
+{
+    sfp_i2c_bus_t *bus = ctx;
+
+    i2c_hw_abort(bus);
+
+    uint32_t baud = bus->baud ? bus->baud : 100000u;
+    bool freed = true;
+
+    if (bus->has_pins) {
+        i2c_deinit(bus->i2c);
+
+        gpio_set_function(bus->sda, GPIO_FUNC_SIO);
+        gpio_set_function(bus->scl, GPIO_FUNC_SIO);
+        gpio_set_dir(bus->sda, GPIO_IN);
+        gpio_set_dir(bus->scl, GPIO_IN);
+        gpio_put(bus->sda, 0);
+        gpio_put(bus->scl, 0);
+
+        for (int i = 0; i < 9 && !gpio_get(bus->sda); i++) {
+            gpio_set_dir(bus->scl, GPIO_OUT);
+            sleep_us(SFP_I2C_RECOVER_HALF_US);
+            gpio_set_dir(bus->scl, GPIO_IN);
+            sleep_us(SFP_I2C_RECOVER_HALF_US);
+        }
+
+        /* STOP: SDA sobe com SCL em nível alto */
+        gpio_set_dir(bus->sda, GPIO_OUT);
+        sleep_us(SFP_I2C_RECOVER_HALF_US);
+        gpio_set_dir(bus->sda, GPIO_IN);
+        sleep_us(SFP_I2C_RECOVER_HALF_US);
+
+        freed = gpio_get(bus->sda) && gpio_get(bus->scl);
+
+        bus->baud = i2c_init(bus->i2c, baud);
+        i2c_pins_attach(bus->sda, bus->scl);
+    } else {
+        /* Sem pinos conhecidos: apenas reinicializa o bloco */
+        i2c_deinit(bus->i2c);
+        bus->baud = i2c_init(bus->i2c, baud);
+    }
+
+    /* O reset do bloco zerou as máscaras e limiares de interrupção */
+    if (bus->irq_ready)
+        i2c_hw_setup(bus);
+
+    return freed;
+}
+
+/* ============================================
+ * Leitura assíncrona
+ *
+ * Offset + RESTART + leitura sequencial num único descritor; a ISR
+ * conduz a transação e read_poll só consulta o estado.
+ * ============================================ */
+static bool rp2040_read_start(void *ctx, uint8_t addr, uint8_t offset, uint8_t *dst, size_t len)
+{
+    sfp_i2c_bus_t *bus = ctx;
+
+    if (bus->busy || len == 0)
         return false;
 
-    /* 2. Lê dados sequenciais (EEPROM)*/
-    ret = i2c_read_blocking(
-        i2c,
-        dev_addr,
-        buffer,
-        length,
-        false
-    );
+    bus->async_offset = offset;
+    sfp_i2c_xfer_write_read(&bus->async, addr, &bus->async_offset, 1, dst, len);
+
+    bus->start_us   = time_us_64();
+    bus->timeout_us = i2c_timeout_us(bus, len + 1);
+    bus->busy       = true;
+
+    i2c_submit(bus, &bus->async);
+    return true;
+}
+
+static int rp2040_read_poll(void *ctx)
+{
+    sfp_i2c_bus_t *bus = ctx;
+
+    if (!bus->busy)
+        return SFP_XFER_ERR_IO;
+
+    if (bus->async.state == SFP_I2C_XFER_DONE) {
+        bus->busy = false;
+        return bus->async.result;
+    }
 
-    return (ret == length);
+    if (time_us_64() - bus->start_us <= bus->timeout_us)
+        return SFP_XFER_BUSY;
+
+    /* Barramento parado (SCL preso em baixo ou escravo travado) */
+    i2c_hw_abort(bus);
+    bus->busy = false;
+    return SFP_XFER_ERR_TIMEOUT;
 }
 
+static const sfp_transport_ops_t rp2040_ops = {
+    .write        = rp2040_write,
+    .read         = rp2040_read,
+    .probe        = rp2040_probe,
+    .now_us       = rp2040_now_us,
+    .read_start   = rp2040_read_start,
+    .read_poll    = rp2040_read_poll,
+    .set_baudrate = rp2040_set_baudrate,
+    .sleep_us     = rp2040_sleep_us,
+    .recover      = rp2040_recover,
+};
+
+void sfp_i2c_transport_init(sfp_transport_t *t, i2c_inst_t *i2c)
+{
+    if (!t || !i2c)
+        return;
+
+    sfp_i2c_bus_t *bus = &buses[i2c_hw_index(i2c)];
+    bus->i2c = i2c;
+    i2c_irq_attach(bus);
+
+    t->ops   = &rp2040_ops;
+    t->ctx   = bus;
+    t->speed = NULL;
+    t->retry = NULL;
+    t->trace = NULL;
+    t->stats = NULL;
+}
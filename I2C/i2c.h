@@ -4,12 +4,27 @@
 #include <stdbool.h>
 #include "hardware/i2c.h"
 #include "pico/types.h"
+#include "transport.h"
+#include "i2c_fsm.h"
+
+/** @brief Maior escrita com nostop encadeada na transferência seguinte (offset) */
+#define SFP_I2C_LATCH_MAX 4
+
+/** @brief Margem fixa do timeout de cada transferência (clock stretching) */
+#define SFP_I2C_TIMEOUT_BASE_US 2000
+
+/** @brief Meio período dos pulsos de SCL na liberação do barramento (~100 kHz) */
+#define SFP_I2C_RECOVER_HALF_US 5
 
 /*INICIALIZAÇÃO */
 bool sfp_i2c_init(i2c_inst_t *i2c, uint sda, uint scl, uint baudrate);
 
-/* Memory Access */
-bool sfp_read_block(i2c_inst_t *i2c,uint8_t dev_addr,uint8_t start_offset,uint8_t *buffer,uint8_t length);
+/* Backend RP2040 do transporte (ctx = i2c_inst_t) */
+void sfp_i2c_transport_init(sfp_transport_t *t, i2c_inst_t *i2c);
+
+/* Escrita bloqueante pelo driver por interrupção, fora do transporte
+   (SSD1306). Retorna len ou SFP_XFER_ERR_* */
+int sfp_i2c_write(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len);
 
 
 #endif
@@ -0,0 +1,243 @@
+#include "i2c_fsm.h"
+#include "transport.h"
+#include <string.h>
+
+/* ============================================
+ * Descritores
+ * ============================================ */
+static void xfer_reset(sfp_i2c_xfer_t *x, uint8_t addr)
+{
+    memset(x, 0, sizeof(*x));
+    x->addr  = addr;
+    x->state = SFP_I2C_XFER_IDLE;
+}
+
+void sfp_i2c_xfer_write(sfp_i2c_xfer_t *x, uint8_t addr, const uint8_t *src, size_t len)
+{
+    xfer_reset(x, addr);
+    x->seg[0] = (sfp_i2c_seg_t){ .dir = SFP_I2C_SEG_WRITE, .src = src, .len = len };
+    x->nseg   = 1;
+}
+
+void sfp_i2c_xfer_read(sfp_i2c_xfer_t *x, uint8_t addr, uint8_t *dst, size_t len)
+{
+    xfer_reset(x, addr);
+    x->seg[0] = (sfp_i2c_seg_t){ .dir = SFP_I2C_SEG_READ, .dst = dst, .len = len };
+    x->nseg   = 1;
+}
+
+void sfp_i2c_xfer_write_read(sfp_i2c_xfer_t *x, uint8_t addr,
+                             const uint8_t *src, size_t wlen,
+                             uint8_t *dst, size_t rlen)
+{
+    xfer_reset(x, addr);
+    x->seg[0] = (sfp_i2c_seg_t){ .dir = SFP_I2C_SEG_WRITE, .src = src, .len = wlen };
+    x->seg[1] = (sfp_i2c_seg_t){ .dir = SFP_I2C_SEG_READ,  .dst = dst, .len = rlen };
+    x->nseg   = 2;
+}
+
+/* Resultado de sucesso na convenção do SDK: bytes lidos se houver
+   leitura, senão bytes escritos */
+static size_t xfer_count(const sfp_i2c_xfer_t *x, sfp_i2c_seg_dir_t dir)
+{
+    size_t n = 0;
+
+    for (uint8_t i = 0; i < x->nseg; i++)
+        if (x->seg[i].dir == dir)
+            n += x->seg[i].len;
+    return n;
+}
+
+/* ============================================
+ * Fila
+ * ============================================ */
+void sfp_i2c_fsm_init(sfp_i2c_fsm_t *f)
+{
+    memset(f, 0, sizeof(*f));
+}
+
+static void fsm_finish(sfp_i2c_fsm_t *f, sfp_i2c_xfer_t *x, int result)
+{
+    x->next   = NULL;
+    x->result = result;
+    x->state  = SFP_I2C_XFER_DONE;
+
+    if (result < 0)
+        f->failed++;
+    else
+        f->completed++;
+
+    if (x->cb)
+        x->cb(x, x->user);
+}
+
+bool sfp_i2c_fsm_submit(sfp_i2c_fsm_t *f, sfp_i2c_xfer_t *x)
+{
+    x->next         = NULL;
+    x->cmd_seg      = 0;
+    x->cmd_pos      = 0;
+    x->rx_seg       = 0;
+    x->rx_pos       = 0;
+    x->reads_issued = 0;
+    x->reads_done   = 0;
+
+    /* Sem bytes não há STOP_DET para concluir o descritor */
+    if (xfer_count(x, SFP_I2C_SEG_WRITE) + xfer_count(x, SFP_I2C_SEG_READ) == 0) {
+        fsm_finish(f, x, SFP_XFER_ERR_IO);
+        return false;
+    }
+
+    if (!f->head) {
+        f->head  = f->tail = x;
+        f->error = 0;
+        x->state = SFP_I2C_XFER_ACTIVE;
+        return true;
+    }
+
+    f->tail->next = x;
+    f->tail       = x;
+    x->state      = SFP_I2C_XFER_QUEUED;
+    return false;
+}
+
+sfp_i2c_xfer_t *sfp_i2c_fsm_active(const sfp_i2c_fsm_t *f)
+{
+    return f->head;
+}
+
+/* ============================================
+ * Eventos da ISR
+ * ============================================ */
+
+/* Avança cmd_seg sobre segmentos já emitidos (ou vazios) */
+static const sfp_i2c_seg_t *fsm_cmd_seg(sfp_i2c_xfer_t *x)
+{
+    while (x->cmd_seg < x->nseg && x->cmd_pos >= x->seg[x->cmd_seg].len) {
+        x->cmd_seg++;
+        x->cmd_pos = 0;
+    }
+    return (x->cmd_seg < x->nseg) ? &x->seg[x->cmd_seg] : NULL;
+}
+
+static bool fsm_last_seg(const sfp_i2c_xfer_t *x, uint8_t seg)
+{
+    for (uint8_t i = seg + 1; i < x->nseg; i++)
+        if (x->seg[i].len)
+            return false;
+    return true;
+}
+
+bool sfp_i2c_fsm_next_cmd(sfp_i2c_fsm_t *f, uint32_t *cmd)
+{
+    sfp_i2c_xfer_t *x = f->head;
+    if (!x || f->error)
+        return false;
+
+    const sfp_i2c_seg_t *seg = fsm_cmd_seg(x);
+    if (!seg)
+        return false;
+
+    uint32_t c;
+    if (seg->dir == SFP_I2C_SEG_READ) {
+        if (x->reads_issued - x->reads_done >= SFP_I2C_FIFO_DEPTH)
+            return false;
+        c = SFP_I2C_CMD_READ;
+        x->reads_issued++;
+    } else {
+        c = seg->src[x->cmd_pos];
+    }
+
+    /* RESTART na virada de segmento; o primeiro START é do próprio bloco */
+    if (x->cmd_pos == 0 && x->cmd_seg > 0)
+        c |= SFP_I2C_CMD_RESTART;
+    if (x->cmd_pos == seg->len - 1 && fsm_last_seg(x, x->cmd_seg))
+        c |= SFP_I2C_CMD_STOP;
+
+    x->cmd_pos++;
+    *cmd = c;
+    return true;
+}
+
+bool sfp_i2c_fsm_cmds_done(const sfp_i2c_fsm_t *f)
+{
+    const sfp_i2c_xfer_t *x = f->head;
+    if (!x || f->error)
+        return true;
+
+    for (uint8_t i = x->cmd_seg; i < x->nseg; i++) {
+        size_t sent = (i == x->cmd_seg) ? x->cmd_pos : 0;
+        if (sent < x->seg[i].len)
+            return false;
+    }
+    return true;
+}
+
+void sfp_i2c_fsm_rx(sfp_i2c_fsm_t *f, uint8_t byte)
+{
+    sfp_i2c_xfer_t *x = f->head;
+    if (!x)
+        return;
+
+    while (x->rx_seg < x->nseg &&
+           (x->seg[x->rx_seg].dir != SFP_I2C_SEG_READ ||
+            x->rx_pos >= x->seg[x->rx_seg].len)) {
+        x->rx_seg++;
+        x->rx_pos = 0;
+    }
+
+    /* Byte sem leitura correspondente: descarta */
+    if (x->rx_seg >= x->nseg)
+        return;
+
+    x->seg[x->rx_seg].dst[x->rx_pos++] = byte;
+    x->reads_done++;
+}
+
+void sfp_i2c_fsm_abort(sfp_i2c_fsm_t *f, int err)
+{
+    if (f->head && !f->error)
+        f->error = err;
+}
+
+sfp_i2c_xfer_t *sfp_i2c_fsm_stop(sfp_i2c_fsm_t *f)
+{
+    sfp_i2c_xfer_t *x = f->head;
+    if (!x)
+        return NULL;
+
+    int result;
+    if (f->error)
+        result = f->error;
+    else if (!sfp_i2c_fsm_cmds_done(f) ||
+             x->reads_done != xfer_count(x, SFP_I2C_SEG_READ))
+        result = SFP_XFER_ERR_IO;          /* STOP antes do fim: perda de arbitragem */
+    else if (x->reads_done)
+        result = (int)x->reads_done;
+    else
+        result = (int)xfer_count(x, SFP_I2C_SEG_WRITE);
+
+    f->head  = x->next;
+    f->error = 0;
+    if (!f->head)
+        f->tail = NULL;
+    else
+        f->head->state = SFP_I2C_XFER_ACTIVE;
+
+    fsm_finish(f, x, result);
+    return f->head;
+}
+
+void sfp_i2c_fsm_cancel(sfp_i2c_fsm_t *f, int err)
+{
+    sfp_i2c_xfer_t *x = f->head;
+
+    f->head  = NULL;
+    f->tail  = NULL;
+    f->error = 0;
+
+    while (x) {
+        sfp_i2c_xfer_t *next = x->next;
+        fsm_finish(f, x, err);
+        x = next;
+    }
+}
@@ -0,0 +1,145 @@
+/**
+ * @file i2c_fsm.h
+ * @brief Máquina de estados do mestre I2C dirigido por interrupção
+ *
+ * @details
+ *  Lógica de protocolo do driver de I2C do RP2040 (I2C/i2c.c), separada
+ *  do hardware para poder ser testada no host. Não acessa registradores:
+ *  a ISR pede a próxima palavra de comando para a FIFO de TX, entrega
+ *  cada byte drenado da FIFO de RX e sinaliza abortos (TX_ABRT) e o fim
+ *  da transação (STOP_DET).
+ *
+ *  Cada transferência é um descritor com até dois segmentos (escrita e/ou
+ *  leitura) no mesmo endereço, emitidos como uma única transação: o
+ *  segundo segmento começa com RESTART e o último comando leva STOP. O
+ *  caso típico é o offset da EEPROM seguido da leitura sequencial.
+ *
+ *  Os descritores formam uma fila simplesmente encadeada; o primeiro é o
+ *  ativo. A memória é do chamador e precisa existir até a conclusão.
+ *
+ *  As palavras de comando usam o layout de IC_DATA_CMD do RP2040
+ *  (DW_apb_i2c): bits 0-7 dado, bit 8 leitura, bit 9 STOP, bit 10 RESTART.
+ */
+
+#ifndef I2C_FSM_H
+#define I2C_FSM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Bits da palavra de comando (IC_DATA_CMD) */
+#define SFP_I2C_CMD_READ     (1u << 8)
+#define SFP_I2C_CMD_STOP     (1u << 9)
+#define SFP_I2C_CMD_RESTART  (1u << 10)
+
+/* Profundidade das FIFOs de TX/RX do bloco I2C */
+#define SFP_I2C_FIFO_DEPTH   16
+
+/* IC_RX_TL: RX_FULL com rxflr > limiar, ou seja, com meia FIFO cheia */
+#define SFP_I2C_RX_TL        (SFP_I2C_FIFO_DEPTH / 2 - 1)
+
+#define SFP_I2C_XFER_MAX_SEGS 2
+
+typedef enum {
+    SFP_I2C_SEG_WRITE = 0,
+    SFP_I2C_SEG_READ
+} sfp_i2c_seg_dir_t;
+
+typedef struct {
+    sfp_i2c_seg_dir_t dir;
+    const uint8_t    *src;      /* SFP_I2C_SEG_WRITE */
+    uint8_t          *dst;      /* SFP_I2C_SEG_READ  */
+    size_t            len;
+} sfp_i2c_seg_t;
+
+typedef enum {
+    SFP_I2C_XFER_IDLE = 0,
+    SFP_I2C_XFER_QUEUED,
+    SFP_I2C_XFER_ACTIVE,
+    SFP_I2C_XFER_DONE
+} sfp_i2c_xfer_state_t;
+
+struct sfp_i2c_xfer;
+
+/* Chamado no contexto da ISR quando o descritor termina */
+typedef void (*sfp_i2c_xfer_cb_t)(struct sfp_i2c_xfer *x, void *user);
+
+typedef struct sfp_i2c_xfer {
+    uint8_t       addr;
+    uint8_t       nseg;
+    sfp_i2c_seg_t seg[SFP_I2C_XFER_MAX_SEGS];
+
+    sfp_i2c_xfer_cb_t cb;
+    void             *user;
+
+    /* Estado (escrito pela ISR) */
+    volatile sfp_i2c_xfer_state_t state;
+    volatile int                  result;  /* bytes transferidos ou SFP_XFER_ERR_* */
+
+    /* Cursores internos */
+    struct sfp_i2c_xfer *next;
+    uint8_t  cmd_seg;
+    size_t   cmd_pos;
+    uint8_t  rx_seg;
+    size_t   rx_pos;
+    size_t   reads_issued;
+    size_t   reads_done;
+} sfp_i2c_xfer_t;
+
+typedef struct {
+    sfp_i2c_xfer_t *head;       /* Descritor ativo */
+    sfp_i2c_xfer_t *tail;
+    int             error;      /* Aborto pendente até o STOP */
+
+    uint32_t completed;
+    uint32_t failed;
+} sfp_i2c_fsm_t;
+
+/* ============================================
+ * Descritores
+ * ============================================ */
+void sfp_i2c_xfer_write(sfp_i2c_xfer_t *x, uint8_t addr, const uint8_t *src, size_t len);
+void sfp_i2c_xfer_read(sfp_i2c_xfer_t *x, uint8_t addr, uint8_t *dst, size_t len);
+
+/* Escrita (ex.: offset) + RESTART + leitura numa única transação */
+void sfp_i2c_xfer_write_read(sfp_i2c_xfer_t *x, uint8_t addr,
+                             const uint8_t *src, size_t wlen,
+                             uint8_t *dst, size_t rlen);
+
+/* ============================================
+ * Fila
+ * ============================================ */
+void sfp_i2c_fsm_init(sfp_i2c_fsm_t *f);
+
+/* Enfileira x. Retorna true se x virou o ativo (o hardware deve ser
+   programado para x->addr antes de puxar comandos). */
+bool sfp_i2c_fsm_submit(sfp_i2c_fsm_t *f, sfp_i2c_xfer_t *x);
+
+sfp_i2c_xfer_t *sfp_i2c_fsm_active(const sfp_i2c_fsm_t *f);
+
+/* ============================================
+ * Eventos da ISR
+ * ============================================ */
+
+/* Próxima palavra para a FIFO de TX. Retorna false quando o descritor
+   ativo já emitiu todos os comandos, foi abortado ou quando há
+   SFP_I2C_FIFO_DEPTH leituras pendentes (a FIFO de RX encheria). */
+bool sfp_i2c_fsm_next_cmd(sfp_i2c_fsm_t *f, uint32_t *cmd);
+
+/* Todos os comandos do ativo já foram para a FIFO (ou não há ativo) */
+bool sfp_i2c_fsm_cmds_done(const sfp_i2c_fsm_t *f);
+
+/* Byte recebido da FIFO de RX */
+void sfp_i2c_fsm_rx(sfp_i2c_fsm_t *f, uint8_t byte);
+
+/* TX_ABRT: o bloco descartou a FIFO e emitirá STOP. err = SFP_XFER_ERR_* */
+void sfp_i2c_fsm_abort(sfp_i2c_fsm_t *f, int err);
+
+/* STOP_DET: conclui o ativo (chama cb) e retorna o próximo da fila */
+sfp_i2c_xfer_t *sfp_i2c_fsm_stop(sfp_i2c_fsm_t *f);
+
+/* Conclui todos os descritores com err (timeout/recuperação do barramento) */
+void sfp_i2c_fsm_cancel(sfp_i2c_fsm_t *f, int err);
+
+#endif
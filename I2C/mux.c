@@ -0,0 +1,81 @@
+#include "mux.h"
+
+/* ============================================
+ * Seleção de canal
+ * ============================================ */
+void sfp_mux_init(sfp_mux_t *m, const sfp_transport_t *t, uint8_t mux_addr)
+{
+    if (!m)
+        return;
+
+    m->t           = t;
+    m->addr        = mux_addr;
+    m->current     = SFP_MUX_NONE;
+    m->selects     = 0;
+    m->select_hits = 0;
+}
+
+static bool mux_write_mask(sfp_mux_t *m, uint8_t mask)
+{
+    if (!sfp_write_raw(m->t, m->addr, &mask, 1)) {
+        m->current = SFP_MUX_NONE;
+        return false;
+    }
+
+    m->selects++;
+    return true;
+}
+
+bool sfp_mux_select(sfp_mux_t *m, uint8_t channel)
+{
+    if (!m || !m->t || channel >= SFP_MUX_CHANNELS)
+        return false;
+
+    if (m->current == (int8_t)channel) {
+        m->select_hits++;
+        return true;
+    }
+
+    if (!mux_write_mask(m, (uint8_t)(1u << channel)))
+        return false;
+
+    m->current = (int8_t)channel;
+    return true;
+}
+
+bool sfp_mux_deselect(sfp_mux_t *m)
+{
+    if (!m || !m->t)
+        return false;
+
+    if (!mux_write_mask(m, 0))
+        return false;
+
+    m->current = SFP_MUX_NONE;
+    return true;
+}
+
+/* ============================================
+ * Acesso através do canal
+ * ============================================ */
+bool sfp_mux_read_block(sfp_mux_t *m, uint8_t channel, uint8_t dev_addr,
+                        uint8_t start_offset, uint8_t *buffer, uint8_t length)
+{
+    if (!sfp_mux_select(m, channel))
+        return false;
+
+    if (!sfp_read_block(m->t, dev_addr, start_offset, buffer, length)) {
+        /* Falha pode ter sido um reset do mux: força nova seleção */
+        m->current = SFP_MUX_NONE;
+        return false;
+    }
+    return true;
+}
+
+bool sfp_mux_probe(sfp_mux_t *m, uint8_t channel, uint8_t dev_addr)
+{
+    if (!sfp_mux_select(m, channel))
+        return false;
+
+    return sfp_probe(m->t, dev_addr);
+}
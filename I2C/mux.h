@@ -0,0 +1,54 @@
+/**
+ * @file mux.h
+ * @brief Seleção de canal em multiplexador I2C (TCA9548A e compatíveis)
+ *
+ * @details
+ *  Cada gaiola SFP fica atrás de um canal do multiplexador, todas com os
+ *  mesmos endereços 0x50/0x51. O registrador de controle do TCA9548A é
+ *  um único byte com um bit por canal; escrever 0 desconecta todos.
+ *
+ *  O canal atualmente selecionado é memorizado, então transações seguidas
+ *  na mesma gaiola não repetem a escrita de seleção. Após uma falha o
+ *  estado é descartado e a próxima transação reprograma o canal.
+ */
+
+#ifndef MUX_H
+#define MUX_H
+
+#include "transport.h"
+
+/** @brief Endereço padrão (A2..A0 = 0) e faixa do TCA9548A */
+#define SFP_MUX_ADDR_DEFAULT  0x70
+#define SFP_MUX_CHANNELS      8
+
+/** @brief Nenhum canal selecionado / estado desconhecido */
+#define SFP_MUX_NONE          (-1)
+
+typedef struct {
+    const sfp_transport_t *t;
+    uint8_t addr;
+    int8_t  current;       /* canal selecionado ou SFP_MUX_NONE */
+
+    /* Estatísticas */
+    uint32_t selects;      /* escritas de seleção efetivamente enviadas */
+    uint32_t select_hits;  /* seleções evitadas (canal já ativo) */
+} sfp_mux_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+void sfp_mux_init(sfp_mux_t *m, const sfp_transport_t *t, uint8_t mux_addr);
+
+/* Seleciona o canal (sem escrita se já estiver ativo) */
+bool sfp_mux_select(sfp_mux_t *m, uint8_t channel);
+
+/* Desconecta todos os canais */
+bool sfp_mux_deselect(sfp_mux_t *m);
+
+/* sfp_read_block()/sfp_probe() no canal indicado */
+bool sfp_mux_read_block(sfp_mux_t *m, uint8_t channel, uint8_t dev_addr,
+                        uint8_t start_offset, uint8_t *buffer, uint8_t length);
+bool sfp_mux_probe(sfp_mux_t *m, uint8_t channel, uint8_t dev_addr);
+
+#endif /* MUX_H */
@@ -0,0 +1,136 @@
+#include "page.h"
+#include "sfp_8472/defs.h"
+#include "sfp_8472/a2h.h"
+
+/* ============================================
+ * Estado da página
+ * ============================================ */
+void sfp_page_init(sfp_page_t *p, const sfp_transport_t *t)
+{
+    if (!p)
+        return;
+
+    p->t           = t;
+    p->current     = SFP_PAGE_NONE;
+    p->saved       = SFP_PAGE_NONE;
+    p->selects     = 0;
+    p->select_hits = 0;
+}
+
+void sfp_page_invalidate(sfp_page_t *p)
+{
+    if (p)
+        p->current = SFP_PAGE_NONE;
+}
+
+bool sfp_page_begin(sfp_page_t *p)
+{
+    uint8_t page;
+
+    if (!p || !p->t)
+        return false;
+
+    if (!sfp_read_block(p->t, SFP_I2C_ADDR_A2, A2_PAGE_SELECT, &page, 1)) {
+        p->current = SFP_PAGE_NONE;
+        p->saved   = SFP_PAGE_NONE;
+        return false;
+    }
+
+    p->current = page;
+    p->saved   = page;
+    return true;
+}
+
+/* ============================================
+ * Seleção
+ * ============================================ */
+bool sfp_page_select(sfp_page_t *p, uint8_t page)
+{
+    if (!p || !p->t)
+        return false;
+
+    if (p->current == (int16_t)page) {
+        p->select_hits++;
+        return true;
+    }
+
+    /* Byte 127 é um registrador volátil: escrita direta, sem ACK polling */
+    uint8_t cmd[2] = { A2_PAGE_SELECT, page };
+    if (!sfp_write_raw(p->t, SFP_I2C_ADDR_A2, cmd, sizeof(cmd))) {
+        p->current = SFP_PAGE_NONE;
+        return false;
+    }
+
+    p->selects++;
+    p->current = page;
+    return true;
+}
+
+/* ============================================
+ * Leitura da memória superior
+ * ============================================ */
+bool sfp_page_read(sfp_page_t *p, uint8_t page, uint8_t offset,
+                   uint8_t *buffer, uint8_t length)
+{
+    if (!buffer || length == 0 || offset < SFP_PAGE_UPPER_START ||
+        (uint16_t)offset + length > SFP_PAGE_UPPER_START + SFP_PAGE_UPPER_SIZE)
+        return false;
+
+    if (!sfp_page_select(p, page))
+        return false;
+
+    if (!sfp_read_block(p->t, SFP_I2C_ADDR_A2, offset, buffer, length)) {
+        /* Falha pode ter sido reset/remoção do módulo: força nova seleção */
+        p->current = SFP_PAGE_NONE;
+        return false;
+    }
+    return true;
+}
+
+bool sfp_page_end(sfp_page_t *p)
+{
+    if (!p || !p->t)
+        return false;
+
+    if (p->saved == SFP_PAGE_NONE)
+        return true;
+
+    if (!sfp_page_select(p, (uint8_t)p->saved))
+        return false;
+
+    p->saved = SFP_PAGE_NONE;
+    return true;
+}
+
+/* ============================================
+ * A0h 128-255 sob demanda
+ * ============================================ */
+void sfp_a0_upper_init(sfp_a0_upper_t *u, const sfp_transport_t *t)
+{
+    if (!u)
+        return;
+
+    u->t      = t;
+    u->loaded = false;
+    u->reads  = 0;
+}
+
+void sfp_a0_upper_invalidate(sfp_a0_upper_t *u)
+{
+    if (u)
+        u->loaded = false;
+}
+
+const uint8_t *sfp_a0_upper_get(sfp_a0_upper_t *u)
+{
+    if (!u || !u->t)
+        return NULL;
+
+    if (!u->loaded) {
+        u->reads++;
+        if (!sfp_read_block(u->t, SFP_I2C_ADDR_A0, SFP_A0_UPPER_START, u->data, SFP_A0_UPPER_SIZE))
+            return NULL;
+        u->loaded = true;
+    }
+    return u->data;
+}
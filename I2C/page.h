@@ -0,0 +1,90 @@
+/**
+ * @file page.h
+ * @brief Acesso à memória superior paginada do A2h (bytes 128-255)
+ *
+ * @details
+ *  No A2h o byte 127 seleciona qual página aparece em 128-255 (SFF-8472
+ *  Seção 4.3). A página atualmente selecionada é memorizada, então leituras
+ *  seguidas da mesma página não repetem a escrita de seleção — mesmo
+ *  esquema do canal do multiplexador (mux.h).
+ *
+ *  Uso típico:
+ *      sfp_page_begin(&pg);               // lê e guarda a página atual
+ *      sfp_page_read(&pg, PAGE_02, ...);  // seleciona (se preciso) e lê
+ *      sfp_page_end(&pg);                 // restaura a página original
+ *
+ *  A restauração deixa o módulo como estava para outros mestres/ferramentas
+ *  que assumem a página 00h. Se outra parte do firmware escrever no byte
+ *  127 por fora deste módulo, chame sfp_page_invalidate().
+ *
+ *  O A0h não é paginado, mas a metade superior (128-255, área do
+ *  fornecedor) segue a mesma ideia de acesso sob demanda: sfp_a0_upper_t
+ *  lê os 128 bytes na primeira consulta e os mantém até o módulo mudar
+ *  (sfp_a0_upper_invalidate()), sem custo na inserção.
+ */
+
+#ifndef PAGE_H
+#define PAGE_H
+
+#include "transport.h"
+#include "sfp_8472/a0h.h"
+
+/** @brief Faixa da memória paginada do A2h */
+#define SFP_PAGE_UPPER_START  128
+#define SFP_PAGE_UPPER_SIZE   128
+
+/** @brief Página desconhecida (cache inválido) */
+#define SFP_PAGE_NONE         (-1)
+
+typedef struct {
+    const sfp_transport_t *t;
+    int16_t current;       /* página selecionada ou SFP_PAGE_NONE */
+    int16_t saved;         /* página encontrada em sfp_page_begin() */
+
+    /* Estatísticas */
+    uint32_t selects;      /* escritas no byte 127 efetivamente enviadas */
+    uint32_t select_hits;  /* seleções evitadas (página já ativa) */
+} sfp_page_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+void sfp_page_init(sfp_page_t *p, const sfp_transport_t *t);
+
+/* Descarta a página memorizada (próxima leitura reescreve o byte 127) */
+void sfp_page_invalidate(sfp_page_t *p);
+
+/* Lê o byte 127 e guarda a página atual para restauração */
+bool sfp_page_begin(sfp_page_t *p);
+
+/* Seleciona a página (sem escrita se já estiver ativa) */
+bool sfp_page_select(sfp_page_t *p, uint8_t page);
+
+/* Lê 'length' bytes a partir de 'offset' (128-255) da página indicada */
+bool sfp_page_read(sfp_page_t *p, uint8_t page, uint8_t offset,
+                   uint8_t *buffer, uint8_t length);
+
+/* Restaura a página guardada em sfp_page_begin() */
+bool sfp_page_end(sfp_page_t *p);
+
+/**********************************************
+ * A0h 128-255 (área do fornecedor), leitura preguiçosa
+ **********************************************/
+typedef struct {
+    const sfp_transport_t *t;
+    bool    loaded;
+    uint8_t data[SFP_A0_UPPER_SIZE];
+
+    uint32_t reads;        /* leituras efetivas no barramento */
+} sfp_a0_upper_t;
+
+void sfp_a0_upper_init(sfp_a0_upper_t *u, const sfp_transport_t *t);
+
+/* Módulo trocado: a próxima consulta relê a área */
+void sfp_a0_upper_invalidate(sfp_a0_upper_t *u);
+
+/* Bytes 128-255 do A0h (data[0] = byte 128); NULL se a leitura falhar */
+const uint8_t *sfp_a0_upper_get(sfp_a0_upper_t *u);
+
+#endif /* PAGE_H */
@@ -0,0 +1,111 @@
+#include "retry.h"
+#include <string.h>
+
+/* ============================================
+ * Contadores por dispositivo
+ * ============================================ */
+void sfp_retry_init(sfp_retry_t *r)
+{
+    if (!r)
+        return;
+
+    memset(r, 0, sizeof(*r));
+    r->max_attempts    = SFP_RETRY_DEFAULT_ATTEMPTS;
+    r->backoff_base_us = SFP_RETRY_DEFAULT_BASE_US;
+    r->backoff_max_us  = SFP_RETRY_DEFAULT_MAX_US;
+}
+
+const sfp_dev_counters_t *sfp_retry_counters(const sfp_retry_t *r, uint8_t addr)
+{
+    if (!r)
+        return NULL;
+
+    for (uint8_t i = 0; i < r->count; i++) {
+        if (r->dev[i].addr == addr)
+            return &r->dev[i];
+    }
+    return NULL;
+}
+
+static sfp_dev_counters_t *retry_slot(sfp_retry_t *r, uint8_t addr)
+{
+    sfp_dev_counters_t *c = (sfp_dev_counters_t *)sfp_retry_counters(r, addr);
+    if (c)
+        return c;
+
+    if (r->count >= SFP_RETRY_MAX_DEVICES)
+        return NULL;
+
+    c = &r->dev[r->count++];
+    memset(c, 0, sizeof(*c));
+    c->addr = addr;
+    return c;
+}
+
+/* ============================================
+ * Política de tentativas
+ * ============================================ */
+uint8_t sfp_retry_attempts(const sfp_transport_t *t)
+{
+    if (!t || !t->retry || t->retry->max_attempts == 0)
+        return 1;
+
+    return t->retry->max_attempts;
+}
+
+void sfp_retry_backoff(const sfp_transport_t *t, uint8_t attempt)
+{
+    if (!t || !t->retry || attempt == 0 || !t->ops->sleep_us)
+        return;
+
+    const sfp_retry_t *r = t->retry;
+    uint32_t delay = r->backoff_base_us;
+
+    for (uint8_t i = 1; i < attempt && delay < r->backoff_max_us; i++)
+        delay <<= 1;
+
+    if (delay > r->backoff_max_us)
+        delay = r->backoff_max_us;
+
+    t->ops->sleep_us(t->ctx, delay);
+}
+
+void sfp_retry_record(const sfp_transport_t *t, uint8_t addr, int result, bool is_retry)
+{
+    if (!t)
+        return;
+
+    sfp_dev_counters_t *c = t->retry ? retry_slot(t->retry, addr) : NULL;
+    bool recover = false;
+
+    if (c && is_retry)
+        c->retries++;
+
+    if (result >= 0) {
+        if (c) c->ok++;
+        return;
+    }
+
+    switch (result) {
+    case SFP_XFER_ERR_NAK:
+        if (c) c->nak++;
+        break;
+    case SFP_XFER_ERR_TIMEOUT:
+        if (c) c->timeout++;
+        recover = true;
+        break;
+    case SFP_XFER_BUSY:
+        if (c) c->io++;
+        break;
+    default:
+        if (c) c->io++;
+        recover = true;
+        break;
+    }
+
+    /* Barramento possivelmente travado (SDA preso por um escravo) */
+    if (recover && t->ops->recover) {
+        t->ops->recover(t->ctx);
+        if (c) c->recoveries++;
+    }
+}
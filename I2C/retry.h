@@ -0,0 +1,72 @@
+/**
+ * @file retry.h
+ * @brief Política de novas tentativas e contadores de saúde por dispositivo
+ *
+ * @details
+ *  Uma transação que falha é repetida até max_attempts vezes, com espera
+ *  exponencial limitada entre as tentativas (base, 2x base, 4x base ...
+ *  até backoff_max_us). Após timeout ou erro de barramento o backend é
+ *  recuperado (ops->recover: liberação do SCL com 9 pulsos + STOP e
+ *  reinicialização do bloco I2C) antes da próxima tentativa; NAK apenas
+ *  espera, pois costuma indicar EEPROM ocupada ou módulo sendo inserido;
+ *  SFP_XFER_BUSY (clock não trocado com transferências da ISR em curso)
+ *  também só espera: recuperar abortaria justamente essas transferências.
+ *
+ *  Cada endereço mantém contadores de sucesso, NAK, timeout, erro,
+ *  novas tentativas e recuperações, permitindo diagnosticar um módulo ou
+ *  barramento degradado sem parar o sistema.
+ */
+
+#ifndef RETRY_H
+#define RETRY_H
+
+#include "transport.h"
+
+/** @brief Quantidade máxima de dispositivos com contadores próprios */
+#define SFP_RETRY_MAX_DEVICES       8
+
+/** @brief Política padrão */
+#define SFP_RETRY_DEFAULT_ATTEMPTS  4
+#define SFP_RETRY_DEFAULT_BASE_US   200
+#define SFP_RETRY_DEFAULT_MAX_US    5000
+
+typedef struct {
+    uint8_t  addr;
+    uint32_t ok;
+    uint32_t nak;
+    uint32_t timeout;
+    uint32_t io;
+    uint32_t retries;
+    uint32_t recoveries;
+} sfp_dev_counters_t;
+
+struct sfp_retry {
+    uint8_t  max_attempts;      /* tentativas totais por transação (>= 1) */
+    uint32_t backoff_base_us;
+    uint32_t backoff_max_us;
+
+    sfp_dev_counters_t dev[SFP_RETRY_MAX_DEVICES];
+    uint8_t count;
+};
+typedef struct sfp_retry sfp_retry_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* Inicializa com a política padrão e contadores zerados */
+void sfp_retry_init(sfp_retry_t *r);
+
+/* Contadores do endereço (NULL se nunca houve transação) */
+const sfp_dev_counters_t *sfp_retry_counters(const sfp_retry_t *r, uint8_t addr);
+
+/* Tentativas permitidas pelo transporte (1 se sem política) */
+uint8_t sfp_retry_attempts(const sfp_transport_t *t);
+
+/* Espera antes da tentativa 'attempt' (>= 1) */
+void sfp_retry_backoff(const sfp_transport_t *t, uint8_t attempt);
+
+/* Contabiliza o resultado de uma tentativa e recupera o barramento se necessário */
+void sfp_retry_record(const sfp_transport_t *t, uint8_t addr, int result, bool is_retry);
+
+#endif /* RETRY_H */
@@ -0,0 +1,312 @@
+#include "sched.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ============================================
+ * Auxiliares
+ * ============================================ */
+static uint64_t sched_now(const sfp_sched_req_t *req)
+{
+    return sfp_transport_now_us(req->t);
+}
+
+static int sched_lane(sfp_sched_t *s, void *ctx)
+{
+    for (int i = 0; i < SFP_SCHED_MAX_BUSES; i++) {
+        if (s->lane[i].ctx == ctx)
+            return i;
+    }
+    for (int i = 0; i < SFP_SCHED_MAX_BUSES; i++) {
+        if (s->lane[i].ctx == NULL) {
+            s->lane[i].ctx = ctx;
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* true se a tem precedência sobre b */
+static bool sched_before(const sfp_sched_req_t *a, const sfp_sched_req_t *b)
+{
+    if (a->prio != b->prio)
+        return a->prio < b->prio;
+
+    /* Deadline mais próximo primeiro; sem deadline vai por último */
+    if (a->deadline_us != b->deadline_us) {
+        if (a->deadline_us == 0) return false;
+        if (b->deadline_us == 0) return true;
+        return a->deadline_us < b->deadline_us;
+    }
+
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+static bool sched_enqueue(sfp_sched_t *s, sfp_sched_req_t *req)
+{
+    if (sched_lane(s, req->t->ctx) < 0)
+        return false;
+
+    req->state      = SFP_SCHED_QUEUED;
+    req->result     = 0;
+    req->seq        = s->seq++;
+    req->enqueue_us = sched_now(req);
+    req->start_us   = 0;
+    req->end_us     = 0;
+
+    req->next = s->queue;
+    s->queue  = req;
+
+    sfp_sched_metrics_t *m = &s->metrics;
+    m->submitted[req->prio]++;
+    m->depth++;
+    if (m->depth > m->depth_max)
+        m->depth_max = m->depth;
+    return true;
+}
+
+/* Remove da fila a melhor requisição cujo barramento esteja livre */
+static sfp_sched_req_t *sched_pick(sfp_sched_t *s)
+{
+    sfp_sched_req_t **best = NULL;
+
+    for (sfp_sched_req_t **pp = &s->queue; *pp; pp = &(*pp)->next) {
+        int lane = sched_lane(s, (*pp)->t->ctx);
+        if (lane < 0 || s->lane[lane].active)
+            continue;
+        if (!best || sched_before(*pp, *best))
+            best = pp;
+    }
+
+    if (!best)
+        return NULL;
+
+    sfp_sched_req_t *req = *best;
+    *best = req->next;
+    req->next = NULL;
+    s->metrics.depth--;
+    return req;
+}
+
+/* ============================================
+ * Conclusão
+ * ============================================ */
+static void sched_finish(sfp_sched_t *s, sfp_sched_req_t *req, int result)
+{
+    sfp_sched_metrics_t *m = &s->metrics;
+
+    req->end_us = sched_now(req);
+    req->result = result;
+    req->state  = (result == (int)req->length) ? SFP_SCHED_DONE : SFP_SCHED_ERROR;
+
+    uint32_t service = (uint32_t)(req->end_us - req->start_us);
+    m->service_us_total[req->prio] += service;
+    if (service > m->service_us_max[req->prio])
+        m->service_us_max[req->prio] = service;
+
+    if (req->state == SFP_SCHED_DONE)
+        m->completed[req->prio]++;
+    else
+        m->errors[req->prio]++;
+
+    if (req->deadline_us && req->end_us > req->deadline_us)
+        m->deadline_misses[req->prio]++;
+
+    if (req->cb)
+        req->cb(req, req->state == SFP_SCHED_DONE, req->user);
+}
+
+/* Inicia a requisição; leituras assíncronas ficam ativas na faixa */
+static void sched_dispatch(sfp_sched_t *s, sfp_sched_req_t *req)
+{
+    sfp_sched_metrics_t *m = &s->metrics;
+
+    req->start_us = sched_now(req);
+    req->state    = SFP_SCHED_ACTIVE;
+
+    uint32_t wait = (uint32_t)(req->start_us - req->enqueue_us);
+    m->wait_us_total[req->prio] += wait;
+    if (wait > m->wait_us_max[req->prio])
+        m->wait_us_max[req->prio] = wait;
+
+    if (req->op == SFP_SCHED_OP_WRITE) {
+        bool ok = sfp_write_raw(req->t, req->dev_addr, req->src, req->length);
+        sched_finish(s, req, ok ? (int)req->length : SFP_XFER_ERR_IO);
+        return;
+    }
+
+    memset(&req->rd, 0, sizeof(req->rd));
+    if (!sfp_read_block_async_start(&req->rd, req->t, req->dev_addr, req->offset,
+                                    req->dst, (uint8_t)req->length, NULL, NULL)) {
+        sched_finish(s, req, SFP_XFER_ERR_IO);
+        return;
+    }
+
+    s->lane[sched_lane(s, req->t->ctx)].active = req;
+}
+
+/* Acompanha as leituras em andamento; true se alguma concluiu */
+static bool sched_poll_lanes(sfp_sched_t *s)
+{
+    bool progress = false;
+
+    for (int i = 0; i < SFP_SCHED_MAX_BUSES; i++) {
+        sfp_sched_req_t *req = s->lane[i].active;
+        if (!req)
+            continue;
+
+        sfp_async_state_t st = sfp_read_block_async_poll(&req->rd);
+        if (st == SFP_ASYNC_BUSY)
+            continue;
+
+        s->lane[i].active = NULL;
+        sched_finish(s, req, req->rd.result);
+        progress = true;
+    }
+    return progress;
+}
+
+/* ============================================
+ * API pública
+ * ============================================ */
+void sfp_sched_init(sfp_sched_t *s)
+{
+    if (!s)
+        return;
+
+    memset(s, 0, sizeof(*s));
+}
+
+bool sfp_sched_submit_read(sfp_sched_t *s, sfp_sched_req_t *req, const sfp_transport_t *t,
+                           uint8_t dev_addr, uint8_t offset, uint8_t *dst, size_t length,
+                           sfp_sched_prio_t prio, uint64_t deadline_us,
+                           sfp_sched_cb_t cb, void *user)
+{
+    if (!s || !req || !t || !t->ops || !dst || length == 0 || length > UINT8_MAX)
+        return false;
+
+    if (sfp_sched_pending(req) || prio >= SFP_SCHED_PRIO_COUNT)
+        return false;
+
+    req->t           = t;
+    req->op          = SFP_SCHED_OP_READ;
+    req->dev_addr    = dev_addr;
+    req->offset      = offset;
+    req->dst         = dst;
+    req->src         = NULL;
+    req->length      = length;
+    req->prio        = prio;
+    req->deadline_us = deadline_us;
+    req->cb          = cb;
+    req->user        = user;
+
+    return sched_enqueue(s, req);
+}
+
+bool sfp_sched_submit_write(sfp_sched_t *s, sfp_sched_req_t *req, const sfp_transport_t *t,
+                            uint8_t dev_addr, const uint8_t *src, size_t length,
+                            sfp_sched_prio_t prio, uint64_t deadline_us,
+                            sfp_sched_cb_t cb, void *user)
+{
+    if (!s || !req || !t || !t->ops || !src || length == 0)
+        return false;
+
+    if (sfp_sched_pending(req) || prio >= SFP_SCHED_PRIO_COUNT)
+        return false;
+
+    req->t           = t;
+    req->op          = SFP_SCHED_OP_WRITE;
+    req->dev_addr    = dev_addr;
+    req->offset      = 0;
+    req->dst         = NULL;
+    req->src         = src;
+    req->length      = length;
+    req->prio        = prio;
+    req->deadline_us = deadline_us;
+    req->cb          = cb;
+    req->user        = user;
+
+    return sched_enqueue(s, req);
+}
+
+void sfp_sched_run(sfp_sched_t *s, uint32_t budget_us)
+{
+    if (!s)
+        return;
+
+    const sfp_transport_t *clock = NULL;
+    uint64_t start = 0;
+
+    for (;;) {
+        bool progress = sched_poll_lanes(s);
+
+        /* Reavalia a fila a cada transação: uma requisição crítica enfileirada
+           por um callback passa à frente das páginas restantes */
+        sfp_sched_req_t *req = sched_pick(s);
+        if (req) {
+            if (!clock) {
+                clock = req->t;
+                start = sfp_transport_now_us(clock);
+            }
+            sched_dispatch(s, req);
+            progress = true;
+        }
+
+        if (!progress)
+            break;
+
+        if (clock && sfp_transport_now_us(clock) - start >= budget_us)
+            break;
+    }
+}
+
+bool sfp_sched_pending(const sfp_sched_req_t *req)
+{
+    return req && (req->state == SFP_SCHED_QUEUED || req->state == SFP_SCHED_ACTIVE);
+}
+
+const sfp_sched_metrics_t *sfp_sched_get_metrics(const sfp_sched_t *s)
+{
+    return s ? &s->metrics : NULL;
+}
+
+void sfp_sched_reset_metrics(sfp_sched_t *s)
+{
+    if (!s)
+        return;
+
+    uint16_t depth = s->metrics.depth;
+    memset(&s->metrics, 0, sizeof(s->metrics));
+    s->metrics.depth = depth;
+}
+
+void sfp_sched_report(const sfp_sched_t *s)
+{
+    static const char *const names[SFP_SCHED_PRIO_COUNT] = {
+        "CRITICAL", "HIGH", "NORMAL", "BULK"
+    };
+
+    if (!s)
+        return;
+
+    const sfp_sched_metrics_t *m = &s->metrics;
+
+    printf("fila %u (max %u)\n", (unsigned)m->depth, (unsigned)m->depth_max);
+    printf("prio         sub    ok   err  miss  wait avg/max  svc avg/max (us)\n");
+
+    for (int p = 0; p < SFP_SCHED_PRIO_COUNT; p++) {
+        uint32_t started = m->completed[p] + m->errors[p];
+        if (m->submitted[p] == 0)
+            continue;
+
+        printf("%-8s %7lu %5lu %5lu %5lu %6lu/%-6lu %6lu/%-6lu\n",
+               names[p],
+               (unsigned long)m->submitted[p],
+               (unsigned long)m->completed[p],
+               (unsigned long)m->errors[p],
+               (unsigned long)m->deadline_misses[p],
+               (unsigned long)(started ? m->wait_us_total[p] / started : 0),
+               (unsigned long)m->wait_us_max[p],
+               (unsigned long)(started ? m->service_us_total[p] / started : 0),
+               (unsigned long)m->service_us_max[p]);
+    }
+}
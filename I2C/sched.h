@@ -0,0 +1,145 @@
+/**
+ * @file sched.h
+ * @brief Escalonador de transações I2C com prioridade e deadline
+ *
+ * @details
+ *  Centraliza as transações dos dois barramentos (SFP em i2c0, OLED em
+ *  i2c1) num único laço cooperativo. Cada requisição tem prioridade e
+ *  deadline; a cada despacho é escolhida a requisição pronta de maior
+ *  prioridade (menor valor), desempatando pelo deadline mais próximo e,
+ *  por fim, pela ordem de chegada.
+ *
+ *  A granularidade de preempção é a transação: um frame do OLED é
+ *  enviado como uma transação por página, então uma leitura crítica de
+ *  status do A2h (bytes 110-117) passa à frente das páginas que ainda
+ *  estão na fila.
+ *
+ *  Leituras usam o caminho assíncrono do transporte (ISR do I2C no RP2040) e
+ *  ocupam a "faixa" do barramento até concluírem; escritas são
+ *  bloqueantes. Barramentos diferentes avançam em paralelo.
+ *
+ *  As requisições pertencem ao chamador (sem alocação dinâmica) e não
+ *  podem ser reutilizadas enquanto sfp_sched_pending() for true.
+ */
+
+#ifndef SCHED_H
+#define SCHED_H
+
+#include "transport.h"
+#include "async.h"
+
+/** @brief Quantidade máxima de barramentos (faixas) distintos */
+#define SFP_SCHED_MAX_BUSES 2
+
+typedef enum {
+    SFP_SCHED_PRIO_CRITICAL = 0,  /* Alarmes/status do A2h */
+    SFP_SCHED_PRIO_HIGH,          /* Leituras interativas */
+    SFP_SCHED_PRIO_NORMAL,        /* Amostragem periódica de DMI */
+    SFP_SCHED_PRIO_BULK,          /* Páginas do framebuffer */
+    SFP_SCHED_PRIO_COUNT
+} sfp_sched_prio_t;
+
+typedef enum {
+    SFP_SCHED_IDLE = 0,
+    SFP_SCHED_QUEUED,
+    SFP_SCHED_ACTIVE,
+    SFP_SCHED_DONE,
+    SFP_SCHED_ERROR
+} sfp_sched_state_t;
+
+typedef enum {
+    SFP_SCHED_OP_READ = 0,   /* offset + leitura sequencial */
+    SFP_SCHED_OP_WRITE       /* escrita crua (sem offset) */
+} sfp_sched_op_t;
+
+struct sfp_sched_req;
+typedef void (*sfp_sched_cb_t)(struct sfp_sched_req *req, bool ok, void *user);
+
+typedef struct sfp_sched_req {
+    const sfp_transport_t *t;
+    sfp_sched_op_t op;
+    uint8_t  dev_addr;
+    uint8_t  offset;
+    uint8_t *dst;
+    const uint8_t *src;
+    size_t   length;
+
+    sfp_sched_prio_t prio;
+    uint64_t deadline_us;     /* absoluto; 0 = sem deadline */
+
+    sfp_sched_state_t state;
+    int      result;
+    uint32_t seq;
+    uint64_t enqueue_us;
+    uint64_t start_us;
+    uint64_t end_us;
+
+    sfp_async_read_t rd;      /* leitura em andamento */
+
+    sfp_sched_cb_t cb;
+    void *user;
+
+    struct sfp_sched_req *next;
+} sfp_sched_req_t;
+
+typedef struct {
+    uint32_t submitted[SFP_SCHED_PRIO_COUNT];
+    uint32_t completed[SFP_SCHED_PRIO_COUNT];
+    uint32_t errors[SFP_SCHED_PRIO_COUNT];
+    uint32_t deadline_misses[SFP_SCHED_PRIO_COUNT];
+
+    /* Espera na fila (enfileiramento -> início) */
+    uint64_t wait_us_total[SFP_SCHED_PRIO_COUNT];
+    uint32_t wait_us_max[SFP_SCHED_PRIO_COUNT];
+
+    /* Tempo de barramento (início -> fim) */
+    uint64_t service_us_total[SFP_SCHED_PRIO_COUNT];
+    uint32_t service_us_max[SFP_SCHED_PRIO_COUNT];
+
+    /* Profundidade da fila */
+    uint16_t depth;
+    uint16_t depth_max;
+} sfp_sched_metrics_t;
+
+typedef struct {
+    sfp_sched_req_t *queue;   /* lista não ordenada; seleção por varredura */
+    uint32_t seq;
+
+    struct {
+        void *ctx;            /* identifica o barramento */
+        sfp_sched_req_t *active;
+    } lane[SFP_SCHED_MAX_BUSES];
+
+    sfp_sched_metrics_t metrics;
+} sfp_sched_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+void sfp_sched_init(sfp_sched_t *s);
+
+/* Enfileira uma leitura (offset + length bytes) */
+bool sfp_sched_submit_read(sfp_sched_t *s, sfp_sched_req_t *req, const sfp_transport_t *t,
+                           uint8_t dev_addr, uint8_t offset, uint8_t *dst, size_t length,
+                           sfp_sched_prio_t prio, uint64_t deadline_us,
+                           sfp_sched_cb_t cb, void *user);
+
+/* Enfileira uma escrita crua; src deve permanecer válido até a conclusão */
+bool sfp_sched_submit_write(sfp_sched_t *s, sfp_sched_req_t *req, const sfp_transport_t *t,
+                            uint8_t dev_addr, const uint8_t *src, size_t length,
+                            sfp_sched_prio_t prio, uint64_t deadline_us,
+                            sfp_sched_cb_t cb, void *user);
+
+/* Despacha/acompanha transações até esvaziar a fila ou esgotar budget_us */
+void sfp_sched_run(sfp_sched_t *s, uint32_t budget_us);
+
+bool sfp_sched_pending(const sfp_sched_req_t *req);
+
+const sfp_sched_metrics_t *sfp_sched_get_metrics(const sfp_sched_t *s);
+void sfp_sched_reset_metrics(sfp_sched_t *s);
+
+/* Profundidade da fila + contadores e latências por prioridade (stdout) */
+void sfp_sched_report(const sfp_sched_t *s);
+
+#endif /* SCHED_H */
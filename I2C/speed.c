@@ -0,0 +1,155 @@
+#include "speed.h"
+#include "sfp_8472/defs.h"
+#include "sfp_8472/checksum.h"
+#include <string.h>
+
+/* Degraus de velocidade: Standard-mode, Fast-mode, Fast-mode Plus */
+static const uint32_t speed_ladder[] = { 100000u, 400000u, 1000000u };
+#define SPEED_LADDER_LEN   (sizeof(speed_ladder) / sizeof(speed_ladder[0]))
+
+/* Leituras confirmadas em cada degrau antes de aceitá-lo */
+#define SPEED_VERIFY_READS 2
+
+/* Bloco base do A0h usado na verificação (bytes 0-63) */
+#define SPEED_VERIFY_LEN   (A0_CC_BASE + 1)
+
+/* ============================================
+ * Tabela de perfis
+ * ============================================ */
+void sfp_speed_init(sfp_speed_profile_t *p, uint32_t current_baud)
+{
+    if (!p)
+        return;
+
+    memset(p, 0, sizeof(*p));
+    p->current_baud = current_baud;
+}
+
+static sfp_speed_entry_t *speed_find(const sfp_speed_profile_t *p, uint8_t addr)
+{
+    for (uint8_t i = 0; i < p->count; i++) {
+        if (p->dev[i].addr == addr)
+            return (sfp_speed_entry_t *)&p->dev[i];
+    }
+    return NULL;
+}
+
+bool sfp_speed_set(sfp_speed_profile_t *p, uint8_t addr, uint32_t baud)
+{
+    if (!p || baud == 0)
+        return false;
+
+    sfp_speed_entry_t *e = speed_find(p, addr);
+    if (!e) {
+        if (p->count >= SFP_SPEED_MAX_DEVICES)
+            return false;
+        e = &p->dev[p->count++];
+        e->addr = addr;
+    }
+
+    e->baud = baud;
+    return true;
+}
+
+uint32_t sfp_speed_get(const sfp_speed_profile_t *p, uint8_t addr)
+{
+    if (!p)
+        return SFP_SPEED_DEFAULT_HZ;
+
+    const sfp_speed_entry_t *e = speed_find(p, addr);
+    return e ? e->baud : SFP_SPEED_DEFAULT_HZ;
+}
+
+/* ============================================
+ * Aplicação do perfil
+ * ============================================ */
+bool sfp_speed_apply(const sfp_transport_t *t, uint8_t addr)
+{
+    if (!t || !t->speed)
+        return true;
+
+    sfp_speed_profile_t *p = t->speed;
+    uint32_t baud = sfp_speed_get(p, addr);
+
+    if (baud == p->current_baud)
+        return true;
+
+    /* Backend sem controle de clock: segue na frequência atual */
+    if (!t->ops->set_baudrate)
+        return true;
+
+    if (t->ops->set_baudrate(t->ctx, baud) == 0)
+        return false;
+
+    p->current_baud = baud;
+    return true;
+}
+
+/* ============================================
+ * Negociação
+ * ============================================ */
+static bool speed_cc_base_ok(const uint8_t *a0)
+{
+    return sfp_checksum_range_ok(SFP_CHK_BASE, a0);
+}
+
+uint32_t sfp_speed_negotiate_eeprom(const sfp_transport_t *t, uint8_t addr)
+{
+    if (!t || !t->speed)
+        return 0;
+
+    uint8_t ref[SPEED_VERIFY_LEN];
+    uint8_t buf[SPEED_VERIFY_LEN];
+
+    /* Referência no degrau mais lento */
+    sfp_speed_set(t->speed, addr, speed_ladder[0]);
+    if (!sfp_read_block(t, addr, 0, ref, sizeof(ref)))
+        return 0;
+
+    uint32_t best = speed_ladder[0];
+
+    /* CC_BASE inválido já em 100 kHz: não há como validar degraus mais rápidos */
+    if (!speed_cc_base_ok(ref)) {
+        sfp_speed_set(t->speed, addr, best);
+        sfp_speed_apply(t, addr);
+        return best;
+    }
+
+    for (size_t s = 1; s < SPEED_LADDER_LEN; s++) {
+        bool ok = true;
+
+        sfp_speed_set(t->speed, addr, speed_ladder[s]);
+        for (int r = 0; r < SPEED_VERIFY_READS && ok; r++) {
+            ok = sfp_read_block(t, addr, 0, buf, sizeof(buf)) &&
+                 speed_cc_base_ok(buf) &&
+                 memcmp(buf, ref, sizeof(buf)) == 0;
+        }
+
+        if (!ok)
+            break;
+        best = speed_ladder[s];
+    }
+
+    sfp_speed_set(t->speed, addr, best);
+    sfp_speed_apply(t, addr);
+    return best;
+}
+
+uint32_t sfp_speed_negotiate_probe(const sfp_transport_t *t, uint8_t addr, uint32_t max_hz)
+{
+    if (!t || !t->speed)
+        return 0;
+
+    uint32_t best = 0;
+
+    for (size_t s = 0; s < SPEED_LADDER_LEN && speed_ladder[s] <= max_hz; s++) {
+        sfp_speed_set(t->speed, addr, speed_ladder[s]);
+        if (!sfp_probe(t, addr))
+            break;
+        best = speed_ladder[s];
+    }
+
+    sfp_speed_set(t->speed, addr, best ? best : SFP_SPEED_DEFAULT_HZ);
+    sfp_speed_apply(t, addr);
+    return best;
+}
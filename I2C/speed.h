@@ -0,0 +1,63 @@
+/**
+ * @file speed.h
+ * @brief Negociação automática da velocidade do barramento por dispositivo
+ *
+ * @details
+ *  Sobe a frequência do barramento em degraus (100 kHz -> 400 kHz -> 1 MHz)
+ *  enquanto as leituras continuarem íntegras. Para EEPROMs SFP a
+ *  verificação usa o bloco base do A0h (bytes 0-63): a leitura em cada
+ *  degrau precisa fechar o CC_BASE e ser idêntica à leitura de referência
+ *  em 100 kHz. Se a referência já falhar no checksum o dispositivo fica em
+ *  100 kHz. Em caso de erro o degrau anterior é mantido. Dispositivos sem conteúdo
+ *  verificável (ex.: o OLED) são negociados apenas por ACK, limitados à
+ *  frequência máxima do datasheet.
+ *
+ *  O resultado fica num perfil por endereço e é reaplicado pelo
+ *  transporte antes de cada transação (sfp_speed_apply), trocando o
+ *  clock apenas quando o dispositivo alvo muda de velocidade.
+ */
+
+#ifndef SPEED_H
+#define SPEED_H
+
+#include "transport.h"
+
+/** @brief Velocidade padrão (Standard-mode) */
+#define SFP_SPEED_DEFAULT_HZ   100000u
+
+/** @brief Quantidade máxima de dispositivos com perfil próprio */
+#define SFP_SPEED_MAX_DEVICES  8
+
+typedef struct {
+    uint8_t  addr;
+    uint32_t baud;
+} sfp_speed_entry_t;
+
+struct sfp_speed_profile {
+    sfp_speed_entry_t dev[SFP_SPEED_MAX_DEVICES];
+    uint8_t  count;
+    uint32_t current_baud;   /* clock atualmente programado no barramento */
+};
+typedef struct sfp_speed_profile sfp_speed_profile_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* Inicializa o perfil; current_baud = clock já programado no barramento */
+void sfp_speed_init(sfp_speed_profile_t *p, uint32_t current_baud);
+
+/* Define/consulta a velocidade de um endereço */
+bool sfp_speed_set(sfp_speed_profile_t *p, uint8_t addr, uint32_t baud);
+uint32_t sfp_speed_get(const sfp_speed_profile_t *p, uint8_t addr);
+
+/* Negocia a maior velocidade íntegra para uma EEPROM SFP (verificação por CC_BASE) */
+uint32_t sfp_speed_negotiate_eeprom(const sfp_transport_t *t, uint8_t addr);
+
+/* Negocia a maior velocidade com ACK (até max_hz) para dispositivos sem leitura verificável */
+uint32_t sfp_speed_negotiate_probe(const sfp_transport_t *t, uint8_t addr, uint32_t max_hz);
+
+/* Programa o clock do perfil de addr no barramento (se necessário) */
+bool sfp_speed_apply(const sfp_transport_t *t, uint8_t addr);
+
+#endif /* SPEED_H */
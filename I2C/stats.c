@@ -0,0 +1,161 @@
+#include "stats.h"
+#include <stdio.h>
+#include <string.h>
+
+/* ============================================
+ * Buckets
+ * ============================================ */
+uint8_t sfp_stats_bucket(uint32_t dur_us)
+{
+    uint8_t b = 0;
+
+    while (dur_us && b < SFP_STATS_BUCKETS - 1) {
+        dur_us >>= 1;
+        b++;
+    }
+    return b;
+}
+
+uint32_t sfp_stats_bucket_limit(uint8_t bucket)
+{
+    if (bucket == 0)
+        return 0;
+    if (bucket >= SFP_STATS_BUCKETS - 1)
+        return UINT32_MAX;
+
+    return (1u << bucket) - 1u;
+}
+
+/* ============================================
+ * Registro
+ * ============================================ */
+void sfp_stats_init(sfp_stats_t *s)
+{
+    if (s)
+        memset(s, 0, sizeof(*s));
+}
+
+static sfp_latency_hist_t *stats_slot(sfp_stats_t *s, uint8_t addr)
+{
+    for (uint8_t i = 0; i < s->count; i++) {
+        if (s->dev[i].addr == addr)
+            return &s->dev[i];
+    }
+
+    if (s->count >= SFP_STATS_MAX_DEVICES)
+        return NULL;
+
+    sfp_latency_hist_t *h = &s->dev[s->count++];
+    memset(h, 0, sizeof(*h));
+    h->addr   = addr;
+    h->min_us = UINT32_MAX;
+    return h;
+}
+
+void sfp_stats_record(sfp_stats_t *s, uint8_t addr, uint32_t dur_us, bool ok)
+{
+    if (!s)
+        return;
+
+    sfp_latency_hist_t *h = stats_slot(s, addr);
+    if (!h)
+        return;
+
+    h->count++;
+    h->total_us += dur_us;
+    if (!ok)
+        h->errors++;
+    if (dur_us < h->min_us)
+        h->min_us = dur_us;
+    if (dur_us > h->max_us)
+        h->max_us = dur_us;
+    h->bucket[sfp_stats_bucket(dur_us)]++;
+}
+
+void sfp_stats_xfer(const sfp_transport_t *t, uint8_t addr, int result, uint64_t start_us)
+{
+    if (!t || !t->stats)
+        return;
+
+    uint64_t end = sfp_transport_now_us(t);
+    uint32_t dur = (end > start_us) ? (uint32_t)(end - start_us) : 0;
+
+    sfp_stats_record(t->stats, addr, dur, result >= 0);
+}
+
+const sfp_latency_hist_t *sfp_stats_get(const sfp_stats_t *s, uint8_t addr)
+{
+    if (!s)
+        return NULL;
+
+    for (uint8_t i = 0; i < s->count; i++) {
+        if (s->dev[i].addr == addr)
+            return &s->dev[i];
+    }
+    return NULL;
+}
+
+/* ============================================
+ * Consulta
+ * ============================================ */
+uint32_t sfp_stats_percentile(const sfp_latency_hist_t *h, uint8_t pct)
+{
+    if (!h || h->count == 0)
+        return 0;
+
+    if (pct > 100)
+        pct = 100;
+
+    /* Posição (arredondada para cima) da amostra no ranking */
+    uint64_t rank = ((uint64_t)h->count * pct + 99) / 100;
+    if (rank == 0)
+        rank = 1;
+
+    uint64_t seen = 0;
+    for (uint8_t b = 0; b < SFP_STATS_BUCKETS; b++) {
+        seen += h->bucket[b];
+        if (seen >= rank) {
+            uint32_t limit = sfp_stats_bucket_limit(b);
+            return (limit > h->max_us) ? h->max_us : limit;
+        }
+    }
+    return h->max_us;
+}
+
+void sfp_stats_report(const sfp_stats_t *s)
+{
+    if (!s)
+        return;
+
+    printf("addr      n   err   min   avg   p50   p90   p99   max (us)\n");
+
+    for (uint8_t i = 0; i < s->count; i++) {
+        const sfp_latency_hist_t *h = &s->dev[i];
+        if (h->count == 0)
+            continue;
+
+        printf("0x%02X %6lu %5lu %5lu %5lu %5lu %5lu %5lu %5lu\n",
+               h->addr,
+               (unsigned long)h->count,
+               (unsigned long)h->errors,
+               (unsigned long)h->min_us,
+               (unsigned long)(h->total_us / h->count),
+               (unsigned long)sfp_stats_percentile(h, 50),
+               (unsigned long)sfp_stats_percentile(h, 90),
+               (unsigned long)sfp_stats_percentile(h, 99),
+               (unsigned long)h->max_us);
+
+        /* Buckets não vazios: "<limite superior>:<contagem>" */
+        printf("    ");
+        for (uint8_t b = 0; b < SFP_STATS_BUCKETS; b++) {
+            if (!h->bucket[b])
+                continue;
+            if (b == SFP_STATS_BUCKETS - 1)
+                printf(" >=%lu:%lu", (unsigned long)(1u << (b - 1)), (unsigned long)h->bucket[b]);
+            else
+                printf(" <%lu:%lu", (unsigned long)sfp_stats_bucket_limit(b) + 1,
+                       (unsigned long)h->bucket[b]);
+        }
+        printf("\n");
+    }
+}
@@ -0,0 +1,69 @@
+/**
+ * @file stats.h
+ * @brief Histogramas de latência das transações I2C por endereço
+ *
+ * @details
+ *  Cada transação medida (sfp_read_block, sfp_write_raw, sfp_probe,
+ *  leitura assíncrona e escritas do SSD1306) soma sua duração, medida
+ *  pelo relógio do backend (time_us_64() no RP2040), no histograma do
+ *  endereço do dispositivo.
+ *
+ *  Os buckets são potências de 2: o bucket k conta durações em
+ *  [2^(k-1), 2^k) us e o bucket 0 conta durações de 0 us. Com 24
+ *  buckets a faixa vai até ~8 s. Os percentis saem do histograma e são
+ *  o limite superior do bucket (limitado ao máximo observado), então têm
+ *  erro de no máximo 2x — suficiente para ver regressões de barramento.
+ *
+ *  O registro custa um laço de até 24 iterações e alguns incrementos;
+ *  não há alocação nem ponto flutuante.
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include "transport.h"
+
+#define SFP_STATS_BUCKETS      24
+#define SFP_STATS_MAX_DEVICES  8
+
+typedef struct {
+    uint8_t  addr;
+    uint32_t count;
+    uint32_t errors;
+    uint64_t total_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t bucket[SFP_STATS_BUCKETS];
+} sfp_latency_hist_t;
+
+typedef struct sfp_stats {
+    sfp_latency_hist_t dev[SFP_STATS_MAX_DEVICES];
+    uint8_t count;
+} sfp_stats_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+void sfp_stats_init(sfp_stats_t *s);
+
+/* Soma uma transação ao histograma do endereço */
+void sfp_stats_record(sfp_stats_t *s, uint8_t addr, uint32_t dur_us, bool ok);
+
+/* Atalho usado pelas camadas de transporte (no-op se t->stats == NULL) */
+void sfp_stats_xfer(const sfp_transport_t *t, uint8_t addr, int result, uint64_t start_us);
+
+/* Histograma do endereço ou NULL */
+const sfp_latency_hist_t *sfp_stats_get(const sfp_stats_t *s, uint8_t addr);
+
+/* Bucket de uma duração e limite superior (us) de um bucket */
+uint8_t  sfp_stats_bucket(uint32_t dur_us);
+uint32_t sfp_stats_bucket_limit(uint8_t bucket);
+
+/* Percentil (0-100) estimado pelo histograma, em us */
+uint32_t sfp_stats_percentile(const sfp_latency_hist_t *h, uint8_t pct);
+
+/* Tabela por endereço + buckets não vazios (stdout) */
+void sfp_stats_report(const sfp_stats_t *s);
+
+#endif /* STATS_H */
@@ -0,0 +1,201 @@
+#include "trace.h"
+#include <string.h>
+
+/* ============================================
+ * Auxiliares
+ * ============================================ */
+static void put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    put_u16(p, (uint16_t)v);
+    put_u16(p + 2, (uint16_t)(v >> 16));
+}
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)get_u16(p) | ((uint32_t)get_u16(p + 2) << 16);
+}
+
+uint32_t sfp_trace_hash(const uint8_t *data, size_t len)
+{
+    uint32_t h = 2166136261u;
+
+    for (size_t i = 0; data && i < len; i++) {
+        h ^= data[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Conteúdo do registro ainda disponível em data[] (não sobrescrito) */
+static bool trace_payload_valid(const sfp_trace_t *tr, const sfp_trace_rec_t *r)
+{
+    return tr->payload && r->len > 0 && r->len <= SFP_TRACE_DATA_BYTES && r->result > 0 &&
+           tr->data_head - r->data_pos <= SFP_TRACE_DATA_BYTES;
+}
+
+/* ============================================
+ * Gravação
+ * ============================================ */
+void sfp_trace_init(sfp_trace_t *tr, bool payload)
+{
+    if (!tr)
+        return;
+
+    memset(tr, 0, sizeof(*tr));
+    tr->enabled = true;
+    tr->payload = payload;
+}
+
+void sfp_trace_clear(sfp_trace_t *tr)
+{
+    if (!tr)
+        return;
+
+    tr->head      = 0;
+    tr->data_head = 0;
+}
+
+void sfp_trace_record(sfp_trace_t *tr, sfp_trace_kind_t kind, uint8_t addr, uint8_t offset,
+                      const uint8_t *data, size_t len, int result,
+                      uint64_t start_us, uint64_t end_us)
+{
+    if (!tr || !tr->enabled)
+        return;
+
+    sfp_trace_rec_t *r = &tr->rec[tr->head % SFP_TRACE_RECORDS];
+    bool has_data = data && len > 0 && result > 0;
+
+    r->seq      = tr->head++;
+    r->start_us = (uint32_t)start_us;
+    r->dur_us   = (end_us > start_us) ? (uint32_t)(end_us - start_us) : 0;
+    r->hash     = has_data ? sfp_trace_hash(data, len) : 0;
+    r->kind     = (uint8_t)kind;
+    r->addr     = addr;
+    r->offset   = offset;
+    r->len      = (uint16_t)len;
+    r->result   = (int16_t)result;
+    r->data_pos = tr->data_head;
+
+    /* Conteúdo maior que o buffer inteiro fica só com o hash */
+    if (!tr->payload || !has_data || len > SFP_TRACE_DATA_BYTES)
+        return;
+
+    for (size_t i = 0; i < len; i++)
+        tr->data[(tr->data_head + i) % SFP_TRACE_DATA_BYTES] = data[i];
+    tr->data_head += (uint32_t)len;
+}
+
+void sfp_trace_xfer(const sfp_transport_t *t, sfp_trace_kind_t kind, uint8_t addr, uint8_t offset,
+                    const uint8_t *data, size_t len, int result, uint64_t start_us)
+{
+    if (!t || !t->trace)
+        return;
+
+    sfp_trace_record(t->trace, kind, addr, offset, data, len, result,
+                     start_us, sfp_transport_now_us(t));
+}
+
+uint32_t sfp_trace_count(const sfp_trace_t *tr)
+{
+    if (!tr)
+        return 0;
+
+    return (tr->head < SFP_TRACE_RECORDS) ? tr->head : SFP_TRACE_RECORDS;
+}
+
+/* ============================================
+ * Dump
+ * ============================================ */
+uint32_t sfp_trace_dump(const sfp_trace_t *tr, sfp_trace_sink_t sink, void *user)
+{
+    if (!tr || !sink)
+        return 0;
+
+    uint32_t count = sfp_trace_count(tr);
+    uint8_t hdr[SFP_TRACE_HDR_SIZE] = { 'S', 'F', 'P', 'T', SFP_TRACE_VERSION };
+
+    put_u32(&hdr[8], count);
+    sink(user, hdr, sizeof(hdr));
+
+    for (uint32_t i = tr->head - count; i != tr->head; i++) {
+        const sfp_trace_rec_t *r = &tr->rec[i % SFP_TRACE_RECORDS];
+        uint16_t stored = trace_payload_valid(tr, r) ? r->len : 0;
+        uint8_t out[SFP_TRACE_REC_SIZE];
+
+        put_u32(&out[0],  r->seq);
+        put_u32(&out[4],  r->start_us);
+        put_u32(&out[8],  r->dur_us);
+        put_u32(&out[12], r->hash);
+        out[16] = r->kind;
+        out[17] = r->addr;
+        out[18] = r->offset;
+        out[19] = 0;
+        put_u16(&out[20], r->len);
+        put_u16(&out[22], (uint16_t)r->result);
+        put_u16(&out[24], stored);
+        sink(user, out, sizeof(out));
+
+        /* Conteúdo pode dar a volta no fim de data[]: até dois trechos */
+        uint32_t pos   = r->data_pos % SFP_TRACE_DATA_BYTES;
+        uint32_t first = SFP_TRACE_DATA_BYTES - pos;
+        if (first > stored)
+            first = stored;
+        if (first)
+            sink(user, &tr->data[pos], first);
+        if (stored > first)
+            sink(user, tr->data, stored - first);
+    }
+    return count;
+}
+
+/* ============================================
+ * Decodificação (host)
+ * ============================================ */
+int32_t sfp_trace_decode_header(const uint8_t *buf, size_t len)
+{
+    if (!buf || len < SFP_TRACE_HDR_SIZE || memcmp(buf, SFP_TRACE_MAGIC, 4) != 0 ||
+        buf[4] != SFP_TRACE_VERSION)
+        return -1;
+
+    return (int32_t)get_u32(&buf[8]);
+}
+
+size_t sfp_trace_decode(const uint8_t *buf, size_t len, sfp_trace_rec_t *rec,
+                        const uint8_t **payload, uint16_t *payload_len)
+{
+    if (!buf || !rec || len < SFP_TRACE_REC_SIZE)
+        return 0;
+
+    uint16_t stored = get_u16(&buf[24]);
+    if (len < (size_t)SFP_TRACE_REC_SIZE + stored)
+        return 0;
+
+    rec->seq      = get_u32(&buf[0]);
+    rec->start_us = get_u32(&buf[4]);
+    rec->dur_us   = get_u32(&buf[8]);
+    rec->hash     = get_u32(&buf[12]);
+    rec->kind     = buf[16];
+    rec->addr     = buf[17];
+    rec->offset   = buf[18];
+    rec->len      = get_u16(&buf[20]);
+    rec->result   = (int16_t)get_u16(&buf[22]);
+    rec->data_pos = 0;
+
+    if (payload)
+        *payload = stored ? &buf[SFP_TRACE_REC_SIZE] : NULL;
+    if (payload_len)
+        *payload_len = stored;
+
+    return (size_t)SFP_TRACE_REC_SIZE + stored;
+}
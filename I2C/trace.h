@@ -0,0 +1,108 @@
+/**
+ * @file trace.h
+ * @brief Registro binário das transações I2C em buffer circular
+ *
+ * @details
+ *  Cada transação feita por sfp_read_block(), sfp_write_raw(), sfp_probe(),
+ *  pela leitura assíncrona e pelo caminho de escrita do SSD1306 gera um
+ *  registro de tamanho fixo: instante de início, duração, endereço, offset,
+ *  tamanho, resultado e hash FNV-1a do conteúdo transferido.
+ *
+ *  Os bytes transferidos vão para um segundo buffer circular (data[]).
+ *  Quando ele dá a volta, os registros antigos perdem o conteúdo mas
+ *  mantêm o hash. Os registros também são sobrescritos do mais antigo
+ *  para o mais novo; 'seq' é contínuo, então lacunas aparecem no dump.
+ *
+ *  sfp_trace_dump() serializa o buffer em formato little-endian
+ *  independente do compilador. O mesmo formato é lido no host por
+ *  sfp_trace_decode() (tools/trace_replay.c).
+ *
+ *  Formato:
+ *      cabeçalho : "SFPT" | versão (1) | 3 bytes reservados | registros (u32)
+ *      registro  : seq u32 | start_us u32 | dur_us u32 | hash u32 |
+ *                  kind u8 | addr u8 | offset u8 | reservado u8 |
+ *                  len u16 | result i16 | bytes guardados u16 | bytes...
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "transport.h"
+
+/** @brief Capacidade do buffer (registros e bytes de conteúdo) */
+#ifndef SFP_TRACE_RECORDS
+#define SFP_TRACE_RECORDS     128
+#endif
+#ifndef SFP_TRACE_DATA_BYTES
+#define SFP_TRACE_DATA_BYTES  4096   /* potência de 2 (índice contínuo módulo N) */
+#endif
+
+#define SFP_TRACE_MAGIC       "SFPT"
+#define SFP_TRACE_VERSION     1
+#define SFP_TRACE_HDR_SIZE    12   /* cabeçalho do dump */
+#define SFP_TRACE_REC_SIZE    26   /* registro serializado, sem o conteúdo */
+
+typedef enum {
+    SFP_TRACE_READ = 0,   /* offset + leitura sequencial */
+    SFP_TRACE_WRITE,      /* escrita crua (offset = primeiro byte) */
+    SFP_TRACE_PROBE       /* endereço sem dados (ACK/NAK) */
+} sfp_trace_kind_t;
+
+typedef struct {
+    uint32_t seq;
+    uint32_t start_us;     /* 32 bits inferiores do relógio do backend */
+    uint32_t dur_us;
+    uint32_t hash;         /* FNV-1a dos bytes transferidos */
+    uint32_t data_pos;     /* posição (contínua) do conteúdo em data[] */
+    uint8_t  kind;
+    uint8_t  addr;
+    uint8_t  offset;
+    uint16_t len;
+    int16_t  result;       /* bytes transferidos ou SFP_XFER_ERR_* */
+} sfp_trace_rec_t;
+
+typedef struct sfp_trace {
+    sfp_trace_rec_t rec[SFP_TRACE_RECORDS];
+    uint8_t  data[SFP_TRACE_DATA_BYTES];
+    uint32_t head;         /* registros já gravados (total) */
+    uint32_t data_head;    /* bytes de conteúdo já gravados (total) */
+    bool     enabled;
+    bool     payload;      /* false = só hash (mais registros por byte de RAM) */
+} sfp_trace_t;
+
+/* Destino do dump (ex.: USB stdio) */
+typedef void (*sfp_trace_sink_t)(void *user, const uint8_t *data, size_t len);
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+void sfp_trace_init(sfp_trace_t *tr, bool payload);
+void sfp_trace_clear(sfp_trace_t *tr);
+
+/* Hash FNV-1a 32 bits */
+uint32_t sfp_trace_hash(const uint8_t *data, size_t len);
+
+/* Grava uma transação (data pode ser NULL para probe/falha) */
+void sfp_trace_record(sfp_trace_t *tr, sfp_trace_kind_t kind, uint8_t addr, uint8_t offset,
+                      const uint8_t *data, size_t len, int result,
+                      uint64_t start_us, uint64_t end_us);
+
+/* Atalho usado pelas camadas de transporte (no-op se t->trace == NULL) */
+void sfp_trace_xfer(const sfp_transport_t *t, sfp_trace_kind_t kind, uint8_t addr, uint8_t offset,
+                    const uint8_t *data, size_t len, int result, uint64_t start_us);
+
+/* Registros ainda presentes no buffer */
+uint32_t sfp_trace_count(const sfp_trace_t *tr);
+
+/* Serializa cabeçalho + registros (do mais antigo ao mais novo); retorna a quantidade */
+uint32_t sfp_trace_dump(const sfp_trace_t *tr, sfp_trace_sink_t sink, void *user);
+
+/* Decodifica o cabeçalho do dump; retorna a quantidade de registros ou -1 */
+int32_t sfp_trace_decode_header(const uint8_t *buf, size_t len);
+
+/* Decodifica um registro serializado; retorna os bytes consumidos ou 0 */
+size_t sfp_trace_decode(const uint8_t *buf, size_t len, sfp_trace_rec_t *rec,
+                        const uint8_t **payload, uint16_t *payload_len);
+
+#endif /* TRACE_H */
@@ -0,0 +1,216 @@
+#include "transport.h"
+#include "speed.h"
+#include "retry.h"
+#include "trace.h"
+#include "stats.h"
+#include <string.h>
+
+/* ============================================
+ * Leitura sequencial de bloco (EEPROM)
+ * ============================================ */
+static int read_block_once(const sfp_transport_t *t, uint8_t dev_addr, uint8_t start_offset, uint8_t *buffer, uint8_t length)
+{
+    /* 0. Velocidade negociada para este dispositivo. Recusa = fila do
+          barramento ocupada, não falha: nada a recuperar */
+    if (!sfp_speed_apply(t, dev_addr))
+        return SFP_XFER_BUSY;
+
+    /* 1. Envia offset interno */
+    int ret = t->ops->write(
+        t->ctx,
+        dev_addr,
+        &start_offset,
+        1,
+        true               // repeated start
+    );
+
+    if (ret != 1)
+        return (ret < 0) ? ret : SFP_XFER_ERR_IO;
+
+    /* 2. Lê dados sequenciais (EEPROM)*/
+    ret = t->ops->read(
+        t->ctx,
+        dev_addr,
+        buffer,
+        length,
+        false
+    );
+
+    if (ret < 0)
+        return ret;
+    return (ret == length) ? ret : SFP_XFER_ERR_IO;
+}
+
+bool sfp_read_block(const sfp_transport_t *t, uint8_t dev_addr, uint8_t start_offset, uint8_t *buffer, uint8_t length)
+{
+    if (!t || !t->ops || !buffer || length == 0)
+        return false;
+
+    uint8_t attempts = sfp_retry_attempts(t);
+
+    for (uint8_t a = 0; a < attempts; a++) {
+        sfp_retry_backoff(t, a);
+
+        uint64_t start = sfp_transport_now_us(t);
+        int ret = read_block_once(t, dev_addr, start_offset, buffer, length);
+        sfp_trace_xfer(t, SFP_TRACE_READ, dev_addr, start_offset, buffer, length, ret, start);
+        sfp_stats_xfer(t, dev_addr, ret, start);
+        sfp_retry_record(t, dev_addr, ret, a > 0);
+        if (ret == length)
+            return true;
+    }
+    return false;
+}
+
+/* ============================================
+ * Escrita crua
+ * ============================================ */
+bool sfp_write_raw(const sfp_transport_t *t, uint8_t dev_addr, const uint8_t *src, size_t length)
+{
+    if (!t || !t->ops || !src || length == 0)
+        return false;
+
+    uint8_t attempts = sfp_retry_attempts(t);
+
+    for (uint8_t a = 0; a < attempts; a++) {
+        sfp_retry_backoff(t, a);
+
+        uint64_t start = sfp_transport_now_us(t);
+        int ret = sfp_speed_apply(t, dev_addr)
+                ? t->ops->write(t->ctx, dev_addr, src, length, false)
+                : SFP_XFER_BUSY;
+        if (ret >= 0 && ret != (int)length)
+            ret = SFP_XFER_ERR_IO;
+
+        sfp_trace_xfer(t, SFP_TRACE_WRITE, dev_addr, src[0], src, length, ret, start);
+        sfp_stats_xfer(t, dev_addr, ret, start);
+        sfp_retry_record(t, dev_addr, ret, a > 0);
+        if (ret == (int)length)
+            return true;
+    }
+    return false;
+}
+
+/* ============================================
+ * Escrita de bloco (EEPROM)
+ *
+ * A EEPROM só aceita escritas dentro de uma página de 8 bytes por vez;
+ * bytes além do limite dão a volta no início da mesma página. Após o
+ * STOP ela executa o ciclo interno de gravação e não responde (NAK) ao
+ * endereço. Em vez de esperar o pior caso (5-10 ms) por página, o
+ * dispositivo é sondado até voltar a dar ACK.
+ * ============================================ */
+static bool eeprom_ack_poll(const sfp_transport_t *t, uint8_t dev_addr)
+{
+    uint64_t start = sfp_transport_now_us(t);
+
+    /* Sem espera entre sondagens o barramento só carregaria NAKs de endereço */
+    uint32_t max = t->ops->sleep_us ? SFP_EEPROM_WRITE_TIMEOUT_US / SFP_EEPROM_ACK_POLL_US
+                                    : SFP_EEPROM_ACK_POLL_MAX;
+
+    /* Limite por tempo; backends sem relógio são limitados em tentativas */
+    for (uint32_t i = 0; start || i < max; i++) {
+        if (sfp_probe(t, dev_addr))
+            return true;
+
+        if (start && sfp_transport_now_us(t) - start > SFP_EEPROM_WRITE_TIMEOUT_US)
+            break;
+
+        if (t->ops->sleep_us)
+            t->ops->sleep_us(t->ctx, SFP_EEPROM_ACK_POLL_US);
+    }
+    return false;
+}
+
+static bool eeprom_verify(const sfp_transport_t *t, uint8_t dev_addr, uint8_t start_offset,
+                          const uint8_t *data, uint8_t length)
+{
+    uint8_t chunk[32];
+    uint8_t done = 0;
+
+    while (done < length) {
+        uint8_t left = (uint8_t)(length - done);
+        uint8_t n    = (left > sizeof(chunk)) ? (uint8_t)sizeof(chunk) : left;
+
+        if (!sfp_read_block(t, dev_addr, (uint8_t)(start_offset + done), chunk, n))
+            return false;
+        if (memcmp(chunk, data + done, n) != 0)
+            return false;
+        done += n;
+    }
+    return true;
+}
+
+bool sfp_write_block(const sfp_transport_t *t, uint8_t dev_addr, uint8_t start_offset,
+                     const uint8_t *data, uint8_t length, bool verify)
+{
+    if (!t || !t->ops || !t->ops->probe || !data || length == 0)
+        return false;
+
+    /* Não atravessa o fim do espaço de 256 bytes */
+    if ((unsigned)start_offset + length > 256u)
+        return false;
+
+    uint8_t buf[1 + SFP_EEPROM_PAGE_SIZE];
+    uint8_t done = 0;
+
+    while (done < length) {
+        uint8_t offset = (uint8_t)(start_offset + done);
+        uint8_t room   = (uint8_t)(SFP_EEPROM_PAGE_SIZE - (offset % SFP_EEPROM_PAGE_SIZE));
+        uint8_t n      = (uint8_t)((length - done) < room ? (length - done) : room);
+
+        buf[0] = offset;
+        memcpy(&buf[1], data + done, n);
+
+        if (!sfp_write_raw(t, dev_addr, buf, (size_t)n + 1))
+            return false;
+
+        if (!eeprom_ack_poll(t, dev_addr))
+            return false;
+
+        done += n;
+    }
+
+    return !verify || eeprom_verify(t, dev_addr, start_offset, data, length);
+}
+
+/* ============================================
+ * Probe (ACK no endereço)
+ * ============================================ */
+bool sfp_probe(const sfp_transport_t *t, uint8_t dev_addr)
+{
+    if (!t || !t->ops || !t->ops->probe)
+        return false;
+
+    if (!sfp_speed_apply(t, dev_addr))
+        return false;
+
+    uint64_t start = sfp_transport_now_us(t);
+    bool ack = t->ops->probe(t->ctx, dev_addr);
+    sfp_trace_xfer(t, SFP_TRACE_PROBE, dev_addr, 0, NULL, 0,
+                   ack ? 0 : SFP_XFER_ERR_NAK, start);
+    sfp_stats_xfer(t, dev_addr, ack ? 0 : SFP_XFER_ERR_NAK, start);
+    return ack;
+}
+
+/* ============================================
+ * Relógio do backend
+ * ============================================ */
+uint64_t sfp_transport_now_us(const sfp_transport_t *t)
+{
+    if (!t || !t->ops || !t->ops->now_us)
+        return 0;
+
+    return t->ops->now_us(t->ctx);
+}
+
+/* ============================================
+ * Clock do barramento
+ * ============================================ */
+uint32_t sfp_transport_set_baudrate(const sfp_transport_t *t, uint32_t baud)
+{
+    if (!t || !t->ops || !t->ops->set_baudrate || baud == 0)
+        return 0;
+
+    return t->ops->set_baudrate(t->ctx, baud);
+}
@@ -0,0 +1,127 @@
+/**
+ * @file transport.h
+ * @brief Abstração de transporte (2-wire) para acesso às EEPROMs do SFP
+ *
+ * @details
+ *  Desacopla a camada de acesso (sfp_read_block) do periférico I2C do
+ *  RP2040. Cada backend fornece uma tabela de funções (read/write/probe)
+ *  e um contexto opaco. Backends disponíveis:
+ *   - RP2040 (hardware/i2c)  -> I2C/i2c.c
+ *   - Host (arquivos binários de dump A0h/A2h) -> I2C/transport_host.c
+ *
+ *  As funções de read/write seguem a convenção do Pico SDK: retornam o
+ *  número de bytes transferidos ou um código negativo em caso de erro.
+ */
+
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ==============================
+ * Códigos de erro do transporte
+ * ============================== */
+#define SFP_XFER_ERR_NAK      (-1)  /* Dispositivo não respondeu (NAK) */
+#define SFP_XFER_ERR_TIMEOUT  (-2)  /* Transferência excedeu o tempo limite */
+#define SFP_XFER_ERR_IO       (-3)  /* Erro genérico de barramento/backend */
+#define SFP_XFER_BUSY         (-4)  /* Transferência assíncrona em andamento */
+
+/* ==============================
+ * Escrita em EEPROM
+ * ============================== */
+#define SFP_EEPROM_PAGE_SIZE         8      /* Página de escrita (SFF-8472: 8 bytes) */
+#define SFP_EEPROM_WRITE_TIMEOUT_US  20000  /* Limite do ciclo interno de escrita */
+#define SFP_EEPROM_ACK_POLL_MAX      5000   /* Sondagens por página (backend sem relógio) */
+#define SFP_EEPROM_ACK_POLL_US       150    /* Espera entre sondagens (com ops->sleep_us) */
+
+/* ==============================
+ * Tabela de funções do backend
+ * ============================== */
+typedef struct {
+    /* Escreve len bytes em addr. nostop = true mantém o barramento (repeated start) */
+    int  (*write)(void *ctx, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+    /* Lê len bytes de addr. nostop = true mantém o barramento (repeated start) */
+    int  (*read)(void *ctx, uint8_t addr, uint8_t *dst, size_t len, bool nostop);
+
+    /* Verifica se existe um dispositivo respondendo (ACK) em addr */
+    bool (*probe)(void *ctx, uint8_t addr);
+
+    /* Relógio monotônico em microssegundos (instrumentação/timeouts) */
+    uint64_t (*now_us)(void *ctx);
+
+    /* Leitura assíncrona (opcional): offset + leitura sequencial sem bloquear.
+       Retorna false se o backend estiver ocupado ou não puder iniciar. */
+    bool (*read_start)(void *ctx, uint8_t addr, uint8_t offset, uint8_t *dst, size_t len);
+
+    /* Andamento da leitura assíncrona: SFP_XFER_BUSY, bytes lidos ou erro (<0) */
+    int  (*read_poll)(void *ctx);
+
+    /* Reprograma o clock do barramento (opcional). Retorna a frequência
+       efetivamente obtida em Hz, ou 0 se não suportado. */
+    uint32_t (*set_baudrate)(void *ctx, uint32_t baud);
+
+    /* Espera ativa/passiva em microssegundos (backoff entre tentativas) */
+    void (*sleep_us)(void *ctx, uint32_t us);
+
+    /* Recuperação do barramento após timeout/erro (opcional).
+       Retorna true se SDA e SCL ficaram livres. */
+    bool (*recover)(void *ctx);
+} sfp_transport_ops_t;
+
+/* Perfil de velocidade por endereço (I2C/speed.h) */
+struct sfp_speed_profile;
+
+/* Política de tentativas e contadores por dispositivo (I2C/retry.h) */
+struct sfp_retry;
+
+/* Registro das transações em buffer circular (I2C/trace.h) */
+struct sfp_trace;
+
+/* Histogramas de latência por endereço (I2C/stats.h) */
+struct sfp_stats;
+
+typedef struct {
+    const sfp_transport_ops_t *ops;
+    void *ctx;
+
+    /* Opcional: velocidade negociada por dispositivo, aplicada antes de cada transação */
+    struct sfp_speed_profile *speed;
+
+    /* Opcional: novas tentativas com backoff + contadores de saúde */
+    struct sfp_retry *retry;
+
+    /* Opcional: registro binário de cada transação */
+    struct sfp_trace *trace;
+
+    /* Opcional: histograma de latência por endereço */
+    struct sfp_stats *stats;
+} sfp_transport_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* Memory Access */
+bool sfp_read_block(const sfp_transport_t *t, uint8_t dev_addr, uint8_t start_offset, uint8_t *buffer, uint8_t length);
+
+/* Escrita em EEPROM: divide em páginas, aguarda cada ciclo por ACK polling
+   e, se verify, confere por releitura */
+bool sfp_write_block(const sfp_transport_t *t, uint8_t dev_addr, uint8_t start_offset,
+                     const uint8_t *data, uint8_t length, bool verify);
+
+/* Escrita crua (sem offset), ex.: comandos/dados do OLED */
+bool sfp_write_raw(const sfp_transport_t *t, uint8_t dev_addr, const uint8_t *src, size_t length);
+
+/* Presença de dispositivo no barramento */
+bool sfp_probe(const sfp_transport_t *t, uint8_t dev_addr);
+
+/* Relógio do backend (0 se não suportado) */
+uint64_t sfp_transport_now_us(const sfp_transport_t *t);
+
+/* Clock do barramento (0 se não suportado) */
+uint32_t sfp_transport_set_baudrate(const sfp_transport_t *t, uint32_t baud);
+
+#endif /* TRANSPORT_H */
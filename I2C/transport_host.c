@@ -0,0 +1,496 @@
+#define _POSIX_C_SOURCE 199309L
+
+#include "transport_host.h"
+#include "sfp_8472/defs.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* ============================================
+ * Auxiliares
+ * ============================================ */
+
+/* Mapeia o endereço I2C para o índice da memória emulada (-1 = ausente) */
+static int host_index(const sfp_host_eeprom_t *dev, uint8_t addr)
+{
+    int idx;
+
+    if (addr == ADDR_A0)
+        idx = 0;
+    else if (addr == ADDR_A2)
+        idx = 1;
+    else
+        return -1;
+
+    return dev->present[idx] ? idx : -1;
+}
+
+static uint64_t host_clock_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+static void host_delay_us(uint32_t us)
+{
+    if (us == 0)
+        return;
+
+    struct timespec ts = {
+        .tv_sec  = us / 1000000u,
+        .tv_nsec = (long)(us % 1000000u) * 1000L
+    };
+    nanosleep(&ts, NULL);
+}
+
+/* Início comum de transação: latência + falhas injetadas (0 = ok) */
+static int host_begin(sfp_host_eeprom_t *dev)
+{
+    dev->transactions++;
+    host_delay_us(dev->latency_us);
+
+    if (dev->bus_stuck)
+        return SFP_XFER_ERR_TIMEOUT;
+
+    if (dev->nak_every && (dev->transactions % dev->nak_every) == 0) {
+        dev->naks_injected++;
+        return SFP_XFER_ERR_NAK;
+    }
+    return 0;
+}
+
+/* Célula de memória em 'off': no A2h, 128-255 seguem a página do byte 127 */
+static uint8_t *host_cell(sfp_host_eeprom_t *dev, int idx, uint8_t off)
+{
+    uint8_t page = dev->mem[1][A2_PAGE_SELECT];
+
+    if (idx != 1 || off < SFP_HOST_PAGE_SIZE || page == PAGE_00)
+        return &dev->mem[idx][off];
+
+    if (page >= SFP_HOST_A2_PAGES) {
+        dev->unmapped = 0xFF;
+        return &dev->unmapped;
+    }
+    return &dev->upper[page - 1][off - SFP_HOST_PAGE_SIZE];
+}
+
+/* Ciclo interno de escrita em andamento: dispositivo não reconhece o endereço */
+static bool host_write_busy(sfp_host_eeprom_t *dev, int idx)
+{
+    if (dev->busy_until_us[idx] == 0)
+        return false;
+
+    if (host_clock_us() < dev->busy_until_us[idx]) {
+        dev->busy_naks++;
+        return true;
+    }
+
+    dev->busy_until_us[idx] = 0;
+    return false;
+}
+
+/* Byte entregue ao mestre: corrompido se o clock excede o suportado */
+static uint8_t host_wire_byte(const sfp_host_eeprom_t *dev, uint8_t v)
+{
+    if (dev->max_baud && dev->baud > dev->max_baud)
+        return v ^ 0x01;
+    return v;
+}
+
+/* ============================================
+ * Operações do backend
+ * ============================================ */
+static int host_write(void *ctx, uint8_t addr, const uint8_t *src, size_t len, bool nostop)
+{
+    sfp_host_eeprom_t *dev = ctx;
+    (void)nostop;
+
+    int err = host_begin(dev);
+    if (err < 0)
+        return err;
+
+    int idx = host_index(dev, addr);
+    if (idx < 0 || host_write_busy(dev, idx))
+        return SFP_XFER_ERR_NAK;
+
+    if (len == 0)
+        return 0;
+
+    /* Primeiro byte = ponteiro de endereço; demais = dados (auto-incremento,
+       com "wrap" dentro da página como na EEPROM) */
+    uint8_t start = src[0];
+    dev->pointer[idx] = start;
+    for (size_t i = 1; i < len; i++) {
+        *host_cell(dev, idx, dev->pointer[idx]) = src[i];
+        if (dev->page_size) {
+            uint8_t base = (uint8_t)(start - (start % dev->page_size));
+            dev->pointer[idx] = (uint8_t)(base + ((dev->pointer[idx] - base + 1) % dev->page_size));
+        } else {
+            dev->pointer[idx]++;
+        }
+    }
+
+    /* O seletor de página é um registrador: sem ciclo de gravação */
+    if (idx == 1 && start == A2_PAGE_SELECT && len == 2) {
+        dev->page_selects++;
+    } else if (len > 1) {
+        dev->page_writes++;
+        if (dev->write_cycle_us)
+            dev->busy_until_us[idx] = host_clock_us() + dev->write_cycle_us;
+    }
+
+    dev->bytes_written += len;
+    return (int)len;
+}
+
+static int host_read(void *ctx, uint8_t addr, uint8_t *dst, size_t len, bool nostop)
+{
+    sfp_host_eeprom_t *dev = ctx;
+    (void)nostop;
+
+    int err = host_begin(dev);
+    if (err < 0)
+        return err;
+
+    int idx = host_index(dev, addr);
+    if (idx < 0 || host_write_busy(dev, idx))
+        return SFP_XFER_ERR_NAK;
+
+    for (size_t i = 0; i < len; i++) {
+        dst[i] = host_wire_byte(dev, *host_cell(dev, idx, dev->pointer[idx]));
+        dev->pointer[idx]++;
+    }
+
+    dev->bytes_read += len;
+    return (int)len;
+}
+
+static bool host_probe(void *ctx, uint8_t addr)
+{
+    sfp_host_eeprom_t *dev = ctx;
+
+    if (host_begin(dev) < 0)
+        return false;
+
+    int idx = host_index(dev, addr);
+    return idx >= 0 && !host_write_busy(dev, idx);
+}
+
+static uint64_t host_now_us(void *ctx)
+{
+    (void)ctx;
+    return host_clock_us();
+}
+
+static bool host_read_start(void *ctx, uint8_t addr, uint8_t offset, uint8_t *dst, size_t len)
+{
+    sfp_host_eeprom_t *dev = ctx;
+
+    if (dev->pending.active || !dst || len == 0)
+        return false;
+
+    /* Latência e NAK são avaliados na conclusão, sem bloquear aqui */
+    dev->transactions++;
+    dev->pending.nak = dev->nak_every && (dev->transactions % dev->nak_every) == 0;
+    if (dev->pending.nak)
+        dev->naks_injected++;
+
+    dev->pending.active   = true;
+    dev->pending.addr     = addr;
+    dev->pending.offset   = offset;
+    dev->pending.dst      = dst;
+    dev->pending.len      = len;
+    dev->pending.ready_us = host_clock_us() + dev->latency_us;
+    return true;
+}
+
+static int host_read_poll(void *ctx)
+{
+    sfp_host_eeprom_t *dev = ctx;
+
+    if (!dev->pending.active)
+        return SFP_XFER_ERR_IO;
+
+    if (host_clock_us() < dev->pending.ready_us)
+        return SFP_XFER_BUSY;
+
+    dev->pending.active = false;
+
+    if (dev->bus_stuck)
+        return SFP_XFER_ERR_TIMEOUT;
+
+    int idx = host_index(dev, dev->pending.addr);
+    if (dev->pending.nak || idx < 0 || host_write_busy(dev, idx))
+        return SFP_XFER_ERR_NAK;
+
+    dev->pointer[idx] = dev->pending.offset;
+    for (size_t i = 0; i < dev->pending.len; i++) {
+        dev->pending.dst[i] = host_wire_byte(dev, *host_cell(dev, idx, dev->pointer[idx]));
+        dev->pointer[idx]++;
+    }
+
+    dev->bytes_read += dev->pending.len;
+    return (int)dev->pending.len;
+}
+
+static uint32_t host_set_baudrate(void *ctx, uint32_t baud)
+{
+    sfp_host_eeprom_t *dev = ctx;
+
+    if (dev->baud_locked)
+        return 0;
+    dev->baud = baud;
+    return baud;
+}
+
+static void host_sleep_us(void *ctx, uint32_t us)
+{
+    (void)ctx;
+    host_delay_us(us);
+}
+
+static bool host_recover(void *ctx)
+{
+    sfp_host_eeprom_t *dev = ctx;
+
+    dev->recoveries++;
+    dev->bus_stuck      = false;
+    dev->pending.active = false;
+    return true;
+}
+
+static const sfp_transport_ops_t host_ops = {
+    .write        = host_write,
+    .read         = host_read,
+    .probe        = host_probe,
+    .now_us       = host_now_us,
+    .read_start   = host_read_start,
+    .read_poll    = host_read_poll,
+    .set_baudrate = host_set_baudrate,
+    .sleep_us     = host_sleep_us,
+    .recover      = host_recover,
+};
+
+/* ============================================
+ * Multiplexador emulado (TCA9548A)
+ * ============================================ */
+
+/* Módulo do canal selecionado (menor canal se houver mais de um) */
+static sfp_host_eeprom_t *mux_dev(const sfp_host_mux_t *mux)
+{
+    for (int i = 0; i < SFP_HOST_MUX_CHANNELS; i++) {
+        if ((mux->mask & (1u << i)) && mux->chan[i])
+            return mux->chan[i];
+    }
+    return NULL;
+}
+
+static int mux_write(void *ctx, uint8_t addr, const uint8_t *src, size_t len, bool nostop)
+{
+    sfp_host_mux_t *mux = ctx;
+
+    if (addr == mux->addr) {
+        if (len != 1)
+            return SFP_XFER_ERR_NAK;
+        mux->mask = src[0];
+        mux->selects++;
+        return 1;
+    }
+
+    sfp_host_eeprom_t *dev = mux_dev(mux);
+    return dev ? host_write(dev, addr, src, len, nostop) : SFP_XFER_ERR_NAK;
+}
+
+static int mux_read(void *ctx, uint8_t addr, uint8_t *dst, size_t len, bool nostop)
+{
+    sfp_host_mux_t *mux = ctx;
+
+    if (addr == mux->addr) {
+        if (len > 0)
+            dst[0] = mux->mask;
+        return (int)len;
+    }
+
+    sfp_host_eeprom_t *dev = mux_dev(mux);
+    return dev ? host_read(dev, addr, dst, len, nostop) : SFP_XFER_ERR_NAK;
+}
+
+static bool mux_probe(void *ctx, uint8_t addr)
+{
+    sfp_host_mux_t *mux = ctx;
+
+    if (addr == mux->addr)
+        return true;
+
+    sfp_host_eeprom_t *dev = mux_dev(mux);
+    return dev ? host_probe(dev, addr) : false;
+}
+
+static bool mux_read_start(void *ctx, uint8_t addr, uint8_t offset, uint8_t *dst, size_t len)
+{
+    sfp_host_mux_t *mux = ctx;
+    sfp_host_eeprom_t *dev = mux_dev(mux);
+
+    if (mux->pending || !dev || !host_read_start(dev, addr, offset, dst, len))
+        return false;
+
+    mux->pending = dev;
+    return true;
+}
+
+static int mux_read_poll(void *ctx)
+{
+    sfp_host_mux_t *mux = ctx;
+
+    if (!mux->pending)
+        return SFP_XFER_ERR_IO;
+
+    int ret = host_read_poll(mux->pending);
+    if (ret != SFP_XFER_BUSY)
+        mux->pending = NULL;
+    return ret;
+}
+
+static uint32_t mux_set_baudrate(void *ctx, uint32_t baud)
+{
+    sfp_host_mux_t *mux = ctx;
+
+    for (int i = 0; i < SFP_HOST_MUX_CHANNELS; i++) {
+        if (mux->chan[i])
+            host_set_baudrate(mux->chan[i], baud);
+    }
+    return baud;
+}
+
+static bool mux_recover(void *ctx)
+{
+    sfp_host_mux_t *mux = ctx;
+
+    mux->pending = NULL;
+    for (int i = 0; i < SFP_HOST_MUX_CHANNELS; i++) {
+        if (mux->chan[i])
+            host_recover(mux->chan[i]);
+    }
+    return true;
+}
+
+static const sfp_transport_ops_t host_mux_ops = {
+    .write        = mux_write,
+    .read         = mux_read,
+    .probe        = mux_probe,
+    .now_us       = host_now_us,
+    .read_start   = mux_read_start,
+    .read_poll    = mux_read_poll,
+    .set_baudrate = mux_set_baudrate,
+    .sleep_us     = host_sleep_us,
+    .recover      = mux_recover,
+};
+
+/* ============================================
+ * API pública
+ * ============================================ */
+void sfp_host_eeprom_init(sfp_host_eeprom_t *dev)
+{
+    if (!dev)
+        return;
+
+    memset(dev, 0, sizeof(*dev));
+    memset(dev->upper, 0xFF, sizeof(dev->upper));
+    dev->baud      = 100000u;
+    dev->page_size = 8;
+}
+
+bool sfp_host_eeprom_set(sfp_host_eeprom_t *dev, uint8_t dev_addr, const uint8_t *data, size_t len)
+{
+    if (!dev || !data || len > SFP_HOST_EEPROM_SIZE)
+        return false;
+
+    int idx = (dev_addr == ADDR_A0) ? 0 : (dev_addr == ADDR_A2) ? 1 : -1;
+    if (idx < 0)
+        return false;
+
+    memset(dev->mem[idx], 0xFF, SFP_HOST_EEPROM_SIZE);
+    memcpy(dev->mem[idx], data, len);
+    dev->present[idx] = true;
+    dev->pointer[idx] = 0;
+    return true;
+}
+
+bool sfp_host_eeprom_set_page(sfp_host_eeprom_t *dev, uint8_t page, const uint8_t *data, size_t len)
+{
+    if (!dev || !data || len > SFP_HOST_PAGE_SIZE || page >= SFP_HOST_A2_PAGES)
+        return false;
+
+    uint8_t *dst = (page == PAGE_00) ? &dev->mem[1][SFP_HOST_PAGE_SIZE] : dev->upper[page - 1];
+
+    memset(dst, 0xFF, SFP_HOST_PAGE_SIZE);
+    memcpy(dst, data, len);
+    return true;
+}
+
+bool sfp_host_eeprom_load(sfp_host_eeprom_t *dev, uint8_t dev_addr, const char *path)
+{
+    if (!dev || !path)
+        return false;
+
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return false;
+
+    uint8_t data[SFP_HOST_EEPROM_SIZE];
+    size_t n = fread(data, 1, sizeof(data), f);
+    fclose(f);
+
+    if (n == 0)
+        return false;
+
+    return sfp_host_eeprom_set(dev, dev_addr, data, n);
+}
+
+void sfp_host_transport_init(sfp_transport_t *t, sfp_host_eeprom_t *dev)
+{
+    if (!t)
+        return;
+
+    t->ops   = &host_ops;
+    t->ctx   = dev;
+    t->speed = NULL;
+    t->retry = NULL;
+    t->trace = NULL;
+    t->stats = NULL;
+}
+
+void sfp_host_mux_init(sfp_host_mux_t *mux, uint8_t addr)
+{
+    if (!mux)
+        return;
+
+    memset(mux, 0, sizeof(*mux));
+    mux->addr = addr;
+}
+
+bool sfp_host_mux_attach(sfp_host_mux_t *mux, uint8_t channel, sfp_host_eeprom_t *dev)
+{
+    if (!mux || channel >= SFP_HOST_MUX_CHANNELS)
+        return false;
+
+    if (mux->pending && mux->pending == mux->chan[channel])
+        mux->pending = NULL;
+
+    mux->chan[channel] = dev;
+    return true;
+}
+
+void sfp_host_mux_transport_init(sfp_transport_t *t, sfp_host_mux_t *mux)
+{
+    if (!t)
+        return;
+
+    t->ops   = &host_mux_ops;
+    t->ctx   = mux;
+    t->speed = NULL;
+    t->retry = NULL;
+    t->trace = NULL;
+    t->stats = NULL;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file transport_host.h
+ * @brief Backend de transporte para host (Linux) — EEPROM SFP emulada
+ *
+ * @details
+ *  Emula um módulo SFP no barramento servindo A0h (0x50) e A2h (0x51) a
+ *  partir de arquivos binários de dump. Permite rodar o pipeline real de
+ *  sfp_read_block() + sfp_parse_* fora da Pico para profiling, benchmark
+ *  e testes de regressão.
+ *
+ *  Falhas podem ser injetadas:
+ *   - latency_us: atraso fixo por transação (simula o tempo de barramento)
+ *   - nak_every:  a cada N transações, a transação seguinte recebe NAK
+ *   - max_baud:   acima desta frequência as leituras chegam corrompidas
+ *   - bus_stuck:  SDA preso; transações expiram até a recuperação do barramento
+ *   - write_cycle_us: após cada escrita o dispositivo fica em NAK (ACK polling)
+ *
+ *  O A2h emula a memória paginada: o byte 127 seleciona qual página aparece
+ *  em 128-255. A página 00h é a metade superior do dump carregado; as demais
+ *  são preenchidas com sfp_host_eeprom_set_page().
+ *
+ *  A leitura assíncrona (read_start/read_poll) não bloqueia: o bloco é
+ *  entregue quando latency_us tiver decorrido desde o início.
+ */
+
+#ifndef TRANSPORT_HOST_H
+#define TRANSPORT_HOST_H
+
+#include "transport.h"
+
+/** @brief Tamanho de cada memória emulada (endereçamento de 8 bits) */
+#define SFP_HOST_EEPROM_SIZE 256
+
+/** @brief Páginas superiores emuladas no A2h (00h..03h) e tamanho de cada uma */
+#define SFP_HOST_A2_PAGES     4
+#define SFP_HOST_PAGE_SIZE    128
+
+typedef struct {
+    /* Conteúdo das memórias: [0] = A0h (0x50), [1] = A2h (0x51) */
+    uint8_t  mem[2][SFP_HOST_EEPROM_SIZE];
+    bool     present[2];
+
+    /* A2h páginas 01h..03h (a 00h é mem[1][128..255]); páginas inexistentes
+       leem 0xFF e ignoram escrita */
+    uint8_t  upper[SFP_HOST_A2_PAGES - 1][SFP_HOST_PAGE_SIZE];
+    uint8_t  unmapped;
+
+    /* Ponteiro interno de endereço de cada memória (auto-incremento) */
+    uint8_t  pointer[2];
+
+    /* Injeção de falhas */
+    uint32_t latency_us;
+    uint32_t nak_every;
+
+    /* Clock do barramento: acima de max_baud (0 = sem limite) os dados lidos
+       chegam corrompidos, como num módulo que não suporta Fast-mode */
+    uint32_t baud;
+    uint32_t max_baud;
+
+    /* Clock travado: set_baudrate recusa (0), como o RP2040 com a fila da
+       ISR ativa */
+    bool     baud_locked;
+
+    /* Barramento travado: toda transação sofre timeout até ops->recover */
+    bool     bus_stuck;
+
+    /* Escrita: página com "wrap" (0 = sem limite) e ciclo interno durante o
+       qual o dispositivo responde NAK, como numa EEPROM real */
+    uint8_t  page_size;
+    uint32_t write_cycle_us;
+    uint64_t busy_until_us[2];
+
+    /* Leitura assíncrona pendente */
+    struct {
+        bool     active;
+        bool     nak;
+        uint8_t  addr;
+        uint8_t  offset;
+        uint8_t *dst;
+        size_t   len;
+        uint64_t ready_us;
+    } pending;
+
+    /* Estatísticas */
+    uint32_t transactions;
+    uint32_t naks_injected;
+    uint32_t recoveries;
+    uint32_t page_writes;
+    uint32_t busy_naks;
+    uint32_t page_selects;
+    uint64_t bytes_read;
+    uint64_t bytes_written;
+} sfp_host_eeprom_t;
+
+/** @brief Canais do multiplexador emulado (TCA9548A) */
+#define SFP_HOST_MUX_CHANNELS 8
+
+/*
+ * Multiplexador emulado: um byte de controle em 'addr' (bit n = canal n);
+ * as demais transações são encaminhadas ao módulo do canal selecionado.
+ * Canal sem módulo (NULL) = gaiola vazia.
+ */
+typedef struct {
+    uint8_t addr;
+    uint8_t mask;
+    sfp_host_eeprom_t *chan[SFP_HOST_MUX_CHANNELS];
+    sfp_host_eeprom_t *pending;     /* dono da leitura assíncrona em curso */
+
+    /* Estatísticas */
+    uint32_t selects;
+} sfp_host_mux_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* Zera a emulação (nenhum dispositivo presente) */
+void sfp_host_eeprom_init(sfp_host_eeprom_t *dev);
+
+/* Carrega um dump binário (até 256 bytes) para 0x50 ou 0x51 */
+bool sfp_host_eeprom_load(sfp_host_eeprom_t *dev, uint8_t dev_addr, const char *path);
+
+/* Carrega um buffer em memória para 0x50 ou 0x51 */
+bool sfp_host_eeprom_set(sfp_host_eeprom_t *dev, uint8_t dev_addr, const uint8_t *data, size_t len);
+
+/* Conteúdo da página superior 'page' do A2h (bytes 128-255) */
+bool sfp_host_eeprom_set_page(sfp_host_eeprom_t *dev, uint8_t page, const uint8_t *data, size_t len);
+
+/* Backend de transporte (ctx = sfp_host_eeprom_t) */
+void sfp_host_transport_init(sfp_transport_t *t, sfp_host_eeprom_t *dev);
+
+/* Multiplexador emulado: init, inserção/remoção de módulo e transporte */
+void sfp_host_mux_init(sfp_host_mux_t *mux, uint8_t addr);
+bool sfp_host_mux_attach(sfp_host_mux_t *mux, uint8_t channel, sfp_host_eeprom_t *dev);
+void sfp_host_mux_transport_init(sfp_transport_t *t, sfp_host_mux_t *mux);
+
+#endif /* TRANSPORT_HOST_H */
@@ -7,11 +7,23 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include "pico/stdlib.h"
 
 #include "I2C/i2c.h"
+#include "I2C/sched.h"
+#include "I2C/speed.h"
+#include "I2C/retry.h"
+#include "I2C/trace.h"
+#include "I2C/stats.h"
+#include "I2C/hotplug.h"
+#include "I2C/dmi.h"
+#include "I2C/page.h"
 #include "sfp_8472/a0h.h"
 #include "sfp_8472/a2h.h"
+#include "sfp_8472/cache.h"
+#include "sfp_8472/checksum.h"
+#include "sfp_8472/vendor_db.h"
 #include "menu/menu.h"
 
 
@@ -20,6 +32,411 @@
 #define I2C_SDA  0
 #define I2C_SCL  1
 
+/* Transporte do barramento SFP (backend RP2040) */
+static sfp_transport_t sfp_bus;
+static sfp_speed_profile_t sfp_speed;
+static sfp_retry_t sfp_retry;
+
+/* Transporte do barramento do OLED */
+static sfp_transport_t oled_bus;
+static sfp_speed_profile_t oled_speed;
+static sfp_retry_t oled_retry;
+
+/* Registro das transações dos dois barramentos (dump pela USB) */
+static sfp_trace_t i2c_trace;
+#define TRACE_HEX_PER_LINE  32
+
+/* Latência por endereço dos dois barramentos (consulta pela USB) */
+static sfp_stats_t i2c_stats;
+
+/* Escalonador único das transações dos dois barramentos */
+static sfp_sched_t sched;
+
+#define SCHED_BUDGET_US     (40 * 1000)  /* Tempo máximo de barramento por volta do laço */
+#define FRAME_PERIOD_MS     50
+#define ALARM_POLL_MS       100          /* Status/flags do A2h (bytes 110-117) */
+#define ALARM_POLL_FAST_MS  50           /* ... em módulos de RATE_FAST_MBD ou mais */
+#define ALARM_POLL_SLOW_MS  200          /* ... abaixo de RATE_SLOW_MBD ou sem taxa */
+#define RATE_FAST_MBD       10000u       /* 10 GBd (SFP+/SFP28) */
+#define RATE_SLOW_MBD       1000u        /* 1 GBd */
+
+/* Leitura periódica do bloco de diagnósticos A2h.
+   a2_live guarda a imagem completa; só as janelas dinâmicas são relidas. */
+static sfp_sched_req_t a2_req;
+static sfp_sched_req_t a2_alarm_req;
+static uint8_t a2_live[SFP_A2_SIZE];
+static uint8_t a2_dyn_offset;
+static uint8_t a2_dyn_length;
+static uint32_t a2_last_refresh;
+static uint32_t a2_last_alarm_poll;
+static uint32_t a2_alarm_period_ms = ALARM_POLL_MS;
+
+/* Módulo carregado (A0h/A2h lidos). Em caso de falha o sistema segue
+   rodando e tenta novamente a cada SFP_LOAD_RETRY_MS. */
+#define SFP_LOAD_RETRY_MS   1000
+static uint8_t a0_base_data[SFP_A0_SIZE];
+static sfp_a0_upper_t a0_upper;      /* A0h 128-255: lido só quando consultado */
+#define SFP_MAX_POLL_FAILS  3        /* Falhas seguidas do A2h até recarregar o módulo */
+static bool sfp_loaded;
+static uint32_t sfp_last_load;
+static uint8_t a2_poll_fails;
+
+/* Presença do módulo (sondagem de 1 byte em 0x50) e módulos já conhecidos */
+#define HOTPLUG_POLL_MS     200
+static sfp_hotplug_t sfp_presence;
+static sfp_module_cache_t sfp_cache;
+
+/* CC_BASE/CC_EXT/CC_DMI por módulo: cada leitura parcial revalida só as faixas que tocou */
+static sfp_checksum_t sfp_chk;
+static uint8_t sfp_chk_ok = SFP_CHK_MASK_ALL;
+static uint32_t sfp_last_presence;
+static sfp_a2h_t a2_info;            /* limiares + última medida do A2h */
+
+/* Última amostra coerente de A2h 96-119, compartilhada por todos os consumidores */
+static sfp_dmi_t sfp_dmi;
+
+/* Frame do OLED: uma transação por página, enviada só se a página mudou */
+#define OLED_PAGES (SSD1306_HEIGHT / 8)
+static sfp_sched_req_t oled_req[OLED_PAGES];
+static uint8_t oled_pkt[OLED_PAGES][SSD1306_PAGE_PACKET_SIZE];
+static bool oled_pkt_sent[OLED_PAGES];
+
+/*
+ * Período de sondagem de status/flags do A2h pela taxa nominal resolvida
+ * (bytes 12/66): quanto maior a taxa, mais tráfego se perde a cada ms em
+ * que um LOS/TX_FAULT passa despercebido.
+ */
+static void sfp_plan_polling(uint32_t rate_mbd)
+{
+    if (rate_mbd >= RATE_FAST_MBD)
+        a2_alarm_period_ms = ALARM_POLL_FAST_MS;
+    else if (rate_mbd >= RATE_SLOW_MBD)
+        a2_alarm_period_ms = ALARM_POLL_MS;
+    else
+        a2_alarm_period_ms = ALARM_POLL_SLOW_MS;
+}
+
+/* Recalcula só as faixas tocadas e avisa quando o resultado muda */
+static void sfp_checksum_check(void)
+{
+    uint8_t ok = sfp_checksum_verify(&sfp_chk, a0_base_data, a2_live);
+
+    if (ok != sfp_chk_ok) {
+        printf("Checksums: BASE %s EXT %s DMI %s\n",
+               (ok & SFP_CHK_MASK(SFP_CHK_BASE)) ? "ok" : "ERRO",
+               (ok & SFP_CHK_MASK(SFP_CHK_EXT))  ? "ok" : "ERRO",
+               (ok & SFP_CHK_MASK(SFP_CHK_DMI))  ? "ok" : "ERRO");
+        sfp_chk_ok = ok;
+    }
+}
+
+/**
+ * @brief Callback de conclusão da leitura periódica do A2h
+ *
+ * Executado dentro de sfp_sched_run(), no laço principal.
+ */
+static void on_a2_refresh(sfp_sched_req_t *req, bool ok, void *user)
+{
+    (void)user;
+
+    if (!ok) {
+        /* Módulo removido ou barramento degradado: volta a carregar o módulo */
+        if (++a2_poll_fails >= SFP_MAX_POLL_FAILS) {
+            sfp_loaded = false;
+            a2_poll_fails = 0;
+        }
+        return;
+    }
+    a2_poll_fails = 0;
+
+    sfp_checksum_touch(&sfp_chk, SFP_I2C_ADDR_A2, req->offset, (uint8_t)req->length);
+    sfp_checksum_check();
+
+    /* A janela 96-119 veio numa única transação: vira o snapshot publicado */
+    const sfp_dmi_snapshot_t *snap = sfp_dmi_publish(&sfp_dmi, a2_live + SFP_DMI_OFFSET, req->end_us);
+    a2_info.rx_power = snap->rx_power;
+    system_ctrl.sfp_data.potencia_rx = sfp_a2h_get_rx_power_dbm(&a2_info);
+}
+
+/**
+ * @brief Callback da leitura crítica de status/flags do A2h
+ */
+static void on_a2_alarm(sfp_sched_req_t *req, bool ok, void *user)
+{
+    (void)req;
+    (void)user;
+
+    if (!ok)
+        return;
+
+    sfp_checksum_touch(&sfp_chk, SFP_I2C_ADDR_A2, SFP_A2_ALARM_OFFSET, SFP_A2_ALARM_LEN);
+    sfp_checksum_check();
+}
+
+static void on_oled_page(sfp_sched_req_t *req, bool ok, void *user)
+{
+    (void)req;
+    oled_pkt_sent[(uintptr_t)user] = ok;
+}
+
+/**
+ * @brief Enfileira as páginas alteradas do framebuffer como transações BULK
+ */
+static void oled_submit_frame(uint64_t deadline_us)
+{
+    uint8_t pkt[SSD1306_PAGE_PACKET_SIZE];
+
+    for (uint8_t i = 0; i < OLED_PAGES; i++) {
+        ssd1306_PackPage(i, pkt);
+        if (oled_pkt_sent[i] && memcmp(pkt, oled_pkt[i], sizeof(pkt)) == 0)
+            continue;
+
+        /* Página ainda na fila: basta atualizar o conteúdo que será enviado */
+        memcpy(oled_pkt[i], pkt, sizeof(pkt));
+        oled_pkt_sent[i] = false;
+        if (sfp_sched_pending(&oled_req[i]))
+            continue;
+
+        sfp_sched_submit_write(&sched, &oled_req[i], &oled_bus, SSD1306_I2C_ADDR,
+                               oled_pkt[i], sizeof(pkt), SFP_SCHED_PRIO_BULK,
+                               deadline_us, on_oled_page, (void *)(uintptr_t)i);
+    }
+}
+
+/**
+ * @brief Saída do dump do trace em hexadecimal pela USB stdio
+ *
+ * O stdio USB pode traduzir '\n' em "\r\n", então o binário é enviado em
+ * texto; tools/trace_replay.c aceita a captura do terminal diretamente.
+ */
+static void trace_hex_sink(void *user, const uint8_t *data, size_t len)
+{
+    uint32_t *col = user;
+
+    for (size_t i = 0; i < len; i++) {
+        printf("%02X", data[i]);
+        if (++(*col) % TRACE_HEX_PER_LINE == 0)
+            printf("\n");
+    }
+}
+
+/**
+ * @brief Comandos de um caractere recebidos pela USB stdio
+ *
+ *  t: dump do trace de transações I2C
+ *  c: limpa o trace
+ *  s: histogramas de latência por endereço + fila do escalonador
+ *  z: zera os histogramas e as métricas do escalonador
+ *  a: flags de alarme/aviso do A2h (última sondagem)
+ *  v: área do fornecedor (A0h 128-255), lida na primeira consulta
+ */
+static void usb_console_poll(void)
+{
+    int c = getchar_timeout_us(0);
+    if (c == PICO_ERROR_TIMEOUT)
+        return;
+
+    switch (c) {
+    case 't': {
+        uint32_t col = 0;
+        printf("#TRACE BEGIN\n");
+        uint32_t n = sfp_trace_dump(&i2c_trace, trace_hex_sink, &col);
+        printf("\n#TRACE END %lu\n", (unsigned long)n);
+        break;
+    }
+    case 'c':
+        sfp_trace_clear(&i2c_trace);
+        printf("#TRACE CLEARED\n");
+        break;
+    case 's':
+        printf("#STATS\n");
+        sfp_stats_report(&i2c_stats);
+        printf("#SCHED\n");
+        sfp_sched_report(&sched);
+        break;
+    case 'z':
+        sfp_stats_init(&i2c_stats);
+        sfp_sched_reset_metrics(&sched);
+        printf("#STATS CLEARED\n");
+        break;
+    case 'a':
+        printf("#A2 alarm %02X%02X warn %02X%02X\n",
+               a2_live[A2_ALARM_FLAGS], a2_live[A2_ALARM_FLAGS + 1],
+               a2_live[A2_WARNING_FLAGS], a2_live[A2_WARNING_FLAGS + 1]);
+        break;
+    case 'v': {
+        /* Leitura bloqueante: só com o barramento SFP ocioso */
+        if (!sfp_loaded || sfp_sched_pending(&a2_req) || sfp_sched_pending(&a2_alarm_req)) {
+            printf("#A0 UPPER BUSY\n");
+            break;
+        }
+        const uint8_t *upper = sfp_a0_upper_get(&a0_upper);
+        if (!upper) {
+            printf("#A0 UPPER ERROR\n");
+            break;
+        }
+        printf("#A0 UPPER BEGIN\n");
+        for (uint16_t i = 0; i < SFP_A0_UPPER_SIZE; i++) {
+            if (i % 16 == 0)
+                printf("%s%02X:", i ? "\n" : "", SFP_A0_UPPER_START + i);
+            printf(" %02X", upper[i]);
+        }
+        printf("\n#A0 UPPER END %lu\n", (unsigned long)a0_upper.reads);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief Identifica e lê o módulo (A0h completo + imagem do A2h)
+ *
+ * O A0h é sempre lido para calcular o fingerprint. Módulo já visto
+ * (sfp_8472/cache.h): reaproveita A0h decodificado, limiares, região
+ * estática do A2h e velocidade, relendo só 96-127 do A2h. Módulo novo:
+ * negocia a velocidade, lê o A2h completo, decodifica e guarda no cache.
+ *
+ * Falhas não travam o sistema: retorna false e o laço principal tenta
+ * novamente. As transações já passam pela política de novas tentativas
+ * e recuperação do barramento (I2C/retry.h).
+ *
+ * @return true se A0h e A2h foram lidos e o A0h decodificado
+ */
+static bool sfp_load_module(void)
+{
+    /* Identidade na velocidade padrão: o módulo pode ter sido trocado */
+    sfp_speed_set(&sfp_speed, SFP_I2C_ADDR_A0, SFP_SPEED_DEFAULT_HZ);
+    sfp_speed_set(&sfp_speed, SFP_I2C_ADDR_A2, SFP_SPEED_DEFAULT_HZ);
+
+    /* Buffer cru(raw) da EEPROM A0h */
+    bool ok = sfp_read_block(
+        &sfp_bus,
+        SFP_I2C_ADDR_A0,
+        0x00,
+        a0_base_data,
+        SFP_A0_SIZE
+    );
+
+    if (!ok) {
+        printf("ERRO: Falha na leitura do A0h\n");
+        return false;
+    }
+    sfp_a0_upper_invalidate(&a0_upper);
+
+    uint32_t fp = sfp_a0_fingerprint(a0_base_data);
+    const sfp_module_cache_entry_t *known = sfp_module_cache_lookup(&sfp_cache, fp);
+
+    sfp_checksum_select(&sfp_chk, fp);
+    sfp_checksum_touch(&sfp_chk, SFP_I2C_ADDR_A0, 0, SFP_A0_SIZE);
+
+    /* Base de fabricantes: os quirks já valem para a negociação */
+    sfp_vendor_info_t vendor;
+    if (sfp_vendor_lookup_raw(a0_base_data, &vendor))
+        printf("Fabricante: %s %s (quirks %04X)\n", vendor.vendor,
+               vendor.family ? vendor.family : "-", vendor.quirks);
+    else
+        memset(&vendor, 0, sizeof(vendor));
+
+    if (known) {
+        /* Módulo conhecido: sem negociação nem decodificação */
+        if (known->baud) {
+            sfp_speed_set(&sfp_speed, SFP_I2C_ADDR_A0, known->baud);
+            sfp_speed_set(&sfp_speed, SFP_I2C_ADDR_A2, known->baud);
+        }
+        memcpy(a2_live, known->a2_static, SFP_CACHE_A2_STATIC_LEN);
+        ok = sfp_read_block(&sfp_bus, SFP_I2C_ADDR_A2, SFP_CACHE_A2_STATIC_LEN,
+                            a2_live + SFP_CACHE_A2_STATIC_LEN,
+                            SFP_A2_SIZE - SFP_CACHE_A2_STATIC_LEN);
+        if (!ok) {
+            printf("ERRO: Falha na leitura do A2h\n");
+            return false;
+        }
+        /* 0-95 veio do cache: CC_DMI segue valendo o resultado guardado */
+        sfp_checksum_touch(&sfp_chk, SFP_I2C_ADDR_A2, SFP_CACHE_A2_STATIC_LEN,
+                           SFP_A2_SIZE - SFP_CACHE_A2_STATIC_LEN);
+
+        system_ctrl.a0        = known->a0;
+        system_ctrl.a0_ext    = known->a0_ext;
+        system_ctrl.sfp_class = known->cls;
+        a2_info = known->a2;
+        printf("SFP conhecido %08lX: %lu Hz\n", (unsigned long)fp,
+               (unsigned long)(known->baud ? known->baud : SFP_SPEED_DEFAULT_HZ));
+    } else {
+        /* Velocidade por dispositivo: A0h verificado por CC_BASE, A2h segue o A0h.
+           EEPROM marcada como só 100 kHz fica na velocidade padrão. */
+        uint32_t sfp_hz = 0;
+        if (!(vendor.quirks & SFP_QUIRK_I2C_STD_ONLY))
+            sfp_hz = sfp_speed_negotiate_eeprom(&sfp_bus, SFP_I2C_ADDR_A0);
+        if (sfp_hz)
+            sfp_speed_set(&sfp_speed, SFP_I2C_ADDR_A2, sfp_hz);
+        printf("SFP novo %08lX: %lu Hz\n", (unsigned long)fp,
+               (unsigned long)(sfp_hz ? sfp_hz : SFP_SPEED_DEFAULT_HZ));
+
+        /*Buffer cru(raw) da EEPROM A2H: imagem completa lida uma vez (regiões estáticas)*/
+        ok = sfp_read_block(
+            &sfp_bus,
+            SFP_I2C_ADDR_A2,
+            0x00,
+            a2_live,
+            SFP_A2_SIZE
+        );
+        if (!ok) {
+            printf("ERRO: Falha na leitura do A2h\n");
+            return false;
+        }
+        sfp_checksum_touch(&sfp_chk, SFP_I2C_ADDR_A2, 0, SFP_A2_SIZE);
+
+        /* Bytes 0-95: Base + Extended ID numa passada; A2h 0-39: limiares */
+        memset(&system_ctrl.a0, 0, sizeof(system_ctrl.a0));
+        memset(&system_ctrl.a0_ext, 0, sizeof(system_ctrl.a0_ext));
+        sfp_parse_a0_all(a0_base_data, &system_ctrl.a0, &system_ctrl.a0_ext);
+        sfp_classify(&system_ctrl.a0, &system_ctrl.sfp_class);
+        memset(&a2_info, 0, sizeof(a2_info));
+        sfp_parse_a2h_thresholds(a2_live, &a2_info);
+
+        sfp_module_cache_entry_t *e = sfp_module_cache_insert(&sfp_cache, fp);
+        e->a0      = system_ctrl.a0;
+        e->a0_ext  = system_ctrl.a0_ext;
+        e->a2      = a2_info;
+        e->has_dmi = check_sfp_a2h_exists(a0_base_data);
+        e->baud    = sfp_hz;
+        e->cls     = system_ctrl.sfp_class;
+        memcpy(e->a2_static, a2_live, SFP_CACHE_A2_STATIC_LEN);
+    }
+    sfp_a2_dynamic_window(&a2_dyn_offset, &a2_dyn_length);
+    sfp_checksum_check();
+    update_sfp_vendor();
+    update_sfp_class();
+    printf("Modulo: %s\n", system_ctrl.sfp_class.text);
+    sfp_plan_polling(system_ctrl.sfp_class.rate_mbd);
+
+    const sfp_dmi_snapshot_t *snap = sfp_dmi_publish(&sfp_dmi, a2_live + SFP_DMI_OFFSET, time_us_64());
+    a2_info.rx_power = snap->rx_power;
+    float rx_wm = sfp_a2h_get_rx_power(&a2_info);
+    float rx_dbm = sfp_a2h_get_rx_power_dbm(&a2_info);
+
+    printf("O VALOR RX: %.2f\n",rx_wm);
+    printf("o VALOR RX_DBM: %.2f\n",rx_dbm);
+
+    return true;
+}
+
+/**
+ * @brief Esquece o módulo removido
+ *
+ * Zera A0h decodificado e classificação; update_sfp_vendor() e
+ * update_sfp_class() passam o menu de volta para "N/A".
+ */
+static void sfp_unload_module(void)
+{
+    memset(&system_ctrl.a0, 0, sizeof(system_ctrl.a0));
+    memset(&system_ctrl.a0_ext, 0, sizeof(system_ctrl.a0_ext));
+    memset(&system_ctrl.sfp_class, 0, sizeof(system_ctrl.sfp_class));
+    update_sfp_vendor();
+    update_sfp_class();
+}
+
 /**
  * @brief Ponto de entrada principal do programa
  * 
@@ -31,6 +448,10 @@
 int main(void) {
     // Inicialização do sistema
     stdio_init_all();
+    sfp_trace_init(&i2c_trace, true);
+    ssd1306_SetTrace(&i2c_trace);
+    sfp_stats_init(&i2c_stats);
+    ssd1306_SetStats(&i2c_stats);
     ssd1306_Init();
     joystickPi_init();
 
@@ -42,81 +463,43 @@ int main(void) {
         I2C_PORT,
         I2C_SDA,
         I2C_SCL,
-        100 * 1000
-    );
-    
-    /* Buffer cru(raw) da EEPROM A0h */
-    uint8_t a0_base_data[SFP_A0_SIZE] = {0};
-    
-     bool ok = sfp_read_block(
-        I2C_PORT,
-        SFP_I2C_ADDR_A0,
-        0x00,
-        a0_base_data,
-        SFP_A0_SIZE
+        SFP_SPEED_DEFAULT_HZ
     );
-    
-     if (!ok) {
-        //printf("ERRO: Falha na leitura do A0h\n");
-        while (1);
-    }
-    /*Buffer cru(raw) da EEPROM A2H*/
-     uint8_t a2_data[SFP_A2_SIZE];
+    sfp_i2c_transport_init(&sfp_bus, I2C_PORT);
 
-     ok = sfp_read_block(
-        I2C_PORT,
-        SFP_I2C_ADDR_A2,
-        0x00,
-        a2_data,
-        SFP_A2_SIZE
-    );
-     if(!ok){
-       while(1);
-     }
-
-     sfp_a2h_t a2;
-     sfp_parse_a2h_rx_power(a2_data,&a2);
-     float rx_wm = sfp_a2h_get_rx_power(&a2); 
-     float rx_dbm = sfp_a2h_get_rx_power_dbm(&a2);
+    sfp_speed_init(&sfp_speed, SFP_SPEED_DEFAULT_HZ);
+    sfp_retry_init(&sfp_retry);
+    sfp_bus.speed = &sfp_speed;
+    sfp_bus.retry = &sfp_retry;
+    sfp_bus.trace = &i2c_trace;
+    sfp_bus.stats = &i2c_stats;
 
-     printf("O VALOR RX: %.2f\n",rx_wm);
-     printf("o VALOR RX_DBM: %.2f\n",rx_dbm);
-
- 
- 
+    sfp_i2c_transport_init(&oled_bus, SSD1306_I2C_PORT);
+    sfp_speed_init(&oled_speed, SSD1306_I2C_CLK * 1000);
+    sfp_retry_init(&oled_retry);
+    oled_bus.speed = &oled_speed;
+    oled_bus.retry = &oled_retry;
+    oled_bus.trace = &i2c_trace;
+    oled_bus.stats = &i2c_stats;
+    sfp_speed_negotiate_probe(&oled_bus, SSD1306_I2C_ADDR, SSD1306_I2C_CLK * 1000);
 
+    sfp_sched_init(&sched);
+    sfp_module_cache_init(&sfp_cache);
+    sfp_checksum_init(&sfp_chk);
+    sfp_dmi_init(&sfp_dmi, &sfp_bus, SFP_I2C_ADDR_A2, false);
+    sfp_a0_upper_init(&a0_upper, &sfp_bus);
     
     // Inicialização de dados do SFP
     init_sfp_data();
-    
-    /*Colocar Init()*/
-    sfp_parse_a0_base_identifier(a0_base_data, &system_ctrl.a0);
-    
-    /*Byte 3 - 10*/
-    //sfp_read_compliance(a0_base_data,&system_ctrl.a0.cc);
-    //sfp_decode_compliance(&system_ctrl.a0.cc,&system_ctrl.a0.dc);
-    sfp_parse_a0_base_compliance(a0_base_data,&system_ctrl.a0.cc);
-    sfp_a0_decode_compliance(&system_ctrl.a0.cc,&system_ctrl.a0.dc);
-    
-    /*Byte 11*/
-    sfp_parse_a0_base_encoding(a0_base_data,&system_ctrl.a0);
-    
-    /*Byte 12*/
-    sfp_parse_a0_base_nominal_rate(a0_base_data,&system_ctrl.a0);
-    /*Byte 16*/
-    sfp_parse_a0_base_om2(a0_base_data,&system_ctrl.a0);
-    
-    /*Byte 17*/
-    
-    /*Byte 20-35*/
-    sfp_parse_a0_base_vendor_name(a0_base_data,&system_ctrl.a0);
-    
-    /*Byte 36*/
-    sfp_parse_a0_base_ext_compliance(a0_base_data, &system_ctrl.a0);
-    
-    
 
-    
+    /* Leitura do módulo; sem módulo/erro o sistema segue e tenta de novo no laço.
+       O módulo já está energizado há 2 s: a primeira sondagem dispensa t_serial. */
+    sfp_hotplug_init(&sfp_presence, &sfp_bus, SFP_I2C_ADDR_A0, 0);
+    if (sfp_hotplug_poll(&sfp_presence) == SFP_HOTPLUG_INSERTED)
+        sfp_loaded = sfp_load_module();
+    sfp_presence.settle_us = SFP_HOTPLUG_SETTLE_US;
+    sfp_last_load = to_ms_since_boot(get_absolute_time());
+
     // Configuração inicial dos timers
     uint32_t current_time = to_ms_since_boot(get_absolute_time());
     
@@ -137,18 +520,77 @@ int main(void) {
     while (true) {
         // Processa entrada do joystick
         process_joystick_input();
+
+        // Comandos pela USB (dump do trace)
+        usb_console_poll();
         
         // Atualiza dados do sistema
         update_system_data();
+
+        uint32_t now = to_ms_since_boot(get_absolute_time());
+        uint64_t now_us = time_us_64();
+
+        // Presença do módulo: sonda 0x50 só com o barramento SFP ocioso
+        if (!sfp_sched_pending(&a2_req) && !sfp_sched_pending(&a2_alarm_req) &&
+            now - sfp_last_presence > HOTPLUG_POLL_MS) {
+            sfp_last_presence = now;
+
+            switch (sfp_hotplug_poll(&sfp_presence)) {
+            case SFP_HOTPLUG_INSERTED:
+                printf("SFP inserido\n");
+                sfp_loaded = sfp_load_module();
+                sfp_last_load = now;
+                break;
+            case SFP_HOTPLUG_REMOVED:
+                printf("SFP removido\n");
+                sfp_loaded = false;
+                sfp_unload_module();
+                a2_poll_fails = 0;
+                break;
+            default:
+                break;
+            }
+        }
+
+        // Módulo presente com falha de leitura: nova tentativa periódica
+        if (sfp_presence.present && !sfp_loaded &&
+            now - sfp_last_load > SFP_LOAD_RETRY_MS) {
+            sfp_loaded = sfp_load_module();
+            sfp_last_load = now;
+        }
+
+        // Status/flags do A2h: prioridade crítica, passa à frente das páginas do OLED
+        if (sfp_loaded && !sfp_sched_pending(&a2_alarm_req) &&
+            now - a2_last_alarm_poll > a2_alarm_period_ms) {
+            if (sfp_sched_submit_read(&sched, &a2_alarm_req, &sfp_bus, SFP_I2C_ADDR_A2,
+                                      SFP_A2_ALARM_OFFSET, a2_live + SFP_A2_ALARM_OFFSET,
+                                      SFP_A2_ALARM_LEN, SFP_SCHED_PRIO_CRITICAL,
+                                      now_us + a2_alarm_period_ms * 1000u, on_a2_alarm, NULL))
+                a2_last_alarm_poll = now;
+        }
+
+        // Diagnósticos A2h: relê apenas a janela dinâmica (96-119)
+        if (sfp_loaded && a2_dyn_length && !sfp_sched_pending(&a2_req) &&
+            now - a2_last_refresh > DATA_UPDATE_INTERVAL_MS) {
+            if (sfp_sched_submit_read(&sched, &a2_req, &sfp_bus, SFP_I2C_ADDR_A2,
+                                      a2_dyn_offset, a2_live + a2_dyn_offset, a2_dyn_length,
+                                      SFP_SCHED_PRIO_NORMAL,
+                                      now_us + DATA_UPDATE_INTERVAL_MS * 1000u,
+                                      on_a2_refresh, NULL))
+                a2_last_refresh = now;
+        }
         
         // Renderiza tela atual
         render_current_screen();
         
-        // Atualiza display
-        ssd1306_UpdateScreen();
+        // Atualiza display: páginas alteradas entram na fila como BULK
+        oled_submit_frame(now_us + FRAME_PERIOD_MS * 1000u);
+
+        // Executa as transações pendentes dos dois barramentos
+        sfp_sched_run(&sched, SCHED_BUDGET_US);
         
         // Pequena pausa para controle de atualização
-        sleep_ms(50);
+        sleep_ms(FRAME_PERIOD_MS);
     }
     
     return 0;
@@ -16,19 +16,6 @@ SystemControl system_ctrl = {
 };
 
 // ==================== DADOS ESTÁTICOS ====================
-static const char* FABRICANTES[] = {
-    "CISCO", "JUNIPER", "HUAWEI", "FINISAR", "AVAGO",
-    "INTEL", "BROADCOM", "DELL", "HP", "ARISTA"
-};
-
-static const char* TIPOS_MODULO[] = {
-    "SFP-10G-SR", "SFP-10G-LR", "FP-10G-ER", "SFP-10G-ZR",
-    "SFP-28G-SR", "SFP-28G-LR", "SFP+ 10G", "QSFP-40G-SR4",
-    "QSFP-100G-SR4", "QSFP-DD-400G"
-};
-
-static const uint16_t COMPRIMENTOS_ONDA[] = {850, 1310, 1490, 1550, 1310, 1550};
-static const uint16_t DISTANCIAS_MAX[] = {300, 10000, 40000, 100, 2000, 8000};
 static const char SERIAL_NUMBERS[][12] = {
     "FNS12345678", "JNP87654321", "HWE11223344", "FIN55667788",
     "AVG99887766", "INT33445566", "BRD22334455", "DEL77889900",
@@ -38,7 +25,10 @@ static const char SERIAL_NUMBERS[][12] = {
 // ==================== FUNÇÕES AUXILIARES ====================
 
 /**
- * @brief Inicializa dados do módulo SFP com valores aleatórios realistas
+ * @brief Inicializa dados do módulo SFP
+ *
+ * Fabricante, tipo, taxa, comprimento de onda e alcance vêm do módulo lido
+ * (update_sfp_vendor() e update_sfp_class()); o restante ainda é simulado.
  */
 void init_sfp_data(void) {
     uint32_t seed = to_ms_since_boot(get_absolute_time());
@@ -46,14 +36,12 @@ void init_sfp_data(void) {
     
     int idx;
     
-    // Fabricante
-    idx = rand() % (sizeof(FABRICANTES) / sizeof(FABRICANTES[0]));
-    strncpy(system_ctrl.sfp_data.fabricante, FABRICANTES[idx], 
+    // Fabricante: preenchido por update_sfp_vendor() ao ler o módulo
+    strncpy(system_ctrl.sfp_data.fabricante, "N/A",
             sizeof(system_ctrl.sfp_data.fabricante) - 1);
     
-    // Tipo de módulo
-    idx = rand() % (sizeof(TIPOS_MODULO) / sizeof(TIPOS_MODULO[0]));
-    strncpy(system_ctrl.sfp_data.tipo, TIPOS_MODULO[idx],
+    // Tipo de módulo: preenchido por update_sfp_class() ao ler o módulo
+    strncpy(system_ctrl.sfp_data.tipo, "N/A",
             sizeof(system_ctrl.sfp_data.tipo) - 1);
     
     // Número de série
@@ -61,14 +49,6 @@ void init_sfp_data(void) {
     strncpy(system_ctrl.sfp_data.serial, SERIAL_NUMBERS[idx],
             sizeof(system_ctrl.sfp_data.serial) - 1);
     
-    // Comprimento de onda
-    idx = rand() % (sizeof(COMPRIMENTOS_ONDA) / sizeof(COMPRIMENTOS_ONDA[0]));
-    system_ctrl.sfp_data.comprimento_onda = COMPRIMENTOS_ONDA[idx];
-    
-    // Distância máxima
-    idx = rand() % (sizeof(DISTANCIAS_MAX) / sizeof(DISTANCIAS_MAX[0]));
-    system_ctrl.sfp_data.distancia_max = DISTANCIAS_MAX[idx];
-    
     // Valores iniciais de operação
     system_ctrl.sfp_data.temperatura = 35.0f + (rand() % 100) / 10.0f;
     system_ctrl.sfp_data.tensao = 3.2f + (rand() % 150) / 100.0f;
@@ -76,21 +56,44 @@ void init_sfp_data(void) {
     system_ctrl.sfp_data.potencia_rx = -3.0f - (rand() % 40) / 10.0f;
     system_ctrl.sfp_data.corrente_bias = 30.0f + (rand() % 400) / 10.0f;
     system_ctrl.sfp_data.alarmes_ativos = rand() % 4;
-    
-    // Determina taxa de dados baseada no tipo
-    if (strstr(system_ctrl.sfp_data.tipo, "10G") != NULL) {
-        system_ctrl.sfp_data.taxa_dados = 10;
-    } else if (strstr(system_ctrl.sfp_data.tipo, "28G") != NULL) {
-        system_ctrl.sfp_data.taxa_dados = 28;
-    } else if (strstr(system_ctrl.sfp_data.tipo, "40G") != NULL) {
-        system_ctrl.sfp_data.taxa_dados = 40;
-    } else if (strstr(system_ctrl.sfp_data.tipo, "100G") != NULL) {
-        system_ctrl.sfp_data.taxa_dados = 100;
-    } else if (strstr(system_ctrl.sfp_data.tipo, "400G") != NULL) {
-        system_ctrl.sfp_data.taxa_dados = 400;
-    } else {
-        system_ctrl.sfp_data.taxa_dados = 1;
+}
+
+/**
+ * @brief Fabricante do módulo lido (system_ctrl.a0)
+ *
+ * Nome canônico da base de fabricantes (OUI + Vendor PN); OUI desconhecida
+ * cai no Vendor Name do A0h.
+ */
+void update_sfp_vendor(void) {
+    sfp_vendor_info_t v;
+    char name[SFP_A0_LEN_VENDOR_NAME + 1];
+    const char *s = "N/A";
+
+    if (sfp_vendor_lookup_a0(&system_ctrl.a0, &v)) {
+        s = v.vendor;
+    } else if (sfp_a0_get_vendor_name(&system_ctrl.a0, name)) {
+        s = name;
     }
+
+    strncpy(system_ctrl.sfp_data.fabricante, s, sizeof(system_ctrl.sfp_data.fabricante) - 1);
+    system_ctrl.sfp_data.fabricante[sizeof(system_ctrl.sfp_data.fabricante) - 1] = '\0';
+}
+
+/**
+ * @brief Classificação do módulo lido (system_ctrl.sfp_class)
+ *
+ * Calculada uma vez por inserção; aqui só os campos exibidos pelo menu.
+ */
+void update_sfp_class(void) {
+    const sfp_class_t *c = &system_ctrl.sfp_class;
+
+    strncpy(system_ctrl.sfp_data.tipo, c->standard ? c->standard : "N/A",
+            sizeof(system_ctrl.sfp_data.tipo) - 1);
+    system_ctrl.sfp_data.tipo[sizeof(system_ctrl.sfp_data.tipo) - 1] = '\0';
+
+    system_ctrl.sfp_data.taxa_dados = (uint16_t)(c->rate_mbd / 1000);
+    system_ctrl.sfp_data.comprimento_onda = c->wavelength_nm;
+    system_ctrl.sfp_data.distancia_max = (c->reach_m > UINT16_MAX) ? UINT16_MAX : (uint16_t)c->reach_m;
 }
 
 /**
@@ -113,9 +116,8 @@ void update_sfp_data(void) {
     if (system_ctrl.sfp_data.tensao < 3.0f) system_ctrl.sfp_data.tensao = 3.0f;
     if (system_ctrl.sfp_data.tensao > 3.6f) system_ctrl.sfp_data.tensao = 3.6f;
     
-    // Variações de potência e corrente
+    // Variações de potência e corrente (RX vem medido do A2h, ver on_a2_refresh)
     system_ctrl.sfp_data.potencia_tx += ((rand() % 5) - 2) * 0.1f;
-    system_ctrl.sfp_data.potencia_rx += ((rand() % 5) - 2) * 0.1f;
     system_ctrl.sfp_data.corrente_bias += ((rand() % 5) - 2) * 0.1f;
     
     // Geração ocasional de alarmes
@@ -458,8 +460,10 @@ void draw_dados_info_screen(void) {
              system_ctrl.a0.vendor_name);
     snprintf(info_items[1], sizeof(info_items[1]), "MODELO: %s", 
              system_ctrl.sfp_data.tipo);
-    snprintf(info_items[2], sizeof(info_items[2]), "SERIAL: %s", 
-             system_ctrl.sfp_data.serial);
+    char vendor_sn[SFP_A0_LEN_VENDOR_SN + 1];
+    if (!sfp_a0_get_vendor_sn(&system_ctrl.a0_ext, vendor_sn))
+        strcpy(vendor_sn, "N/A");
+    snprintf(info_items[2], sizeof(info_items[2]), "SERIAL: %s", vendor_sn); /*Bytes 68-83*/
     //snprintf(info_items[3], sizeof(info_items[3]), "TAXA DADOS: %d Gbps", system_ctrl.sfp_data.taxa_dados);
     
     snprintf(info_items[3], sizeof(info_items[3]), "Ext.Spec: %s", ext_compliance_to_string(system_ctrl.a0.ext_compliance)); /*Byte 36*/
@@ -881,331 +885,3 @@ void render_current_screen(void) {
             break;
     }
 }
-
-// ====================== STRING DO SFP/SFP+ =====================================
-
-
-const char* ext_compliance_to_string(sfp_extended_spec_compliance_code_t code) {
-    switch (code) {
-        case EXT_SPEC_COMPLIANCE_UNSPECIFIED:
-            return "NaoEspecificado";
-        case EXT_SPEC_COMPLIANCE_100G_AOC_OR_25GAUI_C2M_AOC_BER_5E_5:
-            return "100G AOC ou 25GAUI C2M AOC (BER 5e-5)";
-        case EXT_SPEC_COMPLIANCE_100GBASE_SR4_OR_25GBASE_SR:
-            return "100GBASE-SR4 ou 25GBASE-SR";
-        case EXT_SPEC_COMPLIANCE_100GBASE_LR4_OR_25GBASE_LR:
-            return "100GBASE-LR4 ou 25GBASE-LR";
-        case EXT_SPEC_COMPLIANCE_100GBASE_ER4_OR_25GBASE_ER:
-            return "100GBASE-ER4 ou 25GBASE-ER";
-        case EXT_SPEC_COMPLIANCE_100GBASE_SR10:
-            return "100GBASE-SR10";
-        case EXT_SPEC_COMPLIANCE_100G_CWDM4:
-            return "100G CWDM4";
-        case EXT_SPEC_COMPLIANCE_100G_PSM4:
-            return "100G PSM4";
-        case EXT_SPEC_COMPLIANCE_100G_ACC_OR_25GAUI_C2M_ACC_BER_5E_5:
-            return "100G ACC ou 25GAUI C2M ACC (BER 5e-5)";
-        case EXT_SPEC_COMPLIANCE_100GBASE_CR4_OR_25GBASE_CR_CA_25G_L_OR_50GBASE_CR2_RS_FEC:
-            return "100GBASE-CR4, 25GBASE-CR CA-25G-L ou 50GBASE-CR2 RS-FEC";
-        case EXT_SPEC_COMPLIANCE_25GBASE_CR_CA_25G_S_OR_50GBASE_CR2_BASE_R_FEC:
-            return "25GBASE-CR CA-25G-S ou 50GBASE-CR2 BASE-R FEC";
-        case EXT_SPEC_COMPLIANCE_25GBASE_CR_CA_25G_N_OR_50GBASE_CR2_NO_FEC:
-            return "25GBASE-CR CA-25G-N ou 50GBASE-CR2 NO-FEC";
-        case EXT_SPEC_COMPLIANCE_10MB_SINGLE_PAIR_ETHERNET:
-            return "10Mb Single Pair Ethernet";
-        case EXT_SPEC_COMPLIANCE_40GBASE_ER4:
-            return "40GBASE-ER4";
-        case EXT_SPEC_COMPLIANCE_4X_10GBASE_SR:
-            return "4x10GBASE-SR";
-        case EXT_SPEC_COMPLIANCE_40G_PSM4:
-            return "40G PSM4";
-        case EXT_SPEC_COMPLIANCE_10GBASE_T_SFI:
-            return "10GBASE-T SFI";
-        case EXT_SPEC_COMPLIANCE_100G_CLR4:
-            return "100G CLR4";
-        case EXT_SPEC_COMPLIANCE_100G_AOC_OR_25GAUI_C2M_AOC_BER_1E_12:
-            return "100G AOC ou 25GAUI C2M AOC (BER 1e-12)";
-        case EXT_SPEC_COMPLIANCE_100G_ACC_OR_25GAUI_C2M_ACC_BER_1E_12:
-            return "100G ACC ou 25GAUI C2M ACC (BER 1e-12)";
-        case EXT_SPEC_COMPLIANCE_10GBASE_T_SHORT_REACH:
-            return "10GBASE-T Short Reach";
-        case EXT_SPEC_COMPLIANCE_5GBASE_T:
-            return "5GBASE-T";
-        case EXT_SPEC_COMPLIANCE_2_5GBASE_T:
-            return "2.5GBASE-T";
-        case EXT_SPEC_COMPLIANCE_40G_SWDM4:
-            return "40G SWDM4";
-        case EXT_SPEC_COMPLIANCE_100G_SWDM4:
-            return "100G SWDM4";
-        case EXT_SPEC_COMPLIANCE_100G_PAM4_BIDI:
-            return "100G PAM4 BiDi";
-        case EXT_SPEC_COMPLIANCE_100GBASE_DR_CAUI4_NO_FEC:
-            return "100GBASE-DR (CAUI-4 NO FEC)";
-        case EXT_SPEC_COMPLIANCE_100G_FR_OR_100GBASE_FR1_CAUI4_NO_FEC:
-            return "100G-FR/100GBASE-FR1 (CAUI-4 NO FEC)";
-        case EXT_SPEC_COMPLIANCE_100G_LR_OR_100GBASE_LR1_CAUI4_NO_FEC:
-            return "100G-LR/100GBASE-LR1 (CAUI-4 NO FEC)";
-        case EXT_SPEC_COMPLIANCE_100GBASE_SR1_CAUI4_NO_FEC:
-            return "100GBASE-SR1 (CAUI-4 NO FEC)";
-        case EXT_SPEC_COMPLIANCE_100GBASE_SR1_OR_200GBASE_SR2_OR_400GBASE_SR4:
-            return "100GBASE-SR1, 200GBASE-SR2 ou 400GBASE-SR4";
-        case EXT_SPEC_COMPLIANCE_100GBASE_FR1_OR_400GBASE_DR4_2:
-            return "100GBASE-FR1 ou 400GBASE-DR4";
-        case EXT_SPEC_COMPLIANCE_100GBASE_LR1:
-            return "100GBASE-LR1";
-        case EXT_SPEC_COMPLIANCE_ACTIVE_CU_CABLE_50GAUI_100GAUI2_200GAUI4_C2M_BER_1E_6:
-            return "Active Copper Cable (50GAUI/100GAUI-2/200GAUI-4 C2M BER 1e-6)";
-        case EXT_SPEC_COMPLIANCE_ACTIVE_OPTICAL_CABLE_50GAUI_100GAUI2_200GAUI4_C2M_BER_1E_6:
-            return "Active Optical Cable (50GAUI/100GAUI-2/200GAUI-4 C2M BER 1e-6)";
-        case EXT_SPEC_COMPLIANCE_100GBASE_CR1_OR_200GBASE_CR2_OR_400GBASE_CR4:
-            return "100GBASE-CR1, 200GBASE-CR2 ou 400GBASE-CR4";
-        case EXT_SPEC_COMPLIANCE_50GBASE_CR_OR_100GBASE_CR2_OR_200GBASE_CR4:
-            return "50GBASE-CR, 100GBASE-CR2 ou 200GBASE-CR4";
-        case EXT_SPEC_COMPLIANCE_50GBASE_R_OR_100GBASE_SR2_OR_200GBASE_SR4:
-            return "50GBASE-R, 100GBASE-SR2 ou 200GBASE-SR4";
-        case EXT_SPEC_COMPLIANCE_50GBASE_FR_OR_200GBASE_DR4:
-            return "50GBASE-FR ou 200GBASE-DR4";
-        case EXT_SPEC_COMPLIANCE_200GBASE_FR4:
-            return "200GBASE-FR4";
-        case EXT_SPEC_COMPLIANCE_50GBASE_LR:
-            return "50GBASE-LR";
-        case EXT_SPEC_COMPLIANCE_200GBASE_LR4:
-            return "200GBASE-LR4";
-        case EXT_SPEC_COMPLIANCE_400GBASE_DR4_400GAUI4_C2M:
-            return "400GBASE-DR4 (400GAUI-4 C2M)";
-        case EXT_SPEC_COMPLIANCE_400GBASE_FR4:
-            return "400GBASE-FR4";
-        case EXT_SPEC_COMPLIANCE_400GBASE_LR4_6:
-            return "400GBASE-LR4-6";
-        case EXT_SPEC_COMPLIANCE_400G_LR4_10:
-            return "400G LR4-10";
-        case EXT_SPEC_COMPLIANCE_256GFC_SW4:
-            return "256GFC SW4";
-        case EXT_SPEC_COMPLIANCE_64GFC:
-            return "64GFC";
-        case EXT_SPEC_COMPLIANCE_128GFC:
-            return "128GFC";
-        case EXT_SPEC_COMPLIANCE_VENDOR_SPECIFIC:
-            return "Específico do fabricante";
-        default:
-            if (code >= 0x4D && code <= 0x7E) {
-                return "Reservado (SFF-8024)";
-            } else if (code >= 0x82 && code <= 0xFE) {
-                return "Reservado (SFF-8024)";
-            }
-            return "Código desconhecido";
-    }
-}
-
-const char* sfp_identifier_to_string(sfp_identifier_t id) {
-    switch (id) {
-        case SFP_ID_GBIC:
-            return "GBIC";
-        case SFP_ID_SFP:
-            return "SFP/SFP+";
-        case SFP_ID_QSFP:
-            return "QSFP";
-        case SFP_ID_QSFP_PLUS:
-            return "QSFP+";
-        case SFP_ID_QSFP28:
-            return "QSFP28";
-        case SFP_ID_UNKNOWN:
-        default:
-            return "Desconhecido";
-    }
-}
-
-const char* sfp_compliance_byte3_to_string(const sfp_compliance_decoded_t *c) {
-    if (!c) return "Estrutura inválida";
-    
-    static char buffer[512];
-    buffer[0] = '\0';
-    
-    if (c->eth_10g_base_er)  strcat(buffer, "  - 10GBASE-ER\n");
-    if (c->eth_10g_base_lrm) strcat(buffer, "  - 10GBASE-LRM\n");
-    if (c->eth_10g_base_lr)  strcat(buffer, "  - 10GBASE-LR\n");
-    if (c->eth_10g_base_sr)  strcat(buffer, "  - 10GBASE-SR\n");
-    
-    if (c->infiniband_1x_sx)             strcat(buffer, "  - InfiniBand 1X SX\n");
-    if (c->infiniband_1x_lx)             strcat(buffer, "  - InfiniBand 1X LX\n");
-    if (c->infiniband_1x_copper_active)  strcat(buffer, "  - InfiniBand 1X Copper Active\n");
-    if (c->infiniband_1x_copper_passive) strcat(buffer, "  - InfiniBand 1X Copper Passive\n");
-    
-    if (buffer[0] == '\0') return "Nenhum código ativo";
-    return buffer;
-}
-
-const char* sfp_compliance_byte4_to_string(const sfp_compliance_decoded_t *c) {
-    if (!c) return "Estrutura inválida";
-    
-    static char buffer[512];
-    buffer[0] = '\0';
-    
-    if (c->escon_mmf)   strcat(buffer, "  - ESCON MMF\n");
-    if (c->escon_smf)   strcat(buffer, "  - ESCON SMF\n");
-    if (c->oc_192_sr)   strcat(buffer, "  - OC-192 SR\n");
-    if (c->sonet_rs_1)  strcat(buffer, "  - SONET RS-1\n");
-    if (c->sonet_rs_2)  strcat(buffer, "  - SONET RS-2\n");
-    if (c->oc_48_lr)    strcat(buffer, "  - OC-48 LR\n");
-    if (c->oc_48_ir)    strcat(buffer, "  - OC-48 IR\n");
-    if (c->oc_48_sr)    strcat(buffer, "  - OC-48 SR\n");
-    
-    if (buffer[0] == '\0') return "Nenhum código ativo";
-    return buffer;
-}
-
-const char* sfp_compliance_byte5_to_string(const sfp_compliance_decoded_t *c) {
-    if (!c) return "Estrutura inválida";
-    
-    static char buffer[512];
-    buffer[0] = '\0';
-    
-    if (c->oc_12_sm_lr) strcat(buffer, "  - OC-12 SM LR\n");
-    if (c->oc_12_sm_ir) strcat(buffer, "  - OC-12 SM IR\n");
-    if (c->oc_12_sr)    strcat(buffer, "  - OC-12 SR\n");
-    if (c->oc_3_sm_lr)  strcat(buffer, "  - OC-3 SM LR\n");
-    if (c->oc_3_sm_ir)  strcat(buffer, "  - OC-3 SM IR\n");
-    if (c->oc_3_sr)     strcat(buffer, "  - OC-3 SR\n");
-    
-    if (buffer[0] == '\0') return "Nenhum código ativo";
-    return buffer;
-}
-
-const char* sfp_compliance_byte6_to_string(const sfp_compliance_decoded_t *c) {
-    if (!c) return "Estrutura inválida";
-    
-    static char buffer[512];
-    buffer[0] = '\0';
-    
-    if (c->eth_base_px)      strcat(buffer, "  - BASE-PX\n");
-    if (c->eth_base_bx_10)   strcat(buffer, "  - BASE-BX10\n");
-    if (c->eth_100_base_fx)  strcat(buffer, "  - 100BASE-FX\n");
-    if (c->eth_100_base_lx)  strcat(buffer, "  - 100BASE-LX\n");
-    if (c->eth_1000_base_t)  strcat(buffer, "  - 1000BASE-T\n");
-    if (c->eth_1000_base_cx) strcat(buffer, "  - 1000BASE-CX\n");
-    if (c->eth_1000_base_lx) strcat(buffer, "  - 1000BASE-LX\n");
-    if (c->eth_1000_base_sx) strcat(buffer, "  - 1000BASE-SX\n");
-    
-    if (buffer[0] == '\0') return "Nenhum código ativo";
-    return buffer;
-}
-
-const char* sfp_compliance_byte7_to_string(const sfp_compliance_decoded_t *c) {
-    if (!c) return "Estrutura inválida";
-    
-    static char buffer[512];
-    buffer[0] = '\0';
-    
-    if (c->fc_very_long_distance)      strcat(buffer, "  - Very Long Distance\n");
-    if (c->fc_short_distance)          strcat(buffer, "  - Short Distance\n");
-    if (c->fc_intermediate_distance)   strcat(buffer, "  - Intermediate Distance\n");
-    if (c->fc_long_distance)           strcat(buffer, "  - Long Distance\n");
-    if (c->fc_medium_distance)         strcat(buffer, "  - Medium Distance\n");
-    if (c->shortwave_laser_sa)         strcat(buffer, "  - Shortwave Laser (SA)\n");
-    if (c->longwave_laser_lc)          strcat(buffer, "  - Longwave Laser (LC)\n");
-    if (c->electrical_inter_enclosure) strcat(buffer, "  - Electrical Inter-Enclosure\n");
-    
-    if (buffer[0] == '\0') return "Nenhum código ativo";
-    return buffer;
-}
-
-const char* sfp_compliance_byte8_to_string(const sfp_compliance_decoded_t *c) {
-    if (!c) return "Estrutura inválida";
-    
-    static char buffer[512];
-    buffer[0] = '\0';
-    
-    if (c->electrical_intra_enclosure) strcat(buffer, "  - Electrical Intra-Enclosure\n");
-    if (c->shortwave_laser_sn)         strcat(buffer, "  - Shortwave Laser (SN)\n");
-    if (c->shortwave_laser_sl)         strcat(buffer, "  - Shortwave Laser (SL)\n");
-    if (c->longwave_laser_ll)          strcat(buffer, "  - Longwave Laser (LL)\n");
-    if (c->active_cable)               strcat(buffer, "  - Active SFP+ Cable\n");
-    if (c->passive_cable)              strcat(buffer, "  - Passive SFP+ Cable\n");
-    
-    if (buffer[0] == '\0') return "Nenhum código ativo";
-    return buffer;
-}
-
-const char* sfp_compliance_byte9_to_string(const sfp_compliance_decoded_t *c) {
-    if (!c) return "Estrutura inválida";
-    
-    static char buffer[512];
-    buffer[0] = '\0';
-    
-    if (c->twin_axial_pair) strcat(buffer, "  - Twin Axial Pair\n");
-    if (c->twisted_pair)    strcat(buffer, "  - Twisted Pair\n");
-    if (c->miniature_coax)  strcat(buffer, "  - Miniature Coax\n");
-    if (c->video_coax)      strcat(buffer, "  - Video Coax\n");
-    if (c->multimode_m6)    strcat(buffer, "  - Multimode 62.5 µm\n");
-    if (c->multimode_m5)    strcat(buffer, "  - Multimode 50 µm\n");
-    if (c->single_mode)     strcat(buffer, "  - Single Mode\n");
-    
-    if (buffer[0] == '\0') return "Nenhum código ativo";
-    return buffer;
-}
-
-const char* sfp_compliance_byte10_to_string(const sfp_compliance_decoded_t *c) {
-    if (!c) return "Estrutura inválida";
-    
-    static char buffer[512];
-    buffer[0] = '\0';
-    
-    if (c->cs_1200_mbps) strcat(buffer, "  - 1200 Mbps\n");
-    if (c->cs_800_mbps)  strcat(buffer, "  - 800 Mbps\n");
-    if (c->cs_1600_mbps) strcat(buffer, "  - 1600 Mbps\n");
-    if (c->cs_400_mbps)  strcat(buffer, "  - 400 Mbps\n");
-    if (c->cs_3200_mbps) strcat(buffer, "  - 3200 Mbps\n");
-    if (c->cs_200_mbps)  strcat(buffer, "  - 200 Mbps\n");
-    if (c->cs_100_mbps)  strcat(buffer, "  - 100 Mbps\n");
-    
-    if (buffer[0] == '\0') return "Nenhum código ativo";
-    return buffer;
-}
-
-const char* sfp_encoding_to_string(sfp_encoding_codes_t encoding) {
-    static char unknown_buffer[50];
-    switch ((uint8_t)encoding) {
-        case SFP_ENC_UNSPECIFIED:
-            return "Unspecified";
-        case SFP_ENC_8B_10B:
-            return "8B/10B";
-        case SFP_ENC_4B_5B:
-            return "4B/5B";
-        case SFP_ENC_NRZ:
-            return "NRZ";
-        case SFP_ENC_MANCHESTER:
-            return "Manchester";
-        case SFP_ENC_SONET_SCRAMBLED:
-            return "SONET Scrambled";
-        case SFP_ENC_64B_66B:
-            return "64B/66B";
-        case SFP_ENC_256B_257B:
-            return "256B/257B";
-        case SFP_ENC_PAM4:
-            return "PAM4";
-        default:
-            // Para códigos reservados/desconhecidos, não podemos retornar uma string estática porque precisamos do valor.
-            // Vamos usar um buffer estático para formatar a string.
-            snprintf(unknown_buffer, sizeof(unknown_buffer), "Reserved(0x%02X)", (uint8_t)encoding);
-            return unknown_buffer;
-    }
-}
-
-const char* sfp_om2_to_string(sfp_om2_length_status_t om2_status, uint16_t om2_length_m) {
-    static char buffer[100];  // Buffer estático para armazenar a string
-    
-    switch (om2_status) {
-        case SFP_OM2_LEN_VALID:
-            snprintf(buffer, sizeof(buffer), "%u metros", om2_length_m);
-            return buffer;
-            
-        case SFP_OM2_LEN_EXTENDED:
-            snprintf(buffer, sizeof(buffer), "Extendido");
-            return buffer;
-            
-        case SFP_OM2_LEN_NOT_SUPPORTED:
-        default:
-            return "Nao Suportado";
-    }
-}
-
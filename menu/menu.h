@@ -10,6 +10,9 @@
 #include "ssd1306/ssd1306_fonts.h"
 #include "joystick/JoystickPi.h"
 #include "sfp_8472/a0h.h"
+#include "sfp_8472/vendor_db.h"
+#include "sfp_8472/classify.h"
+#include "menu/sfp_strings.h"
 
 // ==================== DEFINIÇÕES GERAIS ====================
 #define DISPLAY_WIDTH 128
@@ -80,6 +83,8 @@ typedef struct {
     uint32_t last_data_update;
     SFP_Data sfp_data;
     sfp_a0h_base_t a0;
+    sfp_a0h_extended_t a0_ext;
+    sfp_class_t sfp_class;
     bool joystick_enabled;
     uint8_t scroll_position;
 } SystemControl;
@@ -89,6 +94,8 @@ typedef struct {
 // Funções de inicialização
 void init_sfp_data(void);
 void update_sfp_data(void);
+void update_sfp_vendor(void);
+void update_sfp_class(void);
 
 // Funções de desenho
 void draw_header(const char* title);
@@ -113,25 +120,5 @@ void update_system_data(void);
 void render_current_screen(void);
 
 
-//String do SFP(Converte informação do Módulo a0h para string)
-const char* ext_compliance_to_string(sfp_extended_spec_compliance_code_t code);
-const char* sfp_identifier_to_string(sfp_identifier_t id);
-const char* sfp_compliance_byte3_to_string(const sfp_compliance_decoded_t *c);
-const char* sfp_compliance_byte4_to_string(const sfp_compliance_decoded_t *c);
-const char* sfp_compliance_byte5_to_string(const sfp_compliance_decoded_t *c);
-const char* sfp_compliance_byte6_to_string(const sfp_compliance_decoded_t *c);
-const char* sfp_compliance_byte7_to_string(const sfp_compliance_decoded_t *c);
-const char* sfp_compliance_byte8_to_string(const sfp_compliance_decoded_t *c);
-const char* sfp_compliance_byte9_to_string(const sfp_compliance_decoded_t *c);
-const char* sfp_compliance_byte10_to_string(const sfp_compliance_decoded_t *c);
-const char* sfp_encoding_to_string(sfp_encoding_codes_t encoding);
-const char* sfp_om2_to_string(sfp_om2_length_status_t om2_status,uint16_t om2_length_m);
-
-
-
-
-
-
-
 extern SystemControl system_ctrl;
 #endif // MENU_SFP_H
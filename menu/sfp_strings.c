@@ -0,0 +1,111 @@
+/**
+ * @file sfp_strings.c
+ * @brief Textos dos campos do A0h exibidos no menu
+ *
+ * @details
+ *  Separado de menu.c para não depender do display nem do Pico SDK:
+ *  as ferramentas de host (tools/) ligam este arquivo diretamente.
+ *  Os códigos SFF-8024 usam as tabelas de sfp_8472/sff8024.h.
+ */
+
+#include <stdio.h>
+#include "sfp_strings.h"
+#include "sfp_8472/sff8024.h"
+
+const char* ext_compliance_to_string(sfp_extended_spec_compliance_code_t code) {
+    return sfp_ext_compliance_name((uint8_t)code);
+}
+
+const char* sfp_identifier_to_string(sfp_identifier_t id) {
+    return sfp_identifier_name((uint8_t)id);
+}
+
+/* Lista os códigos ativos de um byte (3-10) do bitset, do bit 7 ao 0 */
+static const char* compliance_byte_to_string(const sfp_compliance_decoded_t *c, uint8_t byte,
+                                             char *buffer, size_t size) {
+    if (!c) return "Estrutura inválida";
+
+    uint8_t bits = sfp_cc_byte(c, byte);
+    size_t len = 0;
+
+    buffer[0] = '\0';
+    for (int bit = 7; bit >= 0 && bits; bit--) {
+        if (!(bits & (1u << bit)))
+            continue;
+
+        const char *name = sfp_compliance_bit_name((sfp_compliance_bit_t)SFP_CC_BIT(byte, bit));
+        if (!name)
+            continue;
+
+        int n = snprintf(buffer + len, size - len, "  - %s\n", name);
+        if (n < 0 || (size_t)n >= size - len)
+            break;
+        len += (size_t)n;
+    }
+
+    if (buffer[0] == '\0') return "Nenhum código ativo";
+    return buffer;
+}
+
+const char* sfp_compliance_byte3_to_string(const sfp_compliance_decoded_t *c) {
+    static char buffer[512];
+    return compliance_byte_to_string(c, 3, buffer, sizeof(buffer));
+}
+
+const char* sfp_compliance_byte4_to_string(const sfp_compliance_decoded_t *c) {
+    static char buffer[512];
+    return compliance_byte_to_string(c, 4, buffer, sizeof(buffer));
+}
+
+const char* sfp_compliance_byte5_to_string(const sfp_compliance_decoded_t *c) {
+    static char buffer[512];
+    return compliance_byte_to_string(c, 5, buffer, sizeof(buffer));
+}
+
+const char* sfp_compliance_byte6_to_string(const sfp_compliance_decoded_t *c) {
+    static char buffer[512];
+    return compliance_byte_to_string(c, 6, buffer, sizeof(buffer));
+}
+
+const char* sfp_compliance_byte7_to_string(const sfp_compliance_decoded_t *c) {
+    static char buffer[512];
+    return compliance_byte_to_string(c, 7, buffer, sizeof(buffer));
+}
+
+const char* sfp_compliance_byte8_to_string(const sfp_compliance_decoded_t *c) {
+    static char buffer[512];
+    return compliance_byte_to_string(c, 8, buffer, sizeof(buffer));
+}
+
+const char* sfp_compliance_byte9_to_string(const sfp_compliance_decoded_t *c) {
+    static char buffer[512];
+    return compliance_byte_to_string(c, 9, buffer, sizeof(buffer));
+}
+
+const char* sfp_compliance_byte10_to_string(const sfp_compliance_decoded_t *c) {
+    static char buffer[512];
+    return compliance_byte_to_string(c, 10, buffer, sizeof(buffer));
+}
+
+const char* sfp_encoding_to_string(sfp_encoding_codes_t encoding) {
+    return sfp_encoding_name((uint8_t)encoding);
+}
+
+const char* sfp_om2_to_string(sfp_om2_length_status_t om2_status, uint16_t om2_length_m) {
+    static char buffer[100];  // Buffer estático para armazenar a string
+    
+    switch (om2_status) {
+        case SFP_OM2_LEN_VALID:
+            snprintf(buffer, sizeof(buffer), "%u metros", om2_length_m);
+            return buffer;
+            
+        case SFP_OM2_LEN_EXTENDED:
+            snprintf(buffer, sizeof(buffer), "Extendido");
+            return buffer;
+            
+        case SFP_OM2_LEN_NOT_SUPPORTED:
+        default:
+            return "Nao Suportado";
+    }
+}
+
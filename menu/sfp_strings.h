@@ -0,0 +1,22 @@
+#ifndef MENU_SFP_STRINGS_H
+#define MENU_SFP_STRINGS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sfp_8472/a0h.h"
+
+//String do SFP(Converte informação do Módulo a0h para string)
+const char* ext_compliance_to_string(sfp_extended_spec_compliance_code_t code);
+const char* sfp_identifier_to_string(sfp_identifier_t id);
+const char* sfp_compliance_byte3_to_string(const sfp_compliance_decoded_t *c);
+const char* sfp_compliance_byte4_to_string(const sfp_compliance_decoded_t *c);
+const char* sfp_compliance_byte5_to_string(const sfp_compliance_decoded_t *c);
+const char* sfp_compliance_byte6_to_string(const sfp_compliance_decoded_t *c);
+const char* sfp_compliance_byte7_to_string(const sfp_compliance_decoded_t *c);
+const char* sfp_compliance_byte8_to_string(const sfp_compliance_decoded_t *c);
+const char* sfp_compliance_byte9_to_string(const sfp_compliance_decoded_t *c);
+const char* sfp_compliance_byte10_to_string(const sfp_compliance_decoded_t *c);
+const char* sfp_encoding_to_string(sfp_encoding_codes_t encoding);
+const char* sfp_om2_to_string(sfp_om2_length_status_t om2_status,uint16_t om2_length_m);
+
+#endif // MENU_SFP_STRINGS_H
@@ -0,0 +1,264 @@
+/**
+ * @file a0_view.h
+ * @brief Visão sem cópia sobre a imagem crua do A0h
+ *
+ * @details
+ *  sfp_a0_view_t só aponta para os bytes lidos da EEPROM; cada acessor
+ *  decodifica o campo no momento da leitura com os mesmos núcleos usados
+ *  pelos parsers de a0h.c (a0h_decode.h), então status e unidades são
+ *  os dos getters de sfp_a0h_base_t. Nada é copiado nem alargado: quem
+ *  guarda só a imagem crua (ex.: a tabela de gaiolas) paga apenas pelos
+ *  campos que exibe.
+ *
+ *  A imagem precisa cobrir os bytes 0-95 (Base ID + Extended ID) e
+ *  continuar válida enquanto a visão for usada. Os textos (vendor name,
+ *  PN, rev, SN) são copiados sob demanda para um buffer do chamador, já
+ *  sem o padding de espaços.
+ */
+
+#ifndef SFP_A0_VIEW_H
+#define SFP_A0_VIEW_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "defs.h"
+#include "a0h.h"
+#include "a0h_decode.h"
+#include "checksum.h"
+
+/** @brief Bytes do A0h lidos pela visão (0-95) */
+#define SFP_A0_VIEW_LEN     (A0_CC_EXT + 1)
+
+/** @brief Maior campo de texto do A0h (vendor name/PN/SN) + '\0' */
+#define SFP_A0_VIEW_TEXT_MAX 17
+
+typedef struct {
+    const uint8_t *raw;
+} sfp_a0_view_t;
+
+static inline sfp_a0_view_t sfp_a0_view(const uint8_t *a0_data)
+{
+    return (sfp_a0_view_t){ .raw = a0_data };
+}
+
+static inline bool sfp_a0v_valid(sfp_a0_view_t v)
+{
+    return v.raw != NULL;
+}
+
+/* ============================================
+ * Bytes 0-11 — Identificação e compliance
+ * ============================================ */
+static inline sfp_identifier_t sfp_a0v_identifier(sfp_a0_view_t v)
+{
+    return (sfp_identifier_t)v.raw[A0_IDENTIFIER];
+}
+
+static inline uint8_t sfp_a0v_ext_identifier(sfp_a0_view_t v)
+{
+    return v.raw[A0_EXT_IDENTIFIER];
+}
+
+static inline sfp_connector_type_t sfp_a0v_connector(sfp_a0_view_t v)
+{
+    return (sfp_connector_type_t)v.raw[A0_CONNECTOR];
+}
+
+/* Um código de compliance testado direto no byte de origem */
+static inline bool sfp_a0v_has(sfp_a0_view_t v, sfp_compliance_bit_t b)
+{
+    return (v.raw[A0_TRANSCEIVER + (b >> 3)] & (1u << (b & 7))) != 0;
+}
+
+/* Bytes 3-10 como bitset, para consultas por grupo (SFP_CC_MASK_*) */
+static inline sfp_compliance_decoded_t sfp_a0v_compliance(sfp_a0_view_t v)
+{
+    return (sfp_compliance_decoded_t){ .bits = sfp_a0d_compliance(v.raw) };
+}
+
+static inline sfp_variant_t sfp_a0v_variant(sfp_a0_view_t v)
+{
+    return sfp_a0d_variant(v.raw);
+}
+
+static inline bool sfp_a0v_is_copper(sfp_a0_view_t v)
+{
+    return sfp_a0d_is_copper(v.raw);
+}
+
+static inline sfp_encoding_codes_t sfp_a0v_encoding(sfp_a0_view_t v)
+{
+    return (sfp_encoding_codes_t)v.raw[A0_ENCODING];
+}
+
+/* ============================================
+ * Bytes 12-19 — Taxa e alcances
+ * ============================================ */
+static inline void sfp_a0v_rate(sfp_a0_view_t v, sfp_rate_t *rate)
+{
+    sfp_rate_decode(v.raw[A0_BR_NOMINAL], v.raw[A0_BR_MAX], v.raw[A0_BR_MIN], rate);
+}
+
+static inline uint32_t sfp_a0v_nominal_rate_mbd(sfp_a0_view_t v, sfp_nominal_rate_status_t *status)
+{
+    sfp_rate_t r;
+
+    sfp_a0v_rate(v, &r);
+    if (status)
+        *status = r.status;
+    return r.nominal_mbd;
+}
+
+static inline sfp_rate_select sfp_a0v_rate_identifier(sfp_a0_view_t v)
+{
+    return (sfp_rate_select)v.raw[A0_RATE_IDENTIFIER];
+}
+
+/* Byte 14: km (fibra) ou 0,5 dB/100m (cobre) */
+static inline uint16_t sfp_a0v_smf_length_km(sfp_a0_view_t v, sfp_smf_length_status_t *status)
+{
+    return sfp_a0d_smf_km(v.raw, status);
+}
+
+/* Byte 15: unidades de 100 m (fibra) ou valor direto (cobre) */
+static inline uint16_t sfp_a0v_smf_length_m(sfp_a0_view_t v, sfp_smf_length_status_t *status)
+{
+    return sfp_a0d_smf_m(v.raw, status);
+}
+
+static inline uint16_t sfp_a0v_om2_length_m(sfp_a0_view_t v, sfp_om2_length_status_t *status)
+{
+    return sfp_a0d_om2(v.raw, status);
+}
+
+static inline uint16_t sfp_a0v_om1_length_m(sfp_a0_view_t v, sfp_om1_length_status_t *status)
+{
+    return sfp_a0d_om1(v.raw, status);
+}
+
+/* Byte 18: OM4 em 10 m ou cabo de cobre em 1 m */
+static inline uint16_t sfp_a0v_om4_or_copper_length_m(sfp_a0_view_t v, sfp_om4_length_status_t *status)
+{
+    return sfp_a0d_om4_or_copper(v.raw, status);
+}
+
+/* Byte 19: OM3 em 10 m ou, em cobre, 6 bits de base e 2 de multiplicador */
+static inline uint32_t sfp_a0v_om3_or_cable_length_m(sfp_a0_view_t v, sfp_om3_length_status_t *status)
+{
+    return sfp_a0d_om3_or_cable(v.raw, status);
+}
+
+/* ============================================
+ * Bytes 20-63 — Fornecedor e mídia
+ * ============================================ */
+
+/* Copia o texto ASCII do campo sem o padding de espaços; out precisa de len + 1 bytes */
+static inline size_t sfp_a0v_text(sfp_a0_view_t v, uint8_t offset, uint8_t len, char *out)
+{
+    len = sfp_a0d_text_len(&v.raw[offset], len);
+
+    memcpy(out, &v.raw[offset], len);
+    out[len] = '\0';
+    return len;
+}
+
+/* Vendor name: ASCII imprimível, alinhado à esquerda, não vazio */
+static inline bool sfp_a0v_vendor_name_is_valid(sfp_a0_view_t v)
+{
+    return sfp_a0d_vendor_name_is_valid(&v.raw[A0_VENDOR_NAME]);
+}
+
+static inline bool sfp_a0v_vendor_name(sfp_a0_view_t v, char out[SFP_A0_VIEW_TEXT_MAX])
+{
+    out[0] = '\0';
+    if (!sfp_a0v_vendor_name_is_valid(v))
+        return false;
+
+    sfp_a0v_text(v, A0_VENDOR_NAME, SFP_A0_LEN_VENDOR_NAME, out);
+    return true;
+}
+
+static inline sfp_extended_spec_compliance_code_t sfp_a0v_ext_compliance(sfp_a0_view_t v)
+{
+    return (sfp_extended_spec_compliance_code_t)v.raw[A0_EXT_TRANSCEIVER];
+}
+
+static inline uint32_t sfp_a0v_vendor_oui(sfp_a0_view_t v)
+{
+    return ((uint32_t)v.raw[A0_VENDOR_OUI] << 16) |
+           ((uint32_t)v.raw[A0_VENDOR_OUI + 1] << 8) |
+           ((uint32_t)v.raw[A0_VENDOR_OUI + 2]);
+}
+
+static inline size_t sfp_a0v_vendor_pn(sfp_a0_view_t v, char out[SFP_A0_VIEW_TEXT_MAX])
+{
+    return sfp_a0v_text(v, A0_VENDOR_PN, A0_VENDOR_REV - A0_VENDOR_PN, out);
+}
+
+static inline size_t sfp_a0v_vendor_rev(sfp_a0_view_t v, char out[SFP_A0_VIEW_TEXT_MAX])
+{
+    return sfp_a0v_text(v, A0_VENDOR_REV, A0_WAVELENGTH - A0_VENDOR_REV, out);
+}
+
+/* Bytes 60-61: só existe para módulos ópticos */
+static inline bool sfp_a0v_wavelength_nm(sfp_a0_view_t v, uint16_t *nm)
+{
+    if (sfp_a0v_variant(v) != SFP_VARIANT_OPTICAL)
+        return false;
+
+    *nm = sfp_a0d_wavelength_nm(v.raw);
+    return true;
+}
+
+/* Byte 60: só existe para cabos (ativo/passivo) */
+static inline bool sfp_a0v_cable_compliance(sfp_a0_view_t v, uint8_t *bits)
+{
+    if (sfp_a0v_variant(v) == SFP_VARIANT_OPTICAL)
+        return false;
+
+    *bits = v.raw[A0_WAVELENGTH];
+    return true;
+}
+
+static inline uint8_t sfp_a0v_fc_speed2(sfp_a0_view_t v)
+{
+    return v.raw[A0_FIBRE_CHANNEL_SPD2];
+}
+
+static inline bool sfp_a0v_cc_base_is_valid(sfp_a0_view_t v)
+{
+    return sfp_checksum_range_ok(SFP_CHK_BASE, v.raw);
+}
+
+/* ============================================
+ * Bytes 64-95 — Extended ID
+ * ============================================ */
+static inline size_t sfp_a0v_vendor_sn(sfp_a0_view_t v, char out[SFP_A0_VIEW_TEXT_MAX])
+{
+    return sfp_a0v_text(v, A0_VENDOR_SN, A0_DATE_CODE - A0_VENDOR_SN, out);
+}
+
+static inline bool sfp_a0v_cc_ext_is_valid(sfp_a0_view_t v)
+{
+    return sfp_checksum_range_ok(SFP_CHK_EXT, v.raw);
+}
+
+static inline bool sfp_a0v_dmi_implemented(sfp_a0_view_t v)
+{
+    return (v.raw[A0_DIAG_MONITORING_TYPE] & (1u << SFP_A0_BIT_DMI_IMPL)) != 0;
+}
+
+static inline bool sfp_a0v_change_addr_req(sfp_a0_view_t v)
+{
+    return (v.raw[A0_DIAG_MONITORING_TYPE] & (1u << SFP_A0_BIT_ADDR_CHANGE_REQ)) != 0;
+}
+
+static inline sfp_cal_type_t sfp_a0v_calibration(sfp_a0_view_t v)
+{
+    return sfp_a0d_calibration(v.raw);
+}
+
+#endif /* SFP_A0_VIEW_H */
@@ -17,7 +17,10 @@
  */
 
 #include "a0h.h"
+#include "a0h_decode.h"
 #include "defs.h"
+#include "checksum.h"
+#include "sff8024.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
@@ -102,44 +105,7 @@ sfp_connector_type_t sfp_a0_get_connector(const sfp_a0h_base_t *a0)
  * ============================================ */
 const char *sfp_connector_to_string(sfp_connector_type_t connector)
 {
-    switch (connector) {
-        case SFP_CONNECTOR_SC:
-            return "SC";
-        case SFP_CONNECTOR_FC_STYLE_1:
-            return "Fibre Channel Style 1";
-        case SFP_CONNECTOR_FC_STYLE_2:
-            return "Fibre Channel Style 2";
-        case SFP_CONNECTOR_BNC_TNC:
-            return "BNC/TNC";
-        case SFP_CONNECTOR_FC_COAX:
-            return "Fibre Channel Coax";
-        case SFP_CONNECTOR_FIBER_JACK:
-            return "Fiber Jack";
-        case SFP_CONNECTOR_LC:
-            return "LC";
-        case SFP_CONNECTOR_MT_RJ:
-            return "MT-RJ";
-        case SFP_CONNECTOR_MU:
-            return "MU";
-        case SFP_CONNECTOR_SG:
-            return "SG";
-        case SFP_CONNECTOR_OPTICAL_PIGTAIL:
-            return "Optical Pigtail";
-        case SFP_CONNECTOR_MPO_1X12:
-            return "MPO 1x12";
-        case SFP_CONNECTOR_MPO_2X16:
-            return "MPO 2x16";
-        case SFP_CONNECTOR_HSSDC_II:
-            return "HSSDC II";
-        case SFP_CONNECTOR_COPPER_PIGTAIL:
-            return "Copper Pigtail";
-        case SFP_CONNECTOR_RJ45:
-            return "RJ45";
-        case SFP_CONNECTOR_NO_SEPARABLE:
-            return "No Separable Connector";
-        default:
-            return "Unknown Connector";
-    }
+    return sfp_connector_name((uint8_t)connector);
 }
 
 /* ============================================
@@ -161,145 +127,99 @@ void sfp_parse_a0_base_compliance(const uint8_t *a0_base_data, sfp_compliance_co
 }
 
 /* ============================================
- * Decode do Byte 3
- * ============================================ */
-static void decode_byte3(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
-{
-    uint8_t b = cc->byte3;
-    out->eth_10g_base_er               = (b & (1 << 7)) != 0;
-    out->eth_10g_base_lrm              = (b & (1 << 6)) != 0;
-    out->eth_10g_base_lr               = (b & (1 << 5)) != 0;
-    out->eth_10g_base_sr               = (b & (1 << 4)) != 0;
-    out->infiniband_1x_sx              = (b & (1 << 3)) != 0;
-    out->infiniband_1x_lx              = (b & (1 << 2)) != 0;
-    out->infiniband_1x_copper_active   = (b & (1 << 1)) != 0;
-    out->infiniband_1x_copper_passive  = (b & (1 << 0)) != 0;
-}
-
-/* ============================================
- * Decode do Byte 4
+ * Decode dos Bytes 3-10
  * ============================================ */
-static void decode_byte4(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
-{
-    uint8_t b = cc->byte4;
-    out->escon_mmf  = (b & (1 << 7)) != 0;
-    out->escon_smf  = (b & (1 << 6)) != 0;
-    out->oc_192_sr  = (b & (1 << 5)) != 0;
-    out->sonet_rs_1 = (b & (1 << 4)) != 0;
-    out->sonet_rs_2 = (b & (1 << 3)) != 0;
-    out->oc_48_lr   = (b & (1 << 2)) != 0;
-    out->oc_48_ir   = (b & (1 << 1)) != 0;
-    out->oc_48_sr   = (b & (1 << 0)) != 0;
-}
 
-/* ============================================
- * Decode do Byte 5
- * ============================================ */
-static void decode_byte5(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
+/* Rótulo de cada bit do bitset; NULL nos bits reservados */
+static const char *const cc_bit_names[SFP_CC_BITS] = {
+    /* Byte 3 */
+    [SFP_CC_ETH_10G_BASE_ER]              = "10GBASE-ER",
+    [SFP_CC_ETH_10G_BASE_LRM]             = "10GBASE-LRM",
+    [SFP_CC_ETH_10G_BASE_LR]              = "10GBASE-LR",
+    [SFP_CC_ETH_10G_BASE_SR]              = "10GBASE-SR",
+    [SFP_CC_INFINIBAND_1X_SX]             = "InfiniBand 1X SX",
+    [SFP_CC_INFINIBAND_1X_LX]             = "InfiniBand 1X LX",
+    [SFP_CC_INFINIBAND_1X_COPPER_ACTIVE]  = "InfiniBand 1X Copper Active",
+    [SFP_CC_INFINIBAND_1X_COPPER_PASSIVE] = "InfiniBand 1X Copper Passive",
+    /* Byte 4 */
+    [SFP_CC_ESCON_MMF]                    = "ESCON MMF",
+    [SFP_CC_ESCON_SMF]                    = "ESCON SMF",
+    [SFP_CC_OC_192_SR]                    = "OC-192 SR",
+    [SFP_CC_SONET_RS_1]                   = "SONET RS-1",
+    [SFP_CC_SONET_RS_2]                   = "SONET RS-2",
+    [SFP_CC_OC_48_LR]                     = "OC-48 LR",
+    [SFP_CC_OC_48_IR]                     = "OC-48 IR",
+    [SFP_CC_OC_48_SR]                     = "OC-48 SR",
+    /* Byte 5 */
+    [SFP_CC_OC_12_SM_LR]                  = "OC-12 SM LR",
+    [SFP_CC_OC_12_SM_IR]                  = "OC-12 SM IR",
+    [SFP_CC_OC_12_SR]                     = "OC-12 SR",
+    [SFP_CC_OC_3_SM_LR]                   = "OC-3 SM LR",
+    [SFP_CC_OC_3_SM_IR]                   = "OC-3 SM IR",
+    [SFP_CC_OC_3_SR]                      = "OC-3 SR",
+    /* Byte 6 */
+    [SFP_CC_ETH_BASE_PX]                  = "BASE-PX",
+    [SFP_CC_ETH_BASE_BX_10]               = "BASE-BX10",
+    [SFP_CC_ETH_100_BASE_FX]              = "100BASE-FX",
+    [SFP_CC_ETH_100_BASE_LX]              = "100BASE-LX",
+    [SFP_CC_ETH_1000_BASE_T]              = "1000BASE-T",
+    [SFP_CC_ETH_1000_BASE_CX]             = "1000BASE-CX",
+    [SFP_CC_ETH_1000_BASE_LX]             = "1000BASE-LX",
+    [SFP_CC_ETH_1000_BASE_SX]             = "1000BASE-SX",
+    /* Byte 7 */
+    [SFP_CC_FC_VERY_LONG_DISTANCE]        = "Very Long Distance",
+    [SFP_CC_FC_SHORT_DISTANCE]            = "Short Distance",
+    [SFP_CC_FC_INTERMEDIATE_DISTANCE]     = "Intermediate Distance",
+    [SFP_CC_FC_LONG_DISTANCE]             = "Long Distance",
+    [SFP_CC_FC_MEDIUM_DISTANCE]           = "Medium Distance",
+    [SFP_CC_SHORTWAVE_LASER_SA]           = "Shortwave Laser (SA)",
+    [SFP_CC_LONGWAVE_LASER_LC]            = "Longwave Laser (LC)",
+    [SFP_CC_ELECTRICAL_INTER_ENCLOSURE]   = "Electrical Inter-Enclosure",
+    /* Byte 8 */
+    [SFP_CC_ELECTRICAL_INTRA_ENCLOSURE]   = "Electrical Intra-Enclosure",
+    [SFP_CC_SHORTWAVE_LASER_SN]           = "Shortwave Laser (SN)",
+    [SFP_CC_SHORTWAVE_LASER_SL]           = "Shortwave Laser (SL)",
+    [SFP_CC_LONGWAVE_LASER_LL]            = "Longwave Laser (LL)",
+    [SFP_CC_ACTIVE_CABLE]                 = "Active SFP+ Cable",
+    [SFP_CC_PASSIVE_CABLE]                = "Passive SFP+ Cable",
+    /* Byte 9 */
+    [SFP_CC_TWIN_AXIAL_PAIR]              = "Twin Axial Pair",
+    [SFP_CC_TWISTED_PAIR]                 = "Twisted Pair",
+    [SFP_CC_MINIATURE_COAX]               = "Miniature Coax",
+    [SFP_CC_VIDEO_COAX]                   = "Video Coax",
+    [SFP_CC_MULTIMODE_M6]                 = "Multimode 62.5 µm",
+    [SFP_CC_MULTIMODE_M5]                 = "Multimode 50 µm",
+    [SFP_CC_SINGLE_MODE]                  = "Single Mode",
+    /* Byte 10 (see_byte_62 só aponta para o byte 62, não é listado) */
+    [SFP_CC_CS_1200_MBPS]                 = "1200 Mbps",
+    [SFP_CC_CS_800_MBPS]                  = "800 Mbps",
+    [SFP_CC_CS_1600_MBPS]                 = "1600 Mbps",
+    [SFP_CC_CS_400_MBPS]                  = "400 Mbps",
+    [SFP_CC_CS_3200_MBPS]                 = "3200 Mbps",
+    [SFP_CC_CS_200_MBPS]                  = "200 Mbps",
+    [SFP_CC_CS_100_MBPS]                  = "100 Mbps",
+};
+
+const char *sfp_compliance_bit_name(sfp_compliance_bit_t b)
 {
-    uint8_t b = cc->byte5;
-    out->oc_12_sm_lr = (b & (1 << 6)) != 0;
-    out->oc_12_sm_ir = (b & (1 << 5)) != 0;
-    out->oc_12_sr    = (b & (1 << 4)) != 0;
-    out->oc_3_sm_lr  = (b & (1 << 2)) != 0;
-    out->oc_3_sm_ir  = (b & (1 << 1)) != 0;
-    out->oc_3_sr     = (b & (1 << 0)) != 0;
+    if ((unsigned)b >= SFP_CC_BITS)
+        return NULL;
+    return cc_bit_names[b];
 }
 
-/* ============================================
- * Decode do Byte 6
- * ============================================ */
-static void decode_byte6(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
-{
-    uint8_t b = cc->byte6;
-    out->eth_base_px      = (b & (1 << 7)) != 0;
-    out->eth_base_bx_10   = (b & (1 << 6)) != 0;
-    out->eth_100_base_fx  = (b & (1 << 5)) != 0;
-    out->eth_100_base_lx  = (b & (1 << 4)) != 0;
-    out->eth_1000_base_t  = (b & (1 << 3)) != 0;
-    out->eth_1000_base_cx = (b & (1 << 2)) != 0;
-    out->eth_1000_base_lx = (b & (1 << 1)) != 0;
-    out->eth_1000_base_sx = (b & (1 << 0)) != 0;
-}
-
-/* ============================================
- * Decode do Byte 7
- * ============================================ */
-static void decode_byte7(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
-{
-    uint8_t b = cc->byte7;
-    out->fc_very_long_distance      = (b & (1 << 7)) != 0;
-    out->fc_short_distance          = (b & (1 << 6)) != 0;
-    out->fc_intermediate_distance   = (b & (1 << 5)) != 0;
-    out->fc_long_distance           = (b & (1 << 4)) != 0;
-    out->fc_medium_distance         = (b & (1 << 3)) != 0;
-    out->shortwave_laser_sa         = (b & (1 << 2)) != 0;
-    out->longwave_laser_lc          = (b & (1 << 1)) != 0;
-    out->electrical_inter_enclosure = (b & (1 << 0)) != 0;
-}
-
-/* ============================================
- * Decode do Byte 8
- * ============================================ */
-static void decode_byte8(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
-{
-    uint8_t b = cc->byte8;
-    out->electrical_intra_enclosure = (b & (1 << 7)) != 0;
-    out->shortwave_laser_sn         = (b & (1 << 6)) != 0;
-    out->shortwave_laser_sl        = (b & (1 << 5)) != 0;
-    out->longwave_laser_ll          = (b & (1 << 4)) != 0;
-    out->active_cable               = (b & (1 << 3)) != 0;
-    out->passive_cable              = (b & (1 << 2)) != 0;
-}
-
-/* ============================================
- * Decode do Byte 9
- * ============================================ */
-static void decode_byte9(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
-{
-    uint8_t b = cc->byte9;
-    out->twin_axial_pair = (b & (1 << 7)) != 0;
-    out->twisted_pair    = (b & (1 << 6)) != 0;
-    out->miniature_coax  = (b & (1 << 5)) != 0;
-    out->video_coax      = (b & (1 << 4)) != 0;
-    out->multimode_m6    = (b & (1 << 3)) != 0;
-    out->multimode_m5    = (b & (1 << 2)) != 0;
-    out->single_mode     = (b & (1 << 0)) != 0;
-}
-
-/* ============================================
- * Decode do Byte 10
- * ============================================ */
-static void decode_byte10(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
-{
-    uint8_t b = cc->byte10;
-    out->cs_1200_mbps = (b & (1 << 7)) != 0;
-    out->cs_800_mbps  = (b & (1 << 6)) != 0;
-    out->cs_1600_mbps = (b & (1 << 5)) != 0;
-    out->cs_400_mbps  = (b & (1 << 4)) != 0;
-    out->cs_3200_mbps = (b & (1 << 3)) != 0;
-    out->cs_200_mbps  = (b & (1 << 2)) != 0;
-    out->see_byte_62  = (b & (1 << 1)) != 0;
-    out->cs_100_mbps  = (b & (1 << 0)) != 0;
-}
-
-/* ============================================
- * Função principal para decodificação de todos os bytes
- * ============================================ */
 void sfp_a0_decode_compliance(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out)
 {
     if (!cc || !out)
         return;
 
-    memset(out, 0, sizeof(*out));
-    decode_byte3(cc, out);
-    decode_byte4(cc, out);
-    decode_byte5(cc, out);
-    decode_byte6(cc, out);
-    decode_byte7(cc, out);
-    decode_byte8(cc, out);
-    decode_byte9(cc, out);
-    decode_byte10(cc, out);
+    out->bits = ((uint64_t)cc->byte3  << SFP_CC_BIT(3, 0))  |
+                ((uint64_t)cc->byte4  << SFP_CC_BIT(4, 0))  |
+                ((uint64_t)cc->byte5  << SFP_CC_BIT(5, 0))  |
+                ((uint64_t)cc->byte6  << SFP_CC_BIT(6, 0))  |
+                ((uint64_t)cc->byte7  << SFP_CC_BIT(7, 0))  |
+                ((uint64_t)cc->byte8  << SFP_CC_BIT(8, 0))  |
+                ((uint64_t)cc->byte9  << SFP_CC_BIT(9, 0))  |
+                ((uint64_t)cc->byte10 << SFP_CC_BIT(10, 0));
 }
 
 /* ============================================
@@ -307,122 +227,29 @@ void sfp_a0_decode_compliance(const sfp_compliance_codes_t *cc, sfp_compliance_d
  * ============================================ */
 void sfp_a0_print_compliance(const sfp_compliance_decoded_t *c)
 {
+    static const char *const titles[] = {
+        "[Byte 3] Ethernet / InfiniBand:",
+        "[Byte 4] ESCON / SONET:",
+        "[Byte 5] SONET:",
+        "[Byte 6] Ethernet:",
+        "[Byte 7] Fibre Channel — Link Length / Technology:",
+        "[Byte 8] Fibre Channel / Cable Technology:",
+        "[Byte 9] Fibre Channel — Transmission Media:",
+        "[Byte 10] Fibre Channel — Speed:",
+    };
+
     if (!c) return;
 
-    /* ==============================
-     * Byte 3 — Ethernet / InfiniBand
-     * ============================== */
-    printf("\n[Byte 3] Ethernet / InfiniBand:\n");
-
-    if (c->eth_10g_base_er)  printf("  - 10GBASE-ER\n");
-    if (c->eth_10g_base_lrm) printf("  - 10GBASE-LRM\n");
-    if (c->eth_10g_base_lr)  printf("  - 10GBASE-LR\n");
-    if (c->eth_10g_base_sr)  printf("  - 10GBASE-SR\n");
-
-    if (c->infiniband_1x_sx)             printf("  - InfiniBand 1X SX\n");
-    if (c->infiniband_1x_lx)             printf("  - InfiniBand 1X LX\n");
-    if (c->infiniband_1x_copper_active)  printf("  - InfiniBand 1X Copper Active\n");
-    if (c->infiniband_1x_copper_passive) printf("  - InfiniBand 1X Copper Passive\n");
-
-    /* ======================
-     * Byte 4 — ESCON / SONET
-     * ====================== */
-    printf("\n[Byte 4] ESCON / SONET:\n");
-
-    if (c->escon_mmf)   printf("  - ESCON MMF\n");
-    if (c->escon_smf)   printf("  - ESCON SMF\n");
-    if (c->oc_192_sr)   printf("  - OC-192 SR\n");
-    if (c->sonet_rs_1)  printf("  - SONET RS-1\n");
-    if (c->sonet_rs_2)  printf("  - SONET RS-2\n");
-    if (c->oc_48_lr)    printf("  - OC-48 LR\n");
-    if (c->oc_48_ir)    printf("  - OC-48 IR\n");
-    if (c->oc_48_sr)    printf("  - OC-48 SR\n");
-
-    /* ======================
-     * Byte 5 — SONET
-     * ====================== */
-    printf("\n[Byte 5] SONET:\n");
-
-    if (c->oc_12_sm_lr) printf("  - OC-12 SM LR\n");
-    if (c->oc_12_sm_ir) printf("  - OC-12 SM IR\n");
-    if (c->oc_12_sr)    printf("  - OC-12 SR\n");
-    if (c->oc_3_sm_lr)  printf("  - OC-3 SM LR\n");
-    if (c->oc_3_sm_ir)  printf("  - OC-3 SM IR\n");
-    if (c->oc_3_sr)     printf("  - OC-3 SR\n");
-
-    /* ======================
-     * Byte 6 — Ethernet
-     * ====================== */
-    printf("\n[Byte 6] Ethernet:\n");
-
-    if (c->eth_base_px)      printf("  - BASE-PX\n");
-    if (c->eth_base_bx_10)   printf("  - BASE-BX10\n");
-    if (c->eth_100_base_fx)  printf("  - 100BASE-FX\n");
-    if (c->eth_100_base_lx)  printf("  - 100BASE-LX\n");
-    if (c->eth_1000_base_t)  printf("  - 1000BASE-T\n");
-    if (c->eth_1000_base_cx) printf("  - 1000BASE-CX\n");
-    if (c->eth_1000_base_lx) printf("  - 1000BASE-LX\n");
-    if (c->eth_1000_base_sx) printf("  - 1000BASE-SX\n");
-
-    /* ====================================
-     * Byte 7 — FC Link Length & Technology
-     * ==================================== */
-    printf("\n[Byte 7] Fibre Channel — Link Length / Technology:\n");
-
-    if (c->fc_very_long_distance)      printf("  - Very Long Distance\n");
-    if (c->fc_short_distance)          printf("  - Short Distance\n");
-    if (c->fc_intermediate_distance)   printf("  - Intermediate Distance\n");
-    if (c->fc_long_distance)           printf("  - Long Distance\n");
-    if (c->fc_medium_distance)         printf("  - Medium Distance\n");
-    if (c->shortwave_laser_sa)          printf("  - Shortwave Laser (SA)\n");
-    if (c->longwave_laser_lc)           printf("  - Longwave Laser (LC)\n");
-    if (c->electrical_inter_enclosure)  printf("  - Electrical Inter-Enclosure\n");
-
-    /* ==============================================
-     * Byte 8 — FC & SFP+ Cable Technology
-     * ============================================== */
-    printf("\n[Byte 8] Fibre Channel / Cable Technology:\n");
-
-    if (c->electrical_intra_enclosure) printf("  - Electrical Intra-Enclosure\n");
-    if (c->shortwave_laser_sn)         printf("  - Shortwave Laser (SN)\n");
-    if (c->shortwave_laser_sl)         printf("  - Shortwave Laser (SL)\n");
-    if (c->longwave_laser_ll)          printf("  - Longwave Laser (LL)\n");
-    if (c->active_cable)               printf("  - Active SFP+ Cable\n");
-    if (c->passive_cable)              printf("  - Passive SFP+ Cable\n");
-
-    /* ==============================
-     * Byte 9 — FC Transmission Media
-     * ============================== */
-    printf("\n[Byte 9] Fibre Channel — Transmission Media:\n");
-
-    if (c->twin_axial_pair) printf("  - Twin Axial Pair\n");
-    if (c->twisted_pair)    printf("  - Twisted Pair\n");
-    if (c->miniature_coax)  printf("  - Miniature Coax\n");
-    if (c->video_coax)      printf("  - Video Coax\n");
-    if (c->multimode_m6)    printf("  - Multimode 62.5 µm\n");
-    if (c->multimode_m5)    printf("  - Multimode 50 µm\n");
-    if (c->single_mode)     printf("  - Single Mode\n");
-
-    /* ==============================
-     * Byte 10 — FC Channel Speed
-     * ============================== */
-    printf("\n[Byte 10] Fibre Channel — Speed:\n");
-
-    if (c->cs_1200_mbps) printf("  - 1200 Mbps\n");
-    if (c->cs_800_mbps)  printf("  - 800 Mbps\n");
-    if (c->cs_1600_mbps) printf("  - 1600 Mbps\n");
-    if (c->cs_400_mbps)  printf("  - 400 Mbps\n");
-    if (c->cs_3200_mbps) printf("  - 3200 Mbps\n");
-    if (c->cs_200_mbps)  printf("  - 200 Mbps\n");
-    if (c->cs_100_mbps)  printf("  - 100 Mbps\n");
-}
+    for (uint8_t byte = 3; byte <= 10; byte++) {
+        printf("\n%s\n", titles[byte - 3]);
 
-/* =========================================================
- * Byte 8 — Natureza física do meio
- * =========================================================*/
-static bool sfp_is_copper(uint8_t byte8)
-{
-    return ((byte8 & (1 << 2)) != 0) || ((byte8 & (1 << 3)) != 0);
+        /* Do bit 7 ao 0, na ordem da tabela da SFF-8472 */
+        for (int bit = 7; bit >= 0; bit--) {
+            sfp_compliance_bit_t b = (sfp_compliance_bit_t)SFP_CC_BIT(byte, bit);
+            if (sfp_cc_has(c, b) && cc_bit_names[b])
+                printf("  - %s\n", cc_bit_names[b]);
+        }
+    }
 }
 
 /* ============================================
@@ -451,67 +278,64 @@ sfp_encoding_codes_t sfp_a0_get_encoding(const sfp_a0h_base_t *a0)
 void sfp_print_encoding(sfp_encoding_codes_t encoding)
 {
     printf("\n[Byte 11] Encoding:\n");
-
-    switch ((uint8_t)encoding) {
-        case SFP_ENC_UNSPECIFIED:
-            printf("  - Unspecified\n");
-            break;
-        case SFP_ENC_8B_10B:
-            printf("  - 8B/10B\n");
-            break;
-        case SFP_ENC_4B_5B:
-            printf("  - 4B/5B\n");
-            break;
-        case SFP_ENC_NRZ:
-            printf("  - NRZ\n");
-            break;
-        case SFP_ENC_MANCHESTER:
-            printf("  - Manchester\n");
-            break;
-        case SFP_ENC_SONET_SCRAMBLED:
-            printf("  - SONET Scrambled\n");
-            break;
-        case SFP_ENC_64B_66B:
-            printf("  - 64B/66B\n");
-            break;
-        case SFP_ENC_256B_257B:
-            printf("  - 256B/257B\n");
-            break;
-        case SFP_ENC_PAM4:
-            printf("  - PAM4\n");
-            break;
-        default:
-            printf("  - Reserved / Unknown Code (0x%02X)\n", (uint8_t)encoding);
-            break;
-    }
+    printf("  - %s (0x%02X)\n", sfp_encoding_name((uint8_t)encoding), (uint8_t)encoding);
 }
 
 /* ============================================
  * Byte 12 — Signaling Rate, Nominal
+ *
+ * A taxa só fica completa com os bytes 66-67: com o byte 12 = FFh a
+ * nominal vem do byte 66 (250 MBd) e o byte 67 passa a ser a margem
+ * simétrica; caso contrário 66/67 são as margens superior/inferior.
  * ============================================ */
-void sfp_parse_a0_base_nominal_rate(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+static uint32_t rate_scale(uint32_t mbd, uint8_t percent, bool up)
 {
-    if (!a0_base_data || !a0)
+    if (up)
+        return mbd * (100u + percent) / 100u;
+    return percent >= 100u ? 0 : mbd * (100u - percent) / 100u;
+}
+
+void sfp_rate_decode(uint8_t br_nominal, uint8_t br_max, uint8_t br_min, sfp_rate_t *rate)
+{
+    if (!rate)
         return;
 
-    /* Byte 12 — Signaling Rate, Nominal (somente leitura crua do bloco base) */
-    uint8_t raw = a0_base_data[SFP_A0_BYTE_NOMINAL_RATE];
-    if (raw == SFP_NOMINAL_RATE_RAW_UNSPECIFIED) {
-        a0->nominal_rate_status = SFP_NOMINAL_RATE_NOT_SPECIFIED;
-        a0->nominal_rate = 0;
-    } else if (raw == SFP_NOMINAL_RATE_RAW_EXTENDED) {
-        a0->nominal_rate_status = SFP_NOMINAL_RATE_EXTENDED;
-        a0->nominal_rate = 25400;
+    uint8_t up = br_max, down = br_min;
+
+    if (br_nominal == SFP_NOMINAL_RATE_RAW_UNSPECIFIED) {
+        rate->status      = SFP_NOMINAL_RATE_NOT_SPECIFIED;
+        rate->nominal_mbd = 0;
+    } else if (br_nominal == SFP_NOMINAL_RATE_RAW_EXTENDED) {
+        rate->status      = SFP_NOMINAL_RATE_EXTENDED;
+        rate->nominal_mbd = (uint32_t)br_max * SFP_NOMINAL_RATE_EXT_UNIT_MBD;
+        up = br_min;
     } else {
-        a0->nominal_rate_status = SFP_NOMINAL_RATE_VALID;
-        a0->nominal_rate = (uint32_t)raw * 100;
+        rate->status      = SFP_NOMINAL_RATE_VALID;
+        rate->nominal_mbd = (uint32_t)br_nominal * SFP_NOMINAL_RATE_RAW_UNIT_MBD;
     }
+
+    rate->max_mbd = rate_scale(rate->nominal_mbd, up, true);
+    rate->min_mbd = rate_scale(rate->nominal_mbd, down, false);
+}
+
+static void a0_nominal_rate(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    sfp_rate_decode(a0_base_data[SFP_A0_BYTE_NOMINAL_RATE],
+                    a0_base_data[A0_BR_MAX], a0_base_data[A0_BR_MIN], &a0->rate);
+}
+
+void sfp_parse_a0_base_nominal_rate(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    if (!a0_base_data || !a0)
+        return;
+
+    a0_nominal_rate(a0_base_data, a0);
 }
 
 /* ============================================
  * Método Getter
  * ============================================ */
-uint8_t sfp_a0_get_nominal_rate_mbd(const sfp_a0h_base_t *a0, sfp_nominal_rate_status_t *status)
+uint32_t sfp_a0_get_nominal_rate_mbd(const sfp_a0h_base_t *a0, sfp_nominal_rate_status_t *status)
 {
     if (!a0) {
         if (status)
@@ -520,8 +344,17 @@ uint8_t sfp_a0_get_nominal_rate_mbd(const sfp_a0h_base_t *a0, sfp_nominal_rate_s
     }
 
     if (status)
-        *status = a0->nominal_rate_status;
-    return a0->nominal_rate;
+        *status = a0->rate.status;
+    return a0->rate.nominal_mbd;
+}
+
+bool sfp_a0_get_rate(const sfp_a0h_base_t *a0, sfp_rate_t *rate)
+{
+    if (!a0 || !rate)
+        return false;
+
+    *rate = a0->rate;
+    return rate->status != SFP_NOMINAL_RATE_NOT_SPECIFIED;
 }
 
 /* ============================================
@@ -561,56 +394,17 @@ sfp_rate_select sfp_a0_get_rate_identifier(const sfp_a0h_base_t *a0)
  *    0xFF: Valor superior ao máximo representável (> 254 km ou > 127 dB/100m)
  * =========================================================*/
 
+static void a0_smf_km(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    a0->smf_length_km = sfp_a0d_smf_km(a0_base_data, &a0->smf_status_km);
+}
+
 void sfp_parse_a0_base_smf_km(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
     if (!a0_base_data || !a0)
         return;
 
-    uint8_t raw = a0_base_data[A0_LENGTH_SMF_KM];
-
-    uint8_t byte8 = a0_base_data[A0_TRANSCEIVER + 5];
-
-    bool is_copper = sfp_is_copper(byte8);
-
-    /*
-     * Fluxo Principal + Secundários
-     */
-    if (raw == 0x00) {
-        /*
-         * Fluxo Secundário 2 (caso 00h):
-         * Não há informação explícita de alcance SMF ou atenuação de cobre.
-         */
-        a0->smf_status_km   = SFP_SMF_LEN_NOT_SUPPORTED;
-        a0->smf_length_km = 0;
-    }
-    else if (raw == 0xFF) {
-        /*
-         * Fluxo Secundário (caso FFh):
-         * Comprimento/Atenuação superior ao máximo nominal representável.
-         *
-         * - Fibra SMF: alcance > 254 km
-         * - Cabo de cobre: atenuação > 127 dB/100m
-         *
-         * O valor armazenado representa o limite inferior/superior conhecido.
-         */
-        a0->smf_status_km   = SFP_SMF_LEN_EXTENDED;
-
-        if (is_copper)
-            a0->smf_length_km = 254; /* 254 * 0.5 = 127 dB/100m */
-        else
-            a0->smf_length_km = 254; /* 254 km */
-    }
-    else {
-        /*
-         * Fluxo Principal:
-         * Valor válido (01h–FEh)
-         *
-         * - Fibra SMF: unidade de 1 km (valor direto)
-         * - Cabo de cobre: unidade de 0.5 dB/100m (valor * 0.5)
-         */
-        a0->smf_status_km   = SFP_SMF_LEN_VALID;
-        a0->smf_length_km = (uint16_t)raw;
-    }
+    a0_smf_km(a0_base_data, a0);
 }
 
 /* ============================================
@@ -632,33 +426,17 @@ uint16_t sfp_a0_get_smf_length_km(const sfp_a0h_base_t *a0, sfp_smf_length_statu
 /* =========================================================
  * Byte 15 — Length (SMF) or Attenuation (Copper) (Units 100m)
  * =========================================================*/
+static void a0_smf_m(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    a0->smf_length_m = sfp_a0d_smf_m(a0_base_data, &a0->smf_status_m);
+}
+
 void sfp_parse_a0_base_smf_m(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
     if (!a0_base_data || !a0)
         return;
 
-    uint8_t raw = a0_base_data[A0_LENGTH_SMF_100M];
-
-    uint8_t byte8 = a0_base_data[A0_TRANSCEIVER + 5];
-
-    bool is_copper = sfp_is_copper(byte8);
-
-    if (raw == 0x00) {
-        a0->smf_status_m = SFP_SMF_LEN_NOT_SUPPORTED;
-        a0->smf_length_m = 0;
-    }
-    else if (raw == 0xFF) {
-        a0->smf_status_m = SFP_SMF_LEN_EXTENDED;
-
-        a0->smf_length_m = 2540;
-    }
-    else {
-        if (is_copper)
-            a0->smf_length_m = raw;
-        else
-            a0->smf_length_m = raw * 100;
-        a0->smf_status_m = SFP_SMF_LEN_VALID;
-    }
+    a0_smf_m(a0_base_data, a0);
 }
 
 /* ============================================
@@ -679,41 +457,17 @@ uint16_t sfp_a0_get_smf_length_m(const sfp_a0h_base_t *a0, sfp_smf_length_status
 /* ============================================
  * Byte 16 — OM2 Length (50 µm)
  * ============================================ */
+static void a0_om2(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    a0->om2_length_m = sfp_a0d_om2(a0_base_data, &a0->om2_status);
+}
+
 void sfp_parse_a0_base_om2(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
     if (!a0_base_data || !a0)
         return;
 
-    uint8_t raw = a0_base_data[A0_LENGTH_OM2_10M];
-
-    /*
-     * Fluxo Principal + Secundários
-     */
-    if (raw == 0x00) {
-        /*
-         * Fluxo Secundário 2 (caso 00h):
-         * Não suportado ou deve ser determinado por outros meios.
-         */
-        a0->om2_status   = SFP_OM2_LEN_NOT_SUPPORTED;
-        a0->om2_length_m = 0;
-    }
-    else if (raw == 0xFF) {
-        /*
-         * Fluxo Secundário 2 (caso FFh):
-         * Alcance > 2.54 km.
-         */
-        a0->om2_status   = SFP_OM2_LEN_EXTENDED;
-        a0->om2_length_m = 2540; /* Limite inferior conhecido (254 * 10) */
-    }
-    else {
-        /*
-         * Fluxo Principal:
-         * Valor válido (01h–FEh)
-         * Unidade: 10 metros
-         */
-        a0->om2_status   = SFP_OM2_LEN_VALID;
-        a0->om2_length_m = (uint16_t)raw * 10;
-    }
+    a0_om2(a0_base_data, a0);
 }
 
 /* ============================================
@@ -734,43 +488,17 @@ uint16_t sfp_a0_get_om2_length_m(const sfp_a0h_base_t *a0, sfp_om2_length_status
 /* ============================================
  * Byte 17 — OM1 Length (62.5 µm)
  * ============================================ */
+static void a0_om1(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    a0->om1_length_m = sfp_a0d_om1(a0_base_data, &a0->om1_status);
+}
+
 void sfp_parse_a0_base_om1(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
     if (!a0_base_data || !a0)
         return;
 
-    uint8_t raw = a0_base_data[A0_LENGTH_OM1_10M];
-
-    /*
-     * Fluxo Principal + Secundários
-     */
-    if (raw == 0x00) {
-        /*
-         * Fluxo Secundário 2 (caso 00h):
-         * Não há informação explícita de alcance OM1.
-         * Inferência futura via bytes 3–10.
-         */
-        a0->om1_status   = SFP_OM1_LEN_NOT_SUPPORTED;
-        a0->om1_length_m = 0;
-    }
-    else if (raw == 0xFF) {
-        /*
-         * Fluxo Secundário 2 (caso FFh):
-         * Alcance superior ao máximo nominal do campo.
-         * Representa > 2,54 km.
-         */
-        a0->om1_status   = SFP_OM1_LEN_EXTENDED;
-        a0->om1_length_m = 2540; /* Limite inferior conhecido */
-    }
-    else {
-        /*
-         * Fluxo Principal / Secundário 1:
-         * Valor válido (01h–FEh)
-         * Unidade: 10 metros
-         */
-        a0->om1_status   = SFP_OM1_LEN_VALID;
-        a0->om1_length_m = (uint16_t)raw * 10;
-    }
+    a0_om1(a0_base_data, a0);
 }
 
 /* ============================================
@@ -791,61 +519,17 @@ uint16_t sfp_a0_get_om1_length_m(const sfp_a0h_base_t *a0, sfp_om1_length_status
 /* ============================================
  * Byte 18 — OM4 or Copper Cable Length
  * ============================================ */
+static void a0_om4_or_copper(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    a0->om4_or_copper_length_m = sfp_a0d_om4_or_copper(a0_base_data, &a0->om4_or_copper_status);
+}
+
 void sfp_parse_a0_base_om4_or_copper(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
     if (!a0_base_data || !a0)
         return;
 
-    uint8_t raw_length = a0_base_data[A0_LENGTH_OM4_10M];
-
-    uint8_t byte8 = a0_base_data[A0_TRANSCEIVER + 5];
-
-    bool is_copper = sfp_is_copper(byte8);
-
-    /*
-     * Fluxo Principal + Secundários
-     */
-    if (raw_length == 0x00) {
-        /*
-         * Fluxo Secundário 2 (caso 00h):
-         * Não há informação explícita de comprimento de OM4 ou o cobre sem informação válida.
-         */
-        a0->om4_or_copper_status = SFP_OM4_LEN_NOT_SUPPORTED;
-        a0->om4_or_copper_length_m = 0;
-    }
-    else if (raw_length == 0xFF) {
-        /*
-         * Fluxo Secundário (caso FFh):
-         * Comprimento superior ao máximo nominal representável
-         * pelo campo.
-         *
-         * - Cabo de cobre: comprimento > 254 m
-         * - OM4: comprimento > 2,54 km
-         *
-         * O valor armazenado representa o limite inferior conhecido.
-         */
-        a0->om4_or_copper_status = SFP_OM4_LEN_EXTENDED;
-
-        if (is_copper)
-            a0->om4_or_copper_length_m = 254;
-        else
-            a0->om4_or_copper_length_m = 2540;
-    }
-    else {
-        /*
-         * Fluxo Principal:
-         * Valor válido (01h–FEh)
-         *
-         * - OM4: unidades de 10 metros
-         * - Cabo de cobre: unidades de 1 metro
-         */
-        a0->om4_or_copper_status = SFP_OM4_LEN_VALID;
-
-        if (is_copper)
-            a0->om4_or_copper_length_m = raw_length;
-        else
-            a0->om4_or_copper_length_m = (uint16_t)raw_length * 10;
-    }
+    a0_om4_or_copper(a0_base_data, a0);
 }
 
 /* ============================================
@@ -866,41 +550,17 @@ uint16_t sfp_a0_get_om4_copper_or_length_m(const sfp_a0h_base_t *a0, sfp_om4_len
 /* ============================================
  * Byte 19 — OM3 or Optical/Cable Physical Interconnect Length
  * ============================================ */
+static void a0_om3_or_cable(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    a0->om3_or_cable_length_m = sfp_a0d_om3_or_cable(a0_base_data, &a0->om3_or_cable_status);
+}
+
 void sfp_parse_a0_base_om3_or_cable(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
     if (!a0_base_data || !a0)
         return;
 
-    uint8_t raw = a0_base_data[A0_LENGTH_OM3_10M];
-    uint8_t byte8 = a0_base_data[A0_TRANSCEIVER + 5];
-    bool is_copper = sfp_is_copper(byte8);
-
-    if (!is_copper) {
-        if (raw == 0x00) {
-            a0->om3_or_cable_status = SFP_OM3_LEN_NOT_SUPPORTED;
-            a0->om3_or_cable_length_m = 0;
-        } else if (raw == 0xFF) {
-            a0->om3_or_cable_status = SFP_OM3_LEN_EXTENDED;
-            a0->om3_or_cable_length_m = 2540;
-        } else {
-            a0->om3_or_cable_status = SFP_OM3_LEN_VALID;
-            a0->om3_or_cable_length_m = raw * 10;
-        }
-    } else {
-        uint8_t multiplier_bits = (raw >> 6) & 0x03;
-        uint8_t base_length = raw & 0x3F;
-        float multiplier = 1.0f;
-
-        switch (multiplier_bits) {
-            case 0: multiplier = 0.1f;  break;
-            case 1: multiplier = 1.0f;  break;
-            case 2: multiplier = 10.0f; break;
-            case 3: multiplier = 100.0f; break;
-        }
-
-        a0->om3_or_cable_status = SFP_OM3_LEN_VALID;
-        a0->om3_or_cable_length_m = base_length * multiplier;
-    }
+    a0_om3_or_cable(a0_base_data, a0);
 }
 
 /* ============================================
@@ -929,33 +589,11 @@ static bool sfp_is_printable_ascii(uint8_t c)
     return (c >= 0x20u) && (c <= 0x7Eu);
 }
 
-static bool sfp_a0_vendor_name_is_valid(const sfp_a0h_base_t *a0)
+static void a0_vendor_name(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
-    if (!a0)
-        return false;
-
-    bool found_padding = false;
-    bool has_content = false;
-
-    /* Todos os bytes devem ser ASCII imprimível */
-    for (size_t i = 0; i < SFP_A0_LEN_VENDOR_NAME; i++) {
-        uint8_t c = (uint8_t)a0->vendor_name[i];
-        if (!sfp_is_printable_ascii(c))
-            return false;
-
-        if (c == 0x20u) {
-            found_padding = true;
-            continue;
-        }
-
-        if (found_padding)
-            return false;
-
-        has_content = true;
-    }
-
-    /* Não pode ser vazio (todos espaços) */
-    return has_content;
+    /* Vendor Name (16 bytes) - ASCII, alinhado a esquerda, padding com 0x20 */
+    memcpy(a0->vendor_name, &a0_base_data[SFP_A0_BYTE_VENDOR_NAME], SFP_A0_LEN_VENDOR_NAME);
+    a0->is_valid_vendor_name = sfp_a0d_vendor_name_is_valid((const uint8_t *)a0->vendor_name);
 }
 
 void sfp_parse_a0_base_vendor_name(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
@@ -963,9 +601,7 @@ void sfp_parse_a0_base_vendor_name(const uint8_t *a0_base_data, sfp_a0h_base_t *
     if (!a0_base_data || !a0)
         return;
 
-    /* Vendor Name (16 bytes) - ASCII, alinhado a esquerda, padding com 0x20 */
-    memcpy(a0->vendor_name, &a0_base_data[SFP_A0_BYTE_VENDOR_NAME], SFP_A0_LEN_VENDOR_NAME);
-    a0->is_valid_vendor_name = sfp_a0_vendor_name_is_valid(a0);
+    a0_vendor_name(a0_base_data, a0);
 }
 
 /* ============================================
@@ -981,10 +617,7 @@ bool sfp_a0_get_vendor_name(const sfp_a0h_base_t *a0, char *vendor_name)
     if (!a0 || !a0->is_valid_vendor_name)
         return false;
 
-    size_t len = SFP_A0_LEN_VENDOR_NAME;
-
-    while (len > 0 && a0->vendor_name[len - 1] == ' ')
-        len--;
+    size_t len = sfp_a0d_text_len((const uint8_t *)a0->vendor_name, SFP_A0_LEN_VENDOR_NAME);
 
     memcpy(vendor_name, a0->vendor_name, len);
     vendor_name[len] = '\0';
@@ -1083,13 +716,18 @@ bool sfp_a0_get_vendor_pn(const sfp_a0h_base_t *a0, const char **vendor_pn)
 /* ============================================
  * Byte 56-59 — Vendor Rev
  * ============================================ */
+static void a0_vendor_rev(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    memcpy (a0->vendor_rev, &a0_base_data[A0_VENDOR_REV], 4);
+    a0->vendor_rev[4] = '\0';
+}
+
 void sfp_parse_a0_base_vendor_rev(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
     if (!a0_base_data || !a0)
         return;
 
-    memcpy (a0->vendor_rev, &a0_base_data[A0_VENDOR_REV], 4);
-    a0->vendor_rev[4] = '\0';
+    a0_vendor_rev(a0_base_data, a0);
 }
 
 bool sfp_a0_get_vendor_rev(const sfp_a0h_base_t *a0, char *vendor_rev)
@@ -1109,14 +747,14 @@ bool sfp_a0_get_vendor_rev(const sfp_a0h_base_t *a0, char *vendor_rev)
 /* ============================================
  * Byte 60-61 — Wavelength
  * ============================================ */
-static sfp_variant_t sfp_detect_variant(uint8_t byte8)
+static void a0_media(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
-    bool passive = (byte8 & (1 << 2)) != 0;
-    bool active  = (byte8 & (1 << 3)) != 0;
+    a0->variant = sfp_a0d_variant(a0_base_data);
 
-    if (active)  return SFP_VARIANT_ACTIVE_CABLE;
-    if (passive) return SFP_VARIANT_PASSIVE_CABLE;
-    return SFP_VARIANT_OPTICAL;
+    if (a0->variant == SFP_VARIANT_OPTICAL)
+        a0->wavelength_nm = sfp_a0d_wavelength_nm(a0_base_data);
+    else
+        a0->cable_compliance = a0_base_data[A0_WAVELENGTH];
 }
 
 void sfp_parse_a0_base_media(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
@@ -1124,18 +762,7 @@ void sfp_parse_a0_base_media(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
     if (!a0_base_data || !a0)
         return;
 
-    uint8_t byte8  = a0_base_data[A0_TRANSCEIVER + 5];
-    uint8_t byte60 = a0_base_data[A0_WAVELENGTH];
-    uint8_t byte61 = a0_base_data[A0_WAVELENGTH + 1];
-
-    a0->variant = sfp_detect_variant(byte8);
-
-    if (a0->variant == SFP_VARIANT_OPTICAL) {
-        a0->wavelength_nm = ((uint16_t)byte60 << 8) | byte61;
-    } else if (a0->variant == SFP_VARIANT_PASSIVE_CABLE || a0->variant == SFP_VARIANT_ACTIVE_CABLE) {
-       a0->cable_compliance = byte60;
-   }
-
+    a0_media(a0_base_data, a0);
 }
 
 sfp_variant_t sfp_a0_get_variant(const sfp_a0h_base_t *a0)
@@ -1189,7 +816,7 @@ bool sfp_get_a0_fc_speed_2(const sfp_a0h_base_t *a0, const sfp_compliance_decode
     if (!a0 || !comp)
         return false;
 
-    if (!comp->see_byte_62) {
+    if (!sfp_cc_has(comp, SFP_CC_SEE_BYTE_62)) {
         return false;
     }
 
@@ -1201,17 +828,9 @@ bool sfp_get_a0_fc_speed_2(const sfp_a0h_base_t *a0, const sfp_compliance_decode
 /* ============================================
  * Byte 63 — CC_BASE Checksum
  * ============================================ */
-void sfp_parse_a0_base_cc_base(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+static void a0_cc_base(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
 {
-    if (!a0_base_data || !a0)
-        return;
-
-    uint16_t sum = 0;
-    for (int i = 0; i < 63; i++) {
-        sum += a0_base_data[i];
-    }
-
-    uint8_t sum_mod256 = (uint8_t)(sum & 0xFF);
+    uint8_t sum_mod256 = sfp_sum8(a0_base_data, A0_CC_BASE);
 
     uint8_t checksum_byte = a0_base_data[A0_CC_BASE];
 
@@ -1220,6 +839,14 @@ void sfp_parse_a0_base_cc_base(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
     a0->cc_base = checksum_byte;
 }
 
+void sfp_parse_a0_base_cc_base(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    if (!a0_base_data || !a0)
+        return;
+
+    a0_cc_base(a0_base_data, a0);
+}
+
 /* ============================================
  * Função Getter
  * ============================================ */
@@ -1229,6 +856,43 @@ bool sfp_a0_get_cc_base_is_valid(const sfp_a0h_base_t *a0)
         return false;
     return a0->cc_base_is_valid;
 }
+
+/* ============================================
+ * Bytes 0-63 — Base ID completo
+ * ============================================ */
+void sfp_parse_a0_base(const uint8_t *a0_base_data, sfp_a0h_base_t *a0)
+{
+    if (!a0_base_data || !a0)
+        return;
+
+    sfp_parse_a0_base_identifier(a0_base_data, a0);
+    sfp_parse_a0_base_ext_identifier(a0_base_data, a0);
+    sfp_parse_a0_base_connector(a0_base_data, a0);
+
+    sfp_parse_a0_base_compliance(a0_base_data, &a0->cc);
+    sfp_a0_decode_compliance(&a0->cc, &a0->dc);
+    a0->is_copper = sfp_a0d_is_copper(a0_base_data);
+
+    sfp_parse_a0_base_encoding(a0_base_data, a0);
+    sfp_parse_a0_base_nominal_rate(a0_base_data, a0);
+    sfp_parse_a0_base_rate_identifier(a0_base_data, a0);
+
+    sfp_parse_a0_base_smf_km(a0_base_data, a0);
+    sfp_parse_a0_base_smf_m(a0_base_data, a0);
+    sfp_parse_a0_base_om2(a0_base_data, a0);
+    sfp_parse_a0_base_om1(a0_base_data, a0);
+    sfp_parse_a0_base_om4_or_copper(a0_base_data, a0);
+    sfp_parse_a0_base_om3_or_cable(a0_base_data, a0);
+
+    sfp_parse_a0_base_vendor_name(a0_base_data, a0);
+    sfp_parse_a0_base_ext_compliance(a0_base_data, a0);
+    sfp_parse_a0_base_vendor_oui(a0_base_data, a0);
+    sfp_parse_a0_base_vendor_pn(a0_base_data, a0);
+    sfp_parse_a0_base_vendor_rev(a0_base_data, a0);
+    sfp_parse_a0_base_media(a0_base_data, a0);
+    sfp_parse_a0_fc_speed_2(a0_base_data, a0);
+    sfp_parse_a0_base_cc_base(a0_base_data, a0);
+}
 /* ============================================
  * EXTEND FIELDS A0H
  * ============================================ */
@@ -1293,15 +957,7 @@ void sfp_parse_a0_extended_calibration(const uint8_t *a0_data,sfp_a0h_extended_t
 
   if(!a0_data || !a0) return;
 
-  uint8_t byte92 = a0_data[A0_DIAG_MONITORING_TYPE];
-
-  if (byte92 & (1 << SFP_A0_BIT_INTERNAL_CAL)) {
-        a0->calibration = SFP_CAL_INTERNAL;
-    }
-  if (byte92 & (1 << SFP_A0_BIT_EXTERNAL_CAL)) {
-        a0->calibration = SFP_CAL_EXTERNAL;
-    }
-  a0->calibration = SFP_CAL_NOT_SUPPORTED;
+  a0->calibration = sfp_a0d_calibration(a0_data);
 }
 
 /* ============================================
@@ -1313,3 +969,413 @@ sfp_cal_type_t sfp_a0_get_calibration(const sfp_a0h_extended_t *a0){
 
   return a0->calibration;
 }
+
+/* ============================================
+ * Bytes 64-65 — Options
+ * ============================================ */
+void sfp_parse_a0_extended_options(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    a0->options = (uint16_t)(((uint16_t)a0_data[A0_OPTIONS] << 8) | a0_data[A0_OPTIONS + 1]);
+}
+
+bool sfp_a0_get_option(const sfp_a0h_extended_t *a0, uint8_t bit)
+{
+    if (!a0 || bit > 15)
+        return false;
+
+    return (a0->options & (1u << bit)) != 0;
+}
+
+/* ============================================
+ * Bytes 66-67 — BR max / BR min
+ *
+ * Com o byte 12 válido são margens em % acima/abaixo da taxa nominal;
+ * com o byte 12 = FFh o byte 66 é a taxa nominal em unidades de 250 MBd.
+ * Aqui ficam só os bytes crus; a taxa resolvida está em
+ * sfp_a0h_base_t.rate (sfp_rate_decode()).
+ * ============================================ */
+void sfp_parse_a0_extended_br_margins(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    a0->signaling_rate_max = a0_data[A0_BR_MAX];
+    a0->signaling_rate_min = a0_data[A0_BR_MIN];
+}
+
+uint8_t sfp_a0_get_br_max(const sfp_a0h_extended_t *a0)
+{
+    if (!a0)
+        return 0;
+    return a0->signaling_rate_max;
+}
+
+uint8_t sfp_a0_get_br_min(const sfp_a0h_extended_t *a0)
+{
+    if (!a0)
+        return 0;
+    return a0->signaling_rate_min;
+}
+
+/* ============================================
+ * Bytes 68-83 — Vendor SN
+ * ============================================ */
+void sfp_parse_a0_extended_vendor_sn(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    memcpy(a0->vendor_sn, &a0_data[A0_VENDOR_SN], SFP_A0_LEN_VENDOR_SN);
+}
+
+bool sfp_a0_get_vendor_sn(const sfp_a0h_extended_t *a0, char *vendor_sn)
+{
+    if (!vendor_sn)
+        return false;
+
+    vendor_sn[0] = '\0';
+
+    if (!a0)
+        return false;
+
+    size_t len = SFP_A0_LEN_VENDOR_SN;
+
+    while (len > 0 && (a0->vendor_sn[len - 1] == ' ' || a0->vendor_sn[len - 1] == '\0'))
+        len--;
+
+    for (size_t i = 0; i < len; i++)
+        if (!sfp_is_printable_ascii((uint8_t)a0->vendor_sn[i]))
+            return false;
+
+    memcpy(vendor_sn, a0->vendor_sn, len);
+    vendor_sn[len] = '\0';
+
+    return len > 0;
+}
+
+/* ============================================
+ * Bytes 84-91 — Date Code (YYMMDDLL)
+ * ============================================ */
+void sfp_parse_a0_extended_date_code(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    memcpy(a0->date_code, &a0_data[A0_DATE_CODE], SFP_A0_LEN_DATE_CODE);
+}
+
+static bool sfp_two_digits(const char *p, uint8_t *out)
+{
+    if (p[0] < '0' || p[0] > '9' || p[1] < '0' || p[1] > '9')
+        return false;
+
+    *out = (uint8_t)((p[0] - '0') * 10 + (p[1] - '0'));
+    return true;
+}
+
+bool sfp_a0_get_date_code(const sfp_a0h_extended_t *a0, sfp_date_code_t *date)
+{
+    if (!a0 || !date)
+        return false;
+
+    uint8_t yy, mm, dd;
+
+    if (!sfp_two_digits(&a0->date_code[0], &yy) ||
+        !sfp_two_digits(&a0->date_code[2], &mm) ||
+        !sfp_two_digits(&a0->date_code[4], &dd) ||
+        mm < 1 || mm > 12 || dd < 1 || dd > 31)
+        return false;
+
+    date->year   = (uint16_t)(2000 + yy);
+    date->month  = mm;
+    date->day    = dd;
+    date->lot[0] = a0->date_code[6];
+    date->lot[1] = a0->date_code[7];
+    date->lot[2] = '\0';
+    return true;
+}
+
+/* ============================================
+ * Byte 92 — Rx power (média/OMA) e RPM
+ * ============================================ */
+void sfp_parse_a0_extended_rx_power_type(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    uint8_t byte92 = a0_data[A0_DIAG_MONITORING_TYPE];
+
+    a0->rx_power_avg    = (byte92 & (1 << SFP_A0_BIT_RX_PWR_AVG)) != 0;
+    a0->rpm_implemented = (byte92 & (1 << SFP_A0_BIT_RPM_IMPL)) != 0;
+}
+
+bool sfp_a0_get_rx_power_avg(const sfp_a0h_extended_t *a0)
+{
+    if (!a0)
+        return false;
+    return a0->rx_power_avg;
+}
+
+bool sfp_a0_get_rpm_implemented(const sfp_a0h_extended_t *a0)
+{
+    if (!a0)
+        return false;
+    return a0->rpm_implemented;
+}
+
+/* ============================================
+ * Byte 93 — Enhanced Options
+ * ============================================ */
+void sfp_parse_a0_extended_enhanced_options(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    a0->enhanced_options = a0_data[A0_ENHANCED_OPTIONS];
+}
+
+bool sfp_a0_get_enhanced_option(const sfp_a0h_extended_t *a0, uint8_t bit)
+{
+    if (!a0 || bit > 7)
+        return false;
+
+    return (a0->enhanced_options & (1u << bit)) != 0;
+}
+
+/* ============================================
+ * Byte 94 — SFF-8472 Compliance
+ * ============================================ */
+void sfp_parse_a0_extended_sff_8472_compliance(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    a0->sff_8472_compliance = a0_data[A0_COMPLIANCE];
+}
+
+sfp_8472_compliance_t sfp_a0_get_sff_8472_compliance(const sfp_a0h_extended_t *a0)
+{
+    if (!a0)
+        return SFF_8472_REV_UNSPECIFIED;
+    return (sfp_8472_compliance_t)a0->sff_8472_compliance;
+}
+
+const char *sfp_8472_compliance_to_string(sfp_8472_compliance_t rev)
+{
+    switch (rev) {
+        case SFF_8472_REV_UNSPECIFIED: return "Não especificado";
+        case SFF_8472_REV_9_3:         return "Rev 9.3";
+        case SFF_8472_REV_9_5:         return "Rev 9.5";
+        case SFF_8472_REV_10_2:        return "Rev 10.2";
+        case SFF_8472_REV_10_4:        return "Rev 10.4";
+        case SFF_8472_REV_11_0:        return "Rev 11.0";
+        case SFF_8472_REV_11_3:        return "Rev 11.3";
+        case SFF_8472_REV_11_4:        return "Rev 11.4";
+        case SFF_8472_REV_12_3:        return "Rev 12.3";
+        case SFF_8472_REV_12_4:        return "Rev 12.4";
+        default:                       return "Reservado";
+    }
+}
+
+/* ============================================
+ * Byte 95 — CC_EXT Checksum
+ * ============================================ */
+static void a0_cc_ext(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    uint8_t sum = sfp_sum8(&a0_data[A0_OPTIONS], A0_CC_EXT - A0_OPTIONS);
+
+    a0->cc_ext          = a0_data[A0_CC_EXT];
+    a0->cc_ext_is_valid = (sum == a0->cc_ext);
+}
+
+void sfp_parse_a0_extended_cc_ext(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    a0_cc_ext(a0_data, a0);
+}
+
+bool sfp_a0_get_cc_ext_is_valid(const sfp_a0h_extended_t *a0)
+{
+    if (!a0)
+        return false;
+    return a0->cc_ext_is_valid;
+}
+
+/* ============================================
+ * Bytes 64-95 — todos os campos do Extended ID
+ * ============================================ */
+void sfp_parse_a0_extended(const uint8_t *a0_data, sfp_a0h_extended_t *a0)
+{
+    if (!a0_data || !a0)
+        return;
+
+    sfp_parse_a0_extended_options(a0_data, a0);
+    sfp_parse_a0_extended_br_margins(a0_data, a0);
+    sfp_parse_a0_extended_vendor_sn(a0_data, a0);
+    sfp_parse_a0_extended_date_code(a0_data, a0);
+    sfp_parse_a0_extended_dmi(a0_data, a0);
+    sfp_parse_a0_extended_change_addr_req(a0_data, a0);
+    sfp_parse_a0_extended_calibration(a0_data, a0);
+    sfp_parse_a0_extended_rx_power_type(a0_data, a0);
+    sfp_parse_a0_extended_enhanced_options(a0_data, a0);
+    sfp_parse_a0_extended_sff_8472_compliance(a0_data, a0);
+    sfp_parse_a0_extended_cc_ext(a0_data, a0);
+}
+
+/* ============================================
+ * Tabela de campos (bytes 0-95)
+ *
+ * Lista única (X-macro) em ordem de offset. Ela gera tanto o vetor
+ * devolvido por sfp_a0_fields() quanto o corpo de sfp_parse_a0_all():
+ * cada entrada vira um acesso direto ao buffer, sem despacho em tempo
+ * de execução, e os decodificadores estáticos são expandidos em linha.
+ *
+ *   U8(offset, bloco, membro, nome)       1 byte
+ *   U16(offset, bloco, membro, nome)      2 bytes big-endian
+ *   BYTES(offset, bloco, membro, nome)    sizeof(membro) bytes crus
+ *   DEC(offset, len, bloco, função, nome) decodificador próprio
+ * ============================================ */
+#define A0_BASE_FIELDS(U8, U16, BYTES, DEC)                                                    \
+    U8(A0_IDENTIFIER,          base, identifier,      "Identifier")                           \
+    U8(A0_EXT_IDENTIFIER,      base, ext_identifier,  "Ext Identifier")                       \
+    U8(A0_CONNECTOR,           base, connector,       "Connector")                            \
+    DEC(A0_TRANSCEIVER,     8, base, a0_compliance_field,    "Compliance")                    \
+    U8(A0_ENCODING,            base, encoding,        "Encoding")                             \
+    DEC(A0_BR_NOMINAL,      1, base, a0_nominal_rate_field,  "BR Nominal")                    \
+    U8(A0_RATE_IDENTIFIER,     base, rate_identifier, "Rate Identifier")                      \
+    DEC(A0_LENGTH_SMF_KM,   1, base, a0_smf_km_field,        "Length SMF km")                 \
+    DEC(A0_LENGTH_SMF_100M, 1, base, a0_smf_m_field,         "Length SMF 100m")               \
+    DEC(A0_LENGTH_OM2_10M,  1, base, a0_om2_field,           "Length OM2")                    \
+    DEC(A0_LENGTH_OM1_10M,  1, base, a0_om1_field,           "Length OM1")                    \
+    DEC(A0_LENGTH_OM4_10M,  1, base, a0_om4_or_copper_field, "Length OM4/Copper")             \
+    DEC(A0_LENGTH_OM3_10M,  1, base, a0_om3_or_cable_field,  "Length OM3/Cable")              \
+    DEC(A0_VENDOR_NAME,    16, base, a0_vendor_name_field,   "Vendor Name")                   \
+    U8(A0_EXT_TRANSCEIVER,     base, ext_compliance,  "Ext Compliance")                       \
+    BYTES(A0_VENDOR_OUI,       base, vendor_oui,      "Vendor OUI")                           \
+    BYTES(A0_VENDOR_PN,        base, vendor_pn,       "Vendor PN")                            \
+    DEC(A0_VENDOR_REV,      4, base, a0_vendor_rev_field,    "Vendor Rev")                    \
+    DEC(A0_WAVELENGTH,      2, base, a0_media_field,         "Wavelength/Cable")              \
+    U8(A0_FIBRE_CHANNEL_SPD2,  base, fc_speed2,       "FC Speed 2")                           \
+    DEC(A0_CC_BASE,         1, base, a0_cc_base_field,       "CC_BASE")
+
+#define A0_EXT_FIELDS(U8, U16, BYTES, DEC)                                                     \
+    U16(A0_OPTIONS,            ext, options,             "Options")                           \
+    U8(A0_BR_MAX,              ext, signaling_rate_max,  "BR Max")                            \
+    U8(A0_BR_MIN,              ext, signaling_rate_min,  "BR Min")                            \
+    BYTES(A0_VENDOR_SN,        ext, vendor_sn,           "Vendor SN")                         \
+    BYTES(A0_DATE_CODE,        ext, date_code,           "Date Code")                         \
+    DEC(A0_DIAG_MONITORING_TYPE, 1, ext, a0_diag_type_field, "Diag Monitoring Type")          \
+    U8(A0_ENHANCED_OPTIONS,    ext, enhanced_options,    "Enhanced Options")                  \
+    U8(A0_COMPLIANCE,          ext, sff_8472_compliance, "SFF-8472 Compliance")               \
+    DEC(A0_CC_EXT,           1, ext, a0_cc_ext_field,    "CC_EXT")
+
+/* Decodificadores do Base ID na assinatura da tabela */
+#define A0_BASE_DECODER(core)                                            \
+    static void core##_field(const uint8_t *d, sfp_a0h_base_t *base,     \
+                             sfp_a0h_extended_t *ext)                    \
+    {                                                                    \
+        (void)ext;                                                       \
+        core(d, base);                                                   \
+    }
+
+A0_BASE_DECODER(a0_nominal_rate)
+A0_BASE_DECODER(a0_smf_km)
+A0_BASE_DECODER(a0_smf_m)
+A0_BASE_DECODER(a0_om2)
+A0_BASE_DECODER(a0_om1)
+A0_BASE_DECODER(a0_om4_or_copper)
+A0_BASE_DECODER(a0_om3_or_cable)
+A0_BASE_DECODER(a0_vendor_name)
+A0_BASE_DECODER(a0_vendor_rev)
+A0_BASE_DECODER(a0_media)
+A0_BASE_DECODER(a0_cc_base)
+
+/* Bytes 3-10: cópia crua + decodificação dos bits */
+static void a0_compliance_field(const uint8_t *d, sfp_a0h_base_t *base, sfp_a0h_extended_t *ext)
+{
+    (void)ext;
+
+    memcpy(&base->cc, &d[A0_TRANSCEIVER], sizeof(base->cc));
+    base->dc.bits   = sfp_a0d_compliance(d);
+    base->is_copper = sfp_a0d_is_copper(d);
+}
+
+/* Byte 92: DMI, mudança de endereço, calibração, Rx power e RPM */
+static void a0_diag_type_field(const uint8_t *d, sfp_a0h_base_t *base, sfp_a0h_extended_t *ext)
+{
+    (void)base;
+
+    sfp_parse_a0_extended_dmi(d, ext);
+    sfp_parse_a0_extended_change_addr_req(d, ext);
+    sfp_parse_a0_extended_calibration(d, ext);
+    sfp_parse_a0_extended_rx_power_type(d, ext);
+}
+
+/* Byte 95: CC_EXT */
+static void a0_cc_ext_field(const uint8_t *d, sfp_a0h_base_t *base, sfp_a0h_extended_t *ext)
+{
+    (void)base;
+
+    a0_cc_ext(d, ext);
+}
+
+/* ============================================
+ * Vetor de descritores (introspecção)
+ * ============================================ */
+#define A0_TYPE_base   sfp_a0h_base_t
+#define A0_TYPE_ext    sfp_a0h_extended_t
+#define A0_BLOCK_base  SFP_A0_BLOCK_BASE
+#define A0_BLOCK_ext   SFP_A0_BLOCK_EXT
+
+#define A0_MEMBER_SIZE(blk, m) ((uint8_t)sizeof(((A0_TYPE_##blk *)0)->m))
+
+#define A0_DESC(off, len, k, blk, m, n) \
+    { (off), (len), (k), A0_BLOCK_##blk, A0_MEMBER_SIZE(blk, m), offsetof(A0_TYPE_##blk, m), NULL, (n) },
+
+#define A0_DESC_U8(off, blk, m, n)    A0_DESC(off, 1, SFP_A0_FIELD_U8, blk, m, n)
+#define A0_DESC_U16(off, blk, m, n)   A0_DESC(off, 2, SFP_A0_FIELD_U16_BE, blk, m, n)
+#define A0_DESC_BYTES(off, blk, m, n) A0_DESC(off, A0_MEMBER_SIZE(blk, m), SFP_A0_FIELD_BYTES, blk, m, n)
+#define A0_DESC_DEC(off, len, blk, fn, n) \
+    { (off), (len), SFP_A0_FIELD_DECODE, A0_BLOCK_##blk, 0, 0, (fn), (n) },
+
+static const sfp_a0_field_t a0_fields[] = {
+    A0_BASE_FIELDS(A0_DESC_U8, A0_DESC_U16, A0_DESC_BYTES, A0_DESC_DEC)
+    A0_EXT_FIELDS(A0_DESC_U8, A0_DESC_U16, A0_DESC_BYTES, A0_DESC_DEC)
+};
+
+#define A0_FIELD_COUNT (sizeof(a0_fields) / sizeof(a0_fields[0]))
+
+const sfp_a0_field_t *sfp_a0_fields(uint8_t *count)
+{
+    if (count)
+        *count = (uint8_t)A0_FIELD_COUNT;
+    return a0_fields;
+}
+
+/* ============================================
+ * Bytes 0-95 — uma passada
+ * ============================================ */
+#define A0_PARSE_U8(off, blk, m, n)    blk->m = d[off];
+#define A0_PARSE_U16(off, blk, m, n)   blk->m = (uint16_t)(((uint16_t)d[off] << 8) | d[(off) + 1]);
+#define A0_PARSE_BYTES(off, blk, m, n) memcpy(blk->m, &d[off], sizeof(blk->m));
+#define A0_PARSE_DEC(off, len, blk, fn, n) fn(d, base, ext);
+
+void sfp_parse_a0_all(const uint8_t *a0_data, sfp_a0h_base_t *base, sfp_a0h_extended_t *ext)
+{
+    if (!a0_data || !base)
+        return;
+
+    const uint8_t *d = a0_data;
+
+    A0_BASE_FIELDS(A0_PARSE_U8, A0_PARSE_U16, A0_PARSE_BYTES, A0_PARSE_DEC)
+
+    if (!ext)
+        return;
+
+    A0_EXT_FIELDS(A0_PARSE_U8, A0_PARSE_U16, A0_PARSE_BYTES, A0_PARSE_DEC)
+}
@@ -21,6 +21,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 /************************************
  * Basic Type Definitions
@@ -29,70 +30,33 @@
 /** @brief Endereço I2C para EEPROM A0h (Base ID e Extended ID) */
 #define SFP_I2C_ADDR_A0     0x50
 
-/** @brief Tamanho do bloco base A0h (Bytes 0-256) */
+/** @brief Bloco do A0h lido na inserção (Bytes 0-127) */
 #define SFP_A0_SIZE    128
+/** @brief Memória completa do A0h (Bytes 0-255) */
+#define SFP_A0_FULL_SIZE    256
+/** @brief Área do fornecedor/reservada (128-255), lida só sob demanda */
+#define SFP_A0_UPPER_START  128
+#define SFP_A0_UPPER_SIZE   (SFP_A0_FULL_SIZE - SFP_A0_UPPER_START)
 /** @brief Byte 1 (Extended Identifier) */
 #define SFP_EXT_IDENTIFIER_EXPECTED 0x04
 
-/** @brief  */
+/** @brief Byte 12 = 00h: taxa nominal não especificada */
 #define SFP_NOMINAL_RATE_RAW_UNSPECIFIED 0x00u
-/** @brief  */
+/** @brief Byte 12 = FFh: taxa nominal no byte 66 (acima de 25.4 GBd) */
 #define SFP_NOMINAL_RATE_RAW_EXTENDED    0xFFu
-/** @brief  */
+/** @brief Unidade do byte 12 */
 #define SFP_NOMINAL_RATE_RAW_UNIT_MBD   100u
+/** @brief Unidade do byte 66 quando o byte 12 = FFh */
+#define SFP_NOMINAL_RATE_EXT_UNIT_MBD   250u
 
-
-/*==========================================
- * Byte 0 — Identifier (SFF-8472 / SFF-8024)
- ===========================================*/
-typedef enum {
-    SFP_ID_UNKNOWN   = 0x00,
-    SFP_ID_GBIC      = 0x02,
-    SFP_ID_SFP       = 0x03,
-    SFP_ID_QSFP      = 0x0C,
-    SFP_ID_QSFP_PLUS = 0x11,
-    SFP_ID_QSFP28     = 0x18
-} sfp_identifier_t;
-
-/* ==============================
- * Byte 2 — Connector Types
- * SFF-8024 Table 4-3
- * ============================== */
-typedef enum {
-    SFP_CONNECTOR_UNKNOWN           = 0x00,
-    SFP_CONNECTOR_SC                = 0x01,
-    SFP_CONNECTOR_FC_STYLE_1        = 0x02,
-    SFP_CONNECTOR_FC_STYLE_2        = 0x03,
-    SFP_CONNECTOR_BNC_TNC           = 0x04,
-    SFP_CONNECTOR_FC_COAX           = 0x05,
-    SFP_CONNECTOR_FIBER_JACK        = 0x06,
-    SFP_CONNECTOR_LC                = 0x07,
-    SFP_CONNECTOR_MT_RJ             = 0x08,
-    SFP_CONNECTOR_MU                = 0x09,
-    SFP_CONNECTOR_SG                = 0x0A,
-    SFP_CONNECTOR_OPTICAL_PIGTAIL   = 0x0B,
-    SFP_CONNECTOR_MPO_1X12          = 0x0C,
-    SFP_CONNECTOR_MPO_2X16          = 0x0D,
-    SFP_CONNECTOR_HSSDC_II          = 0x20,
-    SFP_CONNECTOR_COPPER_PIGTAIL    = 0x21,
-    SFP_CONNECTOR_RJ45              = 0x22,
-    SFP_CONNECTOR_NO_SEPARABLE      = 0x23
-} sfp_connector_type_t;
-
-/* ==============================
- * Byte 11 — Encoding values
- * ============================== */
-typedef enum {
-    SFP_ENC_UNSPECIFIED     = 0x00,
-    SFP_ENC_8B_10B          = 0x01,
-    SFP_ENC_4B_5B           = 0x02,
-    SFP_ENC_NRZ             = 0x03,
-    SFP_ENC_MANCHESTER      = 0x04,
-    SFP_ENC_SONET_SCRAMBLED = 0x05,
-    SFP_ENC_64B_66B         = 0x06,
-    SFP_ENC_256B_257B       = 0x07,
-    SFP_ENC_PAM4            = 0x08,
-} sfp_encoding_codes_t;
+/**
+ * @brief Códigos SFF-8024 (Identifier, Connector, Encoding, Extended
+ * Compliance, Rate Identifier)
+ *
+ * Os enums e os textos (sfp_<tabela>_name(), sff8024.h) são gerados no
+ * build a partir de sfp_8472/sff_spec.txt por tools/gen_sff_spec.py.
+ */
+#include "sfp_8472/sff8024_codes.h"
 
 /* ==============================
  * Byte 12 — Signaling Rate, Nominal
@@ -104,9 +68,25 @@ typedef enum {
 typedef enum {
     SFP_NOMINAL_RATE_NOT_SPECIFIED = 0, /* 00h */
     SFP_NOMINAL_RATE_VALID,            /* 01h-0xFE (raw * 100 MBd) */
-    SFP_NOMINAL_RATE_EXTENDED          /* 0xFF (rate in extended block, not parsed here) */
+    SFP_NOMINAL_RATE_EXTENDED          /* 0xFF (byte 66 * 250 MBd) */
 } sfp_nominal_rate_status_t;
 
+/**
+ * @brief Taxa de sinalização resolvida (bytes 12, 66 e 67), em MBd
+ *
+ * Byte 12 válido: nominal = byte 12 * 100 MBd, byte 66 é a margem
+ * superior e o byte 67 a inferior, em % da nominal.
+ * Byte 12 = FFh: nominal = byte 66 * 250 MBd e o byte 67 é a margem
+ * (+/-) em % da nominal, aplicada aos dois limites.
+ * Sem taxa nominal os três valores ficam em 0.
+ */
+typedef struct {
+    uint32_t nominal_mbd;
+    uint32_t max_mbd;
+    uint32_t min_mbd;
+    sfp_nominal_rate_status_t status;
+} sfp_rate_t;
+
 /* ==============================
 * Byte 14 — Status da informação
 * de alcance SMF ou atenuação de
@@ -182,91 +162,7 @@ typedef enum {
  *  Referência: SFF-8024 Rev 4.13, Seção 4.5, Páginas 20-22.
  */
 
-typedef enum {
-    EXT_SPEC_COMPLIANCE_UNSPECIFIED                                                  = 0x00,
-    EXT_SPEC_COMPLIANCE_100G_AOC_OR_25GAUI_C2M_AOC_BER_5E_5                          = 0x01,
-    EXT_SPEC_COMPLIANCE_100GBASE_SR4_OR_25GBASE_SR                                   = 0x02,
-    EXT_SPEC_COMPLIANCE_100GBASE_LR4_OR_25GBASE_LR                                   = 0x03,
-    EXT_SPEC_COMPLIANCE_100GBASE_ER4_OR_25GBASE_ER                                   = 0x04,
-    EXT_SPEC_COMPLIANCE_100GBASE_SR10                                                = 0x05,
-    EXT_SPEC_COMPLIANCE_100G_CWDM4                                                   = 0x06,
-    EXT_SPEC_COMPLIANCE_100G_PSM4                                                    = 0x07,
-    EXT_SPEC_COMPLIANCE_100G_ACC_OR_25GAUI_C2M_ACC_BER_5E_5                          = 0x08,
-    EXT_SPEC_COMPLIANCE_OBSOLETE                                                     = 0x09,
-    EXT_SPEC_COMPLIANCE_RESERVED_0A                                                  = 0x0A,
-    EXT_SPEC_COMPLIANCE_100GBASE_CR4_OR_25GBASE_CR_CA_25G_L_OR_50GBASE_CR2_RS_FEC    = 0x0B,
-    EXT_SPEC_COMPLIANCE_25GBASE_CR_CA_25G_S_OR_50GBASE_CR2_BASE_R_FEC                = 0x0C,
-    EXT_SPEC_COMPLIANCE_25GBASE_CR_CA_25G_N_OR_50GBASE_CR2_NO_FEC                    = 0x0D,
-    EXT_SPEC_COMPLIANCE_10MB_SINGLE_PAIR_ETHERNET                                    = 0x0E,
-    EXT_SPEC_COMPLIANCE_RESERVED_0F                                                  = 0x0F,
-    EXT_SPEC_COMPLIANCE_40GBASE_ER4                                                  = 0x10,
-    EXT_SPEC_COMPLIANCE_4X_10GBASE_SR                                                = 0x11,
-    EXT_SPEC_COMPLIANCE_40G_PSM4                                                     = 0x12,
-    EXT_SPEC_COMPLIANCE_G9591_P111_2D1                                               = 0x13,
-    EXT_SPEC_COMPLIANCE_G9591_P151_2D2                                               = 0x14,
-    EXT_SPEC_COMPLIANCE_G9591_P111_2D2                                               = 0x15,
-    EXT_SPEC_COMPLIANCE_10GBASE_T_SFI                                               = 0x16,
-    EXT_SPEC_COMPLIANCE_100G_CLR4                                                    = 0x17,
-    EXT_SPEC_COMPLIANCE_100G_AOC_OR_25GAUI_C2M_AOC_BER_1E_12                         = 0x18,
-    EXT_SPEC_COMPLIANCE_100G_ACC_OR_25GAUI_C2M_ACC_BER_1E_12                         = 0x19,
-    EXT_SPEC_COMPLIANCE_100GE_DWDM2                                                  = 0x1A,
-    EXT_SPEC_COMPLIANCE_100G_1550NM_WDM_4L                                           = 0x1B,
-    EXT_SPEC_COMPLIANCE_10GBASE_T_SHORT_REACH                                        = 0x1C,
-    EXT_SPEC_COMPLIANCE_5GBASE_T                                                     = 0x1D,
-    EXT_SPEC_COMPLIANCE_2_5GBASE_T                                                   = 0x1E,
-    EXT_SPEC_COMPLIANCE_40G_SWDM4                                                    = 0x1F,
-    EXT_SPEC_COMPLIANCE_100G_SWDM4                                                   = 0x20,
-    EXT_SPEC_COMPLIANCE_100G_PAM4_BIDI                                               = 0x21,
-    EXT_SPEC_COMPLIANCE_4WDM_10_MSA                                                  = 0x22,
-    EXT_SPEC_COMPLIANCE_4WDM_20_MSA                                                  = 0x23,
-    EXT_SPEC_COMPLIANCE_4WDM_40_MSA                                                  = 0x24,
-    EXT_SPEC_COMPLIANCE_100GBASE_DR_CAUI4_NO_FEC                                     = 0x25,
-    EXT_SPEC_COMPLIANCE_100G_FR_OR_100GBASE_FR1_CAUI4_NO_FEC                         = 0x26,
-    EXT_SPEC_COMPLIANCE_100G_LR_OR_100GBASE_LR1_CAUI4_NO_FEC                         = 0x27,
-    EXT_SPEC_COMPLIANCE_100GBASE_SR1_CAUI4_NO_FEC                                    = 0x28,
-    EXT_SPEC_COMPLIANCE_100GBASE_SR1_OR_200GBASE_SR2_OR_400GBASE_SR4                 = 0x29,
-    EXT_SPEC_COMPLIANCE_100GBASE_FR1_OR_400GBASE_DR4_2                               = 0x2A,
-    EXT_SPEC_COMPLIANCE_100GBASE_LR1                                                 = 0x2B,
-    EXT_SPEC_COMPLIANCE_100G_LR1_20_MSA_CAUI4_NO_FEC                                 = 0x2C,
-    EXT_SPEC_COMPLIANCE_100G_FR1_30_MSA_CAUI4_NO_FEC                                 = 0x2D,
-    EXT_SPEC_COMPLIANCE_100G_FR1_40_MSA_CAUI4_NO_FEC                                 = 0x2E,
-    EXT_SPEC_COMPLIANCE_100G_LR1_20_MSA                                              = 0x2F,
-    EXT_SPEC_COMPLIANCE_ACTIVE_CU_CABLE_50GAUI_100GAUI2_200GAUI4_C2M_BER_1E_6        = 0x30,
-    EXT_SPEC_COMPLIANCE_ACTIVE_OPTICAL_CABLE_50GAUI_100GAUI2_200GAUI4_C2M_BER_1E_6   = 0x31,
-    EXT_SPEC_COMPLIANCE_ACTIVE_CU_CABLE_50GAUI_100GAUI2_200GAUI4_C2M_BER_2_6E_4      = 0x32,
-    EXT_SPEC_COMPLIANCE_ACTIVE_OPTICAL_CABLE_50GAUI_100GAUI2_200GAUI4_C2M_BER_2_6E_4 = 0x33,
-    EXT_SPEC_COMPLIANCE_100G_FR1_30_MSA                                              = 0x34,
-    EXT_SPEC_COMPLIANCE_100G_FR1_40_MSA                                              = 0x35,
-    EXT_SPEC_COMPLIANCE_100GBASE_VR1_CAUI4_NO_FEC                                    = 0x36,
-    EXT_SPEC_COMPLIANCE_10GBASE_BR                                                   = 0x37,
-    EXT_SPEC_COMPLIANCE_25GBASE_BR                                                   = 0x38,
-    EXT_SPEC_COMPLIANCE_50GBASE_BR                                                   = 0x39,
-    EXT_SPEC_COMPLIANCE_100GBASE_VR1_CAUI4_NO_FEC_2                                  = 0x3A,
-    EXT_SPEC_COMPLIANCE_RESERVED_3B                                                  = 0x3B,
-    EXT_SPEC_COMPLIANCE_RESERVED_3C                                                  = 0x3C,
-    EXT_SPEC_COMPLIANCE_RESERVED_3D                                                  = 0x3D,
-    EXT_SPEC_COMPLIANCE_RESERVED_3E                                                  = 0x3E,
-    EXT_SPEC_COMPLIANCE_100GBASE_CR1_OR_200GBASE_CR2_OR_400GBASE_CR4                 = 0x3F,
-    EXT_SPEC_COMPLIANCE_50GBASE_CR_OR_100GBASE_CR2_OR_200GBASE_CR4                   = 0x40,
-    EXT_SPEC_COMPLIANCE_50GBASE_R_OR_100GBASE_SR2_OR_200GBASE_SR4                    = 0x41,
-    EXT_SPEC_COMPLIANCE_50GBASE_FR_OR_200GBASE_DR4                                   = 0x42,
-    EXT_SPEC_COMPLIANCE_200GBASE_FR4                                                 = 0x43,
-    EXT_SPEC_COMPLIANCE_200G_1550NM_PSM4                                             = 0x44,
-    EXT_SPEC_COMPLIANCE_50GBASE_LR                                                   = 0x45,
-    EXT_SPEC_COMPLIANCE_200GBASE_LR4                                                 = 0x46,
-    EXT_SPEC_COMPLIANCE_400GBASE_DR4_400GAUI4_C2M                                    = 0x47,
-    EXT_SPEC_COMPLIANCE_400GBASE_FR4                                                 = 0x48,
-    EXT_SPEC_COMPLIANCE_400GBASE_LR4_6                                               = 0x49,
-    EXT_SPEC_COMPLIANCE_RESERVED_4A                                                  = 0x4A,
-    EXT_SPEC_COMPLIANCE_400G_LR4_10                                                  = 0x4B,
-    EXT_SPEC_COMPLIANCE_400GBASE_ZR_OBSOLETE                                         = 0x4C,
-    /* 0x4D–0x7E are reserved */
-    EXT_SPEC_COMPLIANCE_256GFC_SW4                                                   = 0x7F,
-    EXT_SPEC_COMPLIANCE_64GFC                                                        = 0x80,
-    EXT_SPEC_COMPLIANCE_128GFC                                                       = 0x81,
-    /* 0x82–0xFE are reserved */
-    EXT_SPEC_COMPLIANCE_VENDOR_SPECIFIC                                              = 0xFF
-} sfp_extended_spec_compliance_code_t;
+/* sfp_extended_spec_compliance_code_t: sff8024_codes.h (gerado) */
 
 // Variantes de módulo SFP/SFP+
 typedef enum {
@@ -288,173 +184,144 @@ typedef struct {
     uint8_t byte10;
 } sfp_compliance_codes_t;
 
+/* ==============================
+ * Bytes 3-10 decodificados: bitset
+ *
+ * Um bit por código, na mesma posição da EEPROM: o byte N ocupa os bits
+ * (N-3)*8 .. (N-3)*8+7 e o bit b do byte vira o bit (N-3)*8+b. A
+ * decodificação é só montar os 8 bytes numa palavra de 64 bits e as
+ * consultas por grupo (SFP_CC_MASK_*) são um único AND.
+ * ============================== */
+#define SFP_CC_BIT(byte, bit)  (((byte) - 3) * 8 + (bit))
+#define SFP_CC_MASK(b)         (UINT64_C(1) << (b))
+#define SFP_CC_MASK_BYTE(byte) (UINT64_C(0xFF) << SFP_CC_BIT(byte, 0))
+
+typedef enum {
+    /* Byte 3 — Ethernet / InfiniBand */
+    SFP_CC_ETH_10G_BASE_ER              = SFP_CC_BIT(3, 7),
+    SFP_CC_ETH_10G_BASE_LRM             = SFP_CC_BIT(3, 6),
+    SFP_CC_ETH_10G_BASE_LR              = SFP_CC_BIT(3, 5),
+    SFP_CC_ETH_10G_BASE_SR              = SFP_CC_BIT(3, 4),
+    SFP_CC_INFINIBAND_1X_SX             = SFP_CC_BIT(3, 3),
+    SFP_CC_INFINIBAND_1X_LX             = SFP_CC_BIT(3, 2),
+    SFP_CC_INFINIBAND_1X_COPPER_ACTIVE  = SFP_CC_BIT(3, 1),
+    SFP_CC_INFINIBAND_1X_COPPER_PASSIVE = SFP_CC_BIT(3, 0),
+
+    /* Byte 4 — ESCON / SONET */
+    SFP_CC_ESCON_MMF                    = SFP_CC_BIT(4, 7),
+    SFP_CC_ESCON_SMF                    = SFP_CC_BIT(4, 6),
+    SFP_CC_OC_192_SR                    = SFP_CC_BIT(4, 5),
+    SFP_CC_SONET_RS_1                   = SFP_CC_BIT(4, 4),
+    SFP_CC_SONET_RS_2                   = SFP_CC_BIT(4, 3),
+    SFP_CC_OC_48_LR                     = SFP_CC_BIT(4, 2),
+    SFP_CC_OC_48_IR                     = SFP_CC_BIT(4, 1),
+    SFP_CC_OC_48_SR                     = SFP_CC_BIT(4, 0),
+
+    /* Byte 5 — SONET */
+    SFP_CC_OC_12_SM_LR                  = SFP_CC_BIT(5, 6),
+    SFP_CC_OC_12_SM_IR                  = SFP_CC_BIT(5, 5),
+    SFP_CC_OC_12_SR                     = SFP_CC_BIT(5, 4),
+    SFP_CC_OC_3_SM_LR                   = SFP_CC_BIT(5, 2),
+    SFP_CC_OC_3_SM_IR                   = SFP_CC_BIT(5, 1),
+    SFP_CC_OC_3_SR                      = SFP_CC_BIT(5, 0),
+
+    /* Byte 6 — Ethernet 1G */
+    SFP_CC_ETH_BASE_PX                  = SFP_CC_BIT(6, 7),
+    SFP_CC_ETH_BASE_BX_10               = SFP_CC_BIT(6, 6),
+    SFP_CC_ETH_100_BASE_FX              = SFP_CC_BIT(6, 5),
+    SFP_CC_ETH_100_BASE_LX              = SFP_CC_BIT(6, 4),
+    SFP_CC_ETH_1000_BASE_T              = SFP_CC_BIT(6, 3),
+    SFP_CC_ETH_1000_BASE_CX             = SFP_CC_BIT(6, 2),
+    SFP_CC_ETH_1000_BASE_LX             = SFP_CC_BIT(6, 1),
+    SFP_CC_ETH_1000_BASE_SX             = SFP_CC_BIT(6, 0),
+
+    /* Byte 7 — FC Link Length & Technology */
+    SFP_CC_FC_VERY_LONG_DISTANCE        = SFP_CC_BIT(7, 7),
+    SFP_CC_FC_SHORT_DISTANCE            = SFP_CC_BIT(7, 6),
+    SFP_CC_FC_INTERMEDIATE_DISTANCE     = SFP_CC_BIT(7, 5),
+    SFP_CC_FC_LONG_DISTANCE             = SFP_CC_BIT(7, 4),
+    SFP_CC_FC_MEDIUM_DISTANCE           = SFP_CC_BIT(7, 3),
+    SFP_CC_SHORTWAVE_LASER_SA           = SFP_CC_BIT(7, 2),
+    SFP_CC_LONGWAVE_LASER_LC            = SFP_CC_BIT(7, 1),
+    SFP_CC_ELECTRICAL_INTER_ENCLOSURE   = SFP_CC_BIT(7, 0),
+
+    /* Byte 8 — FC technology & SFP+ Cable Technology */
+    SFP_CC_ELECTRICAL_INTRA_ENCLOSURE   = SFP_CC_BIT(8, 7),
+    SFP_CC_SHORTWAVE_LASER_SN           = SFP_CC_BIT(8, 6),
+    SFP_CC_SHORTWAVE_LASER_SL           = SFP_CC_BIT(8, 5),
+    SFP_CC_LONGWAVE_LASER_LL            = SFP_CC_BIT(8, 4),
+    SFP_CC_ACTIVE_CABLE                 = SFP_CC_BIT(8, 3),
+    SFP_CC_PASSIVE_CABLE                = SFP_CC_BIT(8, 2),
+
+    /* Byte 9 — FC Transmission Media */
+    SFP_CC_TWIN_AXIAL_PAIR              = SFP_CC_BIT(9, 7),
+    SFP_CC_TWISTED_PAIR                 = SFP_CC_BIT(9, 6),
+    SFP_CC_MINIATURE_COAX               = SFP_CC_BIT(9, 5),
+    SFP_CC_VIDEO_COAX                   = SFP_CC_BIT(9, 4),
+    SFP_CC_MULTIMODE_M6                 = SFP_CC_BIT(9, 3),   /* 62.5 um */
+    SFP_CC_MULTIMODE_M5                 = SFP_CC_BIT(9, 2),   /* 50 um */
+    SFP_CC_SINGLE_MODE                  = SFP_CC_BIT(9, 0),
+
+    /* Byte 10 — FC Channel Speed (MBytes/s) */
+    SFP_CC_CS_1200_MBPS                 = SFP_CC_BIT(10, 7),
+    SFP_CC_CS_800_MBPS                  = SFP_CC_BIT(10, 6),
+    SFP_CC_CS_1600_MBPS                 = SFP_CC_BIT(10, 5),
+    SFP_CC_CS_400_MBPS                  = SFP_CC_BIT(10, 4),
+    SFP_CC_CS_3200_MBPS                 = SFP_CC_BIT(10, 3),
+    SFP_CC_CS_200_MBPS                  = SFP_CC_BIT(10, 2),
+    SFP_CC_SEE_BYTE_62                  = SFP_CC_BIT(10, 1),
+    SFP_CC_CS_100_MBPS                  = SFP_CC_BIT(10, 0),
+
+    SFP_CC_BITS                         = 64
+} sfp_compliance_bit_t;
+
+/* Grupos usados na classificação do módulo */
+#define SFP_CC_MASK_ETH_10G     (SFP_CC_MASK(SFP_CC_ETH_10G_BASE_ER) | SFP_CC_MASK(SFP_CC_ETH_10G_BASE_LRM) | \
+                                 SFP_CC_MASK(SFP_CC_ETH_10G_BASE_LR) | SFP_CC_MASK(SFP_CC_ETH_10G_BASE_SR))
+#define SFP_CC_MASK_ETH_1G      (SFP_CC_MASK(SFP_CC_ETH_BASE_PX)      | SFP_CC_MASK(SFP_CC_ETH_BASE_BX_10)   | \
+                                 SFP_CC_MASK(SFP_CC_ETH_1000_BASE_T)  | SFP_CC_MASK(SFP_CC_ETH_1000_BASE_CX) | \
+                                 SFP_CC_MASK(SFP_CC_ETH_1000_BASE_LX) | SFP_CC_MASK(SFP_CC_ETH_1000_BASE_SX))
+#define SFP_CC_MASK_ETH_100M    (SFP_CC_MASK(SFP_CC_ETH_100_BASE_FX) | SFP_CC_MASK(SFP_CC_ETH_100_BASE_LX))
+#define SFP_CC_MASK_INFINIBAND  (SFP_CC_MASK_BYTE(3) & ~SFP_CC_MASK_ETH_10G)
+#define SFP_CC_MASK_ESCON       (SFP_CC_MASK(SFP_CC_ESCON_MMF) | SFP_CC_MASK(SFP_CC_ESCON_SMF))
+#define SFP_CC_MASK_SONET       ((SFP_CC_MASK_BYTE(4) & ~SFP_CC_MASK_ESCON) | SFP_CC_MASK_BYTE(5))
+#define SFP_CC_MASK_FC_SPEED    (SFP_CC_MASK_BYTE(10) & ~SFP_CC_MASK(SFP_CC_SEE_BYTE_62))
+#define SFP_CC_MASK_FC_8G_PLUS  (SFP_CC_MASK(SFP_CC_CS_800_MBPS)  | SFP_CC_MASK(SFP_CC_CS_1200_MBPS) | \
+                                 SFP_CC_MASK(SFP_CC_CS_1600_MBPS) | SFP_CC_MASK(SFP_CC_CS_3200_MBPS))
+#define SFP_CC_MASK_CABLE       (SFP_CC_MASK(SFP_CC_ACTIVE_CABLE) | SFP_CC_MASK(SFP_CC_PASSIVE_CABLE))
+
 typedef struct {
-    /* ==============================
-     * Byte 3 — Ethernet / InfiniBand
-     * ============================== */
-    bool eth_10g_base_sr;
-    bool eth_10g_base_lr;
-    bool eth_10g_base_lrm;
-    bool eth_10g_base_er;
-    bool infiniband_1x_sx;
-    bool infiniband_1x_lx;
-    bool infiniband_1x_copper_active;
-    bool infiniband_1x_copper_passive;
-
-    /* ======================
-     * Byte 4 — ESCON / SONET
-     * ====================== */
-    bool escon_mmf;
-    bool escon_smf;
-    bool oc_192_sr;
-    bool sonet_rs_1;
-    bool sonet_rs_2;
-    bool oc_48_lr;
-    bool oc_48_ir;
-    bool oc_48_sr;
-
-    /* ======================
-     * Byte 5 — SONET
-     * ====================== */
-    bool oc_12_sm_lr;
-    bool oc_12_sm_ir;
-    bool oc_12_sr;
-    bool oc_3_sm_lr;
-    bool oc_3_sm_ir;
-    bool oc_3_sr;
-
-    /* ======================
-     * Byte 6 — Ethernet 1G
-     * ====================== */
-    bool eth_base_px;
-    bool eth_base_bx_10;
-    bool eth_100_base_fx;
-    bool eth_100_base_lx;
-    bool eth_1000_base_t;
-    bool eth_1000_base_cx;
-    bool eth_1000_base_lx;
-    bool eth_1000_base_sx;
-
-    /* ====================================
-     * Byte 7 — FC Link Length & Technology
-     * ==================================== */
-    bool fc_very_long_distance;
-    bool fc_short_distance;
-    bool fc_intermediate_distance;
-    bool fc_long_distance;
-    bool fc_medium_distance;
-    bool shortwave_laser_sa;
-    bool longwave_laser_lc;
-    bool electrical_inter_enclosure;
-
-    /* ==============================================
-     * Byte 8 — FC technology & SFP+ Cable Technology
-     * ============================================== */
-    bool electrical_intra_enclosure;
-    bool shortwave_laser_sn;
-    bool shortwave_laser_sl;
-    bool longwave_laser_ll;
-    bool active_cable;
-    bool passive_cable;
-
-    /* ==============================
-     * Byte 9 — FC Transmission Media
-     * ============================== */
-    bool twin_axial_pair;
-    bool twisted_pair;
-    bool miniature_coax;
-    bool video_coax;
-    bool multimode_m6; // 62.5 um
-    bool multimode_m5; // 50 um
-    bool single_mode;
-
-    /* ==============================
-     * Byte 10 — FC Channel Speed
-     * ============================== */
-    bool cs_1200_mbps;
-    bool cs_800_mbps;
-    bool cs_1600_mbps;
-    bool cs_400_mbps;
-    bool cs_3200_mbps;
-    bool cs_200_mbps;
-    bool see_byte_62;
-    bool cs_100_mbps;
+    uint64_t bits;
 } sfp_compliance_decoded_t;
 
+static inline bool sfp_cc_has(const sfp_compliance_decoded_t *c, sfp_compliance_bit_t b)
+{
+    return (c->bits & SFP_CC_MASK(b)) != 0;
+}
+
+/* Algum dos códigos de mask */
+static inline bool sfp_cc_any(const sfp_compliance_decoded_t *c, uint64_t mask)
+{
+    return (c->bits & mask) != 0;
+}
+
+/* Todos os códigos de mask */
+static inline bool sfp_cc_all(const sfp_compliance_decoded_t *c, uint64_t mask)
+{
+    return (c->bits & mask) == mask;
+}
+
+/* Byte cru (3-10) de volta a partir do bitset */
+static inline uint8_t sfp_cc_byte(const sfp_compliance_decoded_t *c, uint8_t byte)
+{
+    return (uint8_t)(c->bits >> SFP_CC_BIT(byte, 0));
+}
+
 /*=================================================================
  * Byte 13: Rate Identifier
- =================================================================
-
- * Enumeração para os valores do byte 13 do endereço A0h (Rate Select)
- * Referência: SFF-8472 (Diagnostic Monitoring Interface for Optical Transceivers)
+ *
+ * sfp_rate_select: sff8024_codes.h (gerado)
  =================================================================*/
-typedef enum {
-    // 0x00: Não especificado
-    RS_UNSPECIFIED_00 = 0x00,
-
-    // 0x01: SFF-8079 (4/2/1G Rate_Select & AS0/AS1)
-    RS_SFF_8079 = 0x01,
-
-    // 0x02: SFF-8431 (8/4/2G Rx Rate_Select only)
-    RS_SFF_8431_RX_ONLY = 0x02,
-
-    // 0x03: Não especificado
-    RS_UNSPECIFIED_03 = 0x03,
-
-    // 0x04: SFF-8431 (8/4/2G Tx Rate_Select only)
-    RS_SFF_8431_TX_ONLY = 0x04,
-
-    // 0x05: Não especificado
-    RS_UNSPECIFIED_05 = 0x05,
-
-    // 0x06: SFF-8431 (8/4/2G Independent Rx & Tx Rate_select)
-    RS_SFF_8431_INDEPENDENT_RX_TX = 0x06,
-
-    // 0x07: Não especificado
-    RS_UNSPECIFIED_07 = 0x07,
-
-    // 0x08: FC-PI-5 (16/8/4G Rx Rate_select only) High=16G only, Low=8G/4G
-    RS_FC_PI_5_RX_ONLY = 0x08,
-
-    // 0x09: Não especificado
-    RS_UNSPECIFIED_09 = 0x09,
-
-    // 0x0A: FC-PI-5 (16/8/4G Independent Rx, Tx Rate_select) High=16G only, Low=8G/4G
-    RS_FC_PI_5_INDEPENDENT_RX_TX = 0x0A,
-
-    // 0x0B: Não especificado
-    RS_UNSPECIFIED_0B = 0x0B,
-
-    // 0x0C: FC-PI-6 (32/16/8G Independent Rx, Tx Rate_select) High=32G only, Low=16G/8G
-    RS_FC_PI_6_INDEPENDENT_RX_TX = 0x0C,
-
-    // 0x0D: Não especificado
-    RS_UNSPECIFIED_0D = 0x0D,
-
-    // 0x0E: 10/8G Rx and Tx Rate_Select controlando operação ou modos de bloqueio
-    RS_10G_8G_RX_TX_RATE_SELECT = 0x0E,
-
-    // 0x0F: Não especificado
-    RS_UNSPECIFIED_0F = 0x0F,
-
-    // 0x10: FC-PI-7 (64/32/16G Independent Rx, Tx Rate Select) High=32GFC e 64GFC, Low=16GFC
-    RS_FC_PI_7_INDEPENDENT_RX_TX = 0x10,
-
-    // 0x11: Não especificado
-    RS_UNSPECIFIED_11 = 0x11,
-
-    // 0x12-0x1F: Reservados
-    RS_RESERVED_START = 0x12,
-    RS_RESERVED_END   = 0x1F,
-
-    // 0x20: Rate select baseado em PMDs definidos por A0h, byte 36 e A2h, byte 67
-    RS_PMD_BASED = 0x20,
-
-    // 0x21-0xFF: Reservados
-    RS_EXTENDED_RESERVED_START = 0x21,
-    RS_EXTENDED_RESERVED_END   = 0xFF
-
-} sfp_rate_select;
 
 /*=================================================================
  * Byte 92: Calibration
@@ -490,9 +357,8 @@ typedef struct {
     /* Byte 11: Encoding */
     sfp_encoding_codes_t encoding;
 
-    /* Byte 12: Signaling Rate, Nominal */
-    uint16_t nominal_rate;
-    sfp_nominal_rate_status_t nominal_rate_status;         // Units of 100 MBd
+    /* Byte 12: Signaling Rate, Nominal (+ bytes 66-67: forma estendida e margens) */
+    sfp_rate_t rate;
 
     /* Byte 13: Rate Identifier */
     sfp_rate_select rate_identifier;
@@ -553,12 +419,70 @@ typedef struct {
     /* CC_BASE Validation */
     bool cc_base_is_valid;
 } sfp_a0h_base_t;
+/*=================================================================
+ * Bytes 64-65: Options (SFF-8472 Tabela 8-3)
+ * Bits de sfp_a0h_extended_t.options (byte 64 no MSB, byte 65 no LSB)
+ =================================================================*/
+#define SFP_A0_OPT_HIGH_POWER_LEVEL   15  /** Byte 64.7: Power Level 4 */
+#define SFP_A0_OPT_PAGING             14  /** Byte 64.6: seleção de página no A2h (byte 127) */
+#define SFP_A0_OPT_POWER_LEVEL_3      13  /** Byte 64.5: Power Level 3 */
+#define SFP_A0_OPT_COOLED             12  /** Byte 64.4: transceptor resfriado */
+#define SFP_A0_OPT_RETIMER_CDR        11  /** Byte 64.3: retimer ou CDR */
+#define SFP_A0_OPT_LINEAR_RX_OUTPUT   10  /** Byte 64.2: saída de recepção linear */
+#define SFP_A0_OPT_POWER_LEVEL_2       9  /** Byte 64.1: Power Level 2 */
+#define SFP_A0_OPT_RATE_SELECT         5  /** Byte 65.5: RATE_SELECT implementado */
+#define SFP_A0_OPT_TX_DISABLE          4  /** Byte 65.4: TX_DISABLE implementado */
+#define SFP_A0_OPT_TX_FAULT            3  /** Byte 65.3: TX_FAULT implementado */
+#define SFP_A0_OPT_LOS_INVERTED        2  /** Byte 65.2: LOS com sinal invertido */
+#define SFP_A0_OPT_LOS                 1  /** Byte 65.1: LOS conforme a norma */
+
+/*=================================================================
+ * Byte 93: Enhanced Options (SFF-8472 Tabela 8-6)
+ =================================================================*/
+#define SFP_A0_EO_ALARM_WARNING_FLAGS  7  /** Flags de alarme/aviso implementadas */
+#define SFP_A0_EO_SOFT_TX_DISABLE      6  /** Controle/monitor de TX_DISABLE por software */
+#define SFP_A0_EO_SOFT_TX_FAULT        5  /** Monitor de TX_FAULT por software */
+#define SFP_A0_EO_SOFT_RX_LOS          4  /** Monitor de RX_LOS por software */
+#define SFP_A0_EO_SOFT_RATE_SELECT     3  /** Controle/monitor de RATE_SELECT por software */
+#define SFP_A0_EO_APP_SELECT_8079      2  /** Application Select (SFF-8079) */
+#define SFP_A0_EO_SOFT_RS_8431         1  /** Rate Select por software (SFF-8431) */
+
+/*=================================================================
+ * Byte 94: SFF-8472 Compliance
+ =================================================================*/
+typedef enum {
+    SFF_8472_REV_UNSPECIFIED = 0x00,  /* Diagnósticos não incluídos / não especificado */
+    SFF_8472_REV_9_3         = 0x01,
+    SFF_8472_REV_9_5         = 0x02,
+    SFF_8472_REV_10_2        = 0x03,
+    SFF_8472_REV_10_4        = 0x04,
+    SFF_8472_REV_11_0        = 0x05,
+    SFF_8472_REV_11_3        = 0x06,
+    SFF_8472_REV_11_4        = 0x07,
+    SFF_8472_REV_12_3        = 0x08,  /* Rev 12.3 ou posterior */
+    SFF_8472_REV_12_4        = 0x09
+} sfp_8472_compliance_t;
+
+/*=================================================================
+ * Bytes 84-91: Date Code (ASCII YYMMDDLL)
+ =================================================================*/
+typedef struct {
+    uint16_t year;      /* 2000 + YY */
+    uint8_t  month;     /* 1-12 */
+    uint8_t  day;       /* 1-31 */
+    char     lot[3];    /* Código de lote do fornecedor (opcional, pode ser "  ") */
+} sfp_date_code_t;
+
+/** @brief Tamanhos dos campos ASCII do Extended ID */
+#define SFP_A0_LEN_VENDOR_SN   16
+#define SFP_A0_LEN_DATE_CODE    8
+
 /**
  * Estrutura para os Extended ID Fields (Endereço A0h, Bytes 64-95)
  * Conforme SFF-8472 Rev 12.5, Tabela 4-2.
  */
 typedef struct {
-    /* Bytes 64-65: Indica quais sinais opcionais estão implementados */
+    /* Bytes 64-65: Indica quais sinais opcionais estão implementados (SFP_A0_OPT_*) */
     uint16_t options; 
 
     /* Byte 66: Margem superior da taxa de sinalização (%) ou taxa nominal (250 MBd) */
@@ -568,19 +492,20 @@ typedef struct {
     uint8_t signaling_rate_min; 
 
     /* Bytes 68-83: Número de série do fornecedor (ASCII) */
-    char vendor_sn[3]; 
+    char vendor_sn[SFP_A0_LEN_VENDOR_SN]; 
 
     /* Bytes 84-91: Código de data de fabricação do fornecedor (ASCII) */
-    char date_code[4]; 
+    char date_code[SFP_A0_LEN_DATE_CODE]; 
 
     /* Byte 92: Tipo de monitoramento diagnóstico implementado */
     /*uint8_t diagnostic_monitoring_type; */
     bool dmi_implemented;
     bool change_addr_req;
     sfp_cal_type_t calibration;
-    
+    bool rx_power_avg;      /* 1 = potência média, 0 = OMA */
+    bool rpm_implemented;   /* Remote Performance Monitoring */
 
-    /* Byte 93: Recursos opcionais aprimorados implementados */
+    /* Byte 93: Recursos opcionais aprimorados implementados (SFP_A0_EO_*) */
     uint8_t enhanced_options; 
 
     /* Byte 94: Revisão da norma SFF-8472 com a qual o módulo é compatível */
@@ -588,6 +513,9 @@ typedef struct {
 
     /* Byte 95: Código de verificação (Checksum) para os bytes 64 a 94 */
     uint8_t cc_ext; 
+
+    /* CC_EXT Validation */
+    bool cc_ext_is_valid;
 } sfp_a0h_extended_t;
 
 /**********************************************
@@ -612,6 +540,7 @@ const char *sfp_connector_to_string(sfp_connector_type_t connector);
 void sfp_parse_a0_base_compliance(const uint8_t *a0_base_data, sfp_compliance_codes_t *cc);
 void sfp_a0_decode_compliance(const sfp_compliance_codes_t *cc, sfp_compliance_decoded_t *out);
 void sfp_a0_print_compliance(const sfp_compliance_decoded_t *c);
+const char *sfp_compliance_bit_name(sfp_compliance_bit_t b);
 
 /* Byte 11 — Encoding */
 void sfp_parse_a0_base_encoding(const uint8_t *a0_base_data, sfp_a0h_base_t *a0);
@@ -619,8 +548,11 @@ sfp_encoding_codes_t sfp_a0_get_encoding(const sfp_a0h_base_t *a0);
 void sfp_print_encoding(sfp_encoding_codes_t encoding);
 
 /* Byte 12: Signaling Rate, Nominal */
+/* Lê também os bytes 66-67: a0_base_data precisa cobrir a imagem até o byte 67 */
 void sfp_parse_a0_base_nominal_rate(const uint8_t *a0_base_data, sfp_a0h_base_t *a0);
-uint8_t sfp_a0_get_nominal_rate_mbd(const sfp_a0h_base_t *a0, sfp_nominal_rate_status_t *status);
+uint32_t sfp_a0_get_nominal_rate_mbd(const sfp_a0h_base_t *a0, sfp_nominal_rate_status_t *status);
+bool sfp_a0_get_rate(const sfp_a0h_base_t *a0, sfp_rate_t *rate);
+void sfp_rate_decode(uint8_t br_nominal, uint8_t br_max, uint8_t br_min, sfp_rate_t *rate);
 
 /* Byte 13: Rate Identifier*/
 void sfp_parse_a0_base_rate_identifier(const uint8_t *a0_base_date, sfp_a0h_base_t *a0);
@@ -685,6 +617,9 @@ bool sfp_get_a0_fc_speed_2(const sfp_a0h_base_t *a0, const sfp_compliance_decode
 void sfp_parse_a0_base_cc_base(const uint8_t *a0_base_data, sfp_a0h_base_t *a0);
 bool sfp_a0_get_cc_base_is_valid(const sfp_a0h_base_t *a0);
 
+/* Bytes 0-63 — todos os campos do Base ID em sequência (taxa: também 66-67) */
+void sfp_parse_a0_base(const uint8_t *a0_base_data, sfp_a0h_base_t *a0);
+
 /*Byte 92 (DDM)*/
 void sfp_parse_a0_extended_dmi(const uint8_t *a0_base_data,sfp_a0h_extended_t *a0);
 bool sfp_a0_get_dmi(const sfp_a0h_extended_t *a0);
@@ -696,4 +631,86 @@ bool sfp_a0_get_change_addr_req(const sfp_a0h_extended_t *a0);
 /*Byte 92 Calibration*/
 void sfp_parse_a0_extended_calibration(const uint8_t *a0_data,sfp_a0h_extended_t *a0);
 sfp_cal_type_t sfp_a0_get_calibration(const sfp_a0h_extended_t *a0);
+
+/* Bytes 64-65 — Options */
+void sfp_parse_a0_extended_options(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+bool sfp_a0_get_option(const sfp_a0h_extended_t *a0, uint8_t bit);
+
+/* Bytes 66-67 — BR max / BR min */
+void sfp_parse_a0_extended_br_margins(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+uint8_t sfp_a0_get_br_max(const sfp_a0h_extended_t *a0);
+uint8_t sfp_a0_get_br_min(const sfp_a0h_extended_t *a0);
+
+/* Bytes 68-83 — Vendor SN (vendor_sn precisa de SFP_A0_LEN_VENDOR_SN + 1 bytes) */
+void sfp_parse_a0_extended_vendor_sn(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+bool sfp_a0_get_vendor_sn(const sfp_a0h_extended_t *a0, char *vendor_sn);
+
+/* Bytes 84-91 — Date Code */
+void sfp_parse_a0_extended_date_code(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+bool sfp_a0_get_date_code(const sfp_a0h_extended_t *a0, sfp_date_code_t *date);
+
+/* Byte 92 — Tipo de potência recebida (média/OMA) e RPM */
+void sfp_parse_a0_extended_rx_power_type(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+bool sfp_a0_get_rx_power_avg(const sfp_a0h_extended_t *a0);
+bool sfp_a0_get_rpm_implemented(const sfp_a0h_extended_t *a0);
+
+/* Byte 93 — Enhanced Options */
+void sfp_parse_a0_extended_enhanced_options(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+bool sfp_a0_get_enhanced_option(const sfp_a0h_extended_t *a0, uint8_t bit);
+
+/* Byte 94 — SFF-8472 Compliance */
+void sfp_parse_a0_extended_sff_8472_compliance(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+sfp_8472_compliance_t sfp_a0_get_sff_8472_compliance(const sfp_a0h_extended_t *a0);
+const char *sfp_8472_compliance_to_string(sfp_8472_compliance_t rev);
+
+/* Byte 95 — CC_EXT (Checksum dos bytes 64-94) */
+void sfp_parse_a0_extended_cc_ext(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+bool sfp_a0_get_cc_ext_is_valid(const sfp_a0h_extended_t *a0);
+
+/* Bytes 64-95 — todos os campos do Extended ID em sequência */
+void sfp_parse_a0_extended(const uint8_t *a0_data, sfp_a0h_extended_t *a0);
+
+/* ============================================
+ * Tabela de campos do A0h (bytes 0-95)
+ *
+ * Cada campo é descrito por offset, tamanho e tipo. Campos simples
+ * (byte, palavra big-endian, bytes crus) são copiados direto para o
+ * membro de destino (offsetof/sizeof); os que exigem interpretação
+ * (alcances, vendor name, checksum, ...) têm um decodificador. A tabela
+ * está em ordem crescente de offset; sfp_parse_a0_all() é gerada da
+ * mesma lista de campos e a aplica em uma única passada pelo buffer.
+ * ============================================ */
+typedef enum {
+    SFP_A0_FIELD_U8 = 0,     /* 1 byte, alargado para o tamanho do membro */
+    SFP_A0_FIELD_U16_BE,     /* 2 bytes, big-endian */
+    SFP_A0_FIELD_BYTES,      /* sizeof(membro) bytes crus */
+    SFP_A0_FIELD_DECODE      /* decodificador próprio */
+} sfp_a0_field_kind_t;
+
+typedef enum {
+    SFP_A0_BLOCK_BASE = 0,   /* sfp_a0h_base_t (bytes 0-63) */
+    SFP_A0_BLOCK_EXT         /* sfp_a0h_extended_t (bytes 64-95) */
+} sfp_a0_field_block_t;
+
+typedef void (*sfp_a0_field_decoder_t)(const uint8_t *a0_data,
+                                       sfp_a0h_base_t *base,
+                                       sfp_a0h_extended_t *ext);
+
+typedef struct {
+    uint8_t  offset;
+    uint8_t  length;
+    uint8_t  kind;           /* sfp_a0_field_kind_t */
+    uint8_t  block;          /* sfp_a0_field_block_t */
+    uint8_t  size;           /* sizeof do membro de destino */
+    uint16_t dest;           /* offsetof do membro de destino */
+    sfp_a0_field_decoder_t decode;
+    const char *name;
+} sfp_a0_field_t;
+
+const sfp_a0_field_t *sfp_a0_fields(uint8_t *count);
+
+/* Bytes 0-95 em uma passada. a0_data precisa cobrir os 96 bytes;
+   ext pode ser NULL (só o Base ID é preenchido) */
+void sfp_parse_a0_all(const uint8_t *a0_data, sfp_a0h_base_t *base, sfp_a0h_extended_t *ext);
+
 #endif /* SFF_8472_A0H_H */
@@ -0,0 +1,203 @@
+/**
+ * @file a0h_decode.h
+ * @brief Núcleos de decodificação do A0h (uso interno)
+ *
+ * @details
+ *  Regras de cada campo do A0h que dependem de mais do que copiar o byte:
+ *  alcances com valores especiais, unidades que mudam em cabos de cobre,
+ *  variante do meio, validação do vendor name e calibração. São a única
+ *  implementação dessas regras: a0h.c as usa para preencher
+ *  sfp_a0h_base_t/sfp_a0h_extended_t (sfp_parse_a0_all() e os parsers
+ *  por campo) e a0_view.h para decodificar direto da imagem crua.
+ *
+ *  Todas recebem a imagem do A0h a partir do byte 0 e não validam o
+ *  ponteiro: quem chama já fez isso. O status dos alcances é opcional
+ *  (NULL quando só o comprimento interessa). Não faz parte da API pública.
+ */
+
+#ifndef SFP_A0H_DECODE_H
+#define SFP_A0H_DECODE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "defs.h"
+#include "a0h.h"
+
+/* ============================================
+ * Bytes 3-10 — Compliance e meio físico
+ * ============================================ */
+
+/* Bytes 3-10 no layout de sfp_compliance_decoded_t (byte 3 nos bits 0-7) */
+static inline uint64_t sfp_a0d_compliance(const uint8_t *d)
+{
+    uint64_t bits = 0;
+
+    for (uint8_t i = 0; i < 8; i++)
+        bits |= (uint64_t)d[A0_TRANSCEIVER + i] << SFP_CC_BIT(3 + i, 0);
+    return bits;
+}
+
+/* Byte 8, bits 2-3: cabo passivo/ativo */
+static inline bool sfp_a0d_is_copper(const uint8_t *d)
+{
+    return (d[A0_TRANSCEIVER + 5] & ((1u << 2) | (1u << 3))) != 0;
+}
+
+static inline sfp_variant_t sfp_a0d_variant(const uint8_t *d)
+{
+    uint8_t byte8 = d[A0_TRANSCEIVER + 5];
+
+    if (byte8 & (1u << 3)) return SFP_VARIANT_ACTIVE_CABLE;
+    if (byte8 & (1u << 2)) return SFP_VARIANT_PASSIVE_CABLE;
+    return SFP_VARIANT_OPTICAL;
+}
+
+/* ============================================
+ * Bytes 14-19 — Alcances
+ *
+ * Campo de 1 byte: 00h = sem informação (comprimento 0), FFh = além do
+ * máximo representável (guarda o limite conhecido), 01h-FEh = raw * unit.
+ * Os enums de status dos bytes 14-19 têm a mesma ordem.
+ * ============================================ */
+static inline uint16_t sfp_a0d_length(uint8_t raw, uint16_t unit, uint16_t extended,
+                                      sfp_smf_length_status_t *status)
+{
+    sfp_smf_length_status_t st = SFP_SMF_LEN_VALID;
+    uint16_t len = (uint16_t)(raw * unit);
+
+    if (raw == 0x00) {
+        st  = SFP_SMF_LEN_NOT_SUPPORTED;
+        len = 0;
+    } else if (raw == 0xFF) {
+        st  = SFP_SMF_LEN_EXTENDED;
+        len = extended;
+    }
+
+    if (status)
+        *status = st;
+    return len;
+}
+
+/* Byte 14: km (fibra) ou 0,5 dB/100m (cobre); FFh = > 254 km / > 127 dB */
+static inline uint16_t sfp_a0d_smf_km(const uint8_t *d, sfp_smf_length_status_t *status)
+{
+    return sfp_a0d_length(d[A0_LENGTH_SMF_KM], 1, 254, status);
+}
+
+/* Byte 15: unidades de 100 m (fibra) ou valor direto (cobre) */
+static inline uint16_t sfp_a0d_smf_m(const uint8_t *d, sfp_smf_length_status_t *status)
+{
+    return sfp_a0d_length(d[A0_LENGTH_SMF_100M], sfp_a0d_is_copper(d) ? 1 : 100, 2540, status);
+}
+
+/* Byte 16: OM2 (50 µm) em 10 m */
+static inline uint16_t sfp_a0d_om2(const uint8_t *d, sfp_om2_length_status_t *status)
+{
+    sfp_smf_length_status_t st;
+    uint16_t len = sfp_a0d_length(d[A0_LENGTH_OM2_10M], 10, 2540, &st);
+
+    if (status)
+        *status = (sfp_om2_length_status_t)st;
+    return len;
+}
+
+/* Byte 17: OM1 (62,5 µm) em 10 m */
+static inline uint16_t sfp_a0d_om1(const uint8_t *d, sfp_om1_length_status_t *status)
+{
+    sfp_smf_length_status_t st;
+    uint16_t len = sfp_a0d_length(d[A0_LENGTH_OM1_10M], 10, 2540, &st);
+
+    if (status)
+        *status = (sfp_om1_length_status_t)st;
+    return len;
+}
+
+/* Byte 18: OM4 em 10 m ou cabo de cobre em 1 m */
+static inline uint16_t sfp_a0d_om4_or_copper(const uint8_t *d, sfp_om4_length_status_t *status)
+{
+    bool copper = sfp_a0d_is_copper(d);
+    sfp_smf_length_status_t st;
+    uint16_t len = sfp_a0d_length(d[A0_LENGTH_OM4_10M], copper ? 1 : 10,
+                                  copper ? 254 : 2540, &st);
+
+    if (status)
+        *status = (sfp_om4_length_status_t)st;
+    return len;
+}
+
+/* Byte 19: OM3 em 10 m ou, em cobre, 6 bits de base e 2 de multiplicador
+   (0,1 / 1 / 10 / 100 m), sempre válido */
+static inline uint32_t sfp_a0d_om3_or_cable(const uint8_t *d, sfp_om3_length_status_t *status)
+{
+    static const uint16_t mult_x10[4] = { 1, 10, 100, 1000 };
+    uint8_t raw = d[A0_LENGTH_OM3_10M];
+
+    if (!sfp_a0d_is_copper(d)) {
+        sfp_smf_length_status_t st;
+        uint16_t len = sfp_a0d_length(raw, 10, 2540, &st);
+
+        if (status)
+            *status = (sfp_om3_length_status_t)st;
+        return len;
+    }
+
+    if (status)
+        *status = SFP_OM3_LEN_VALID;
+    return (uint32_t)(raw & 0x3F) * mult_x10[(raw >> 6) & 0x03] / 10;
+}
+
+/* ============================================
+ * Bytes 20-61 — Fornecedor e mídia
+ * ============================================ */
+
+/* Vendor name (16 bytes): ASCII imprimível, alinhado à esquerda,
+   padding com espaços e não vazio */
+static inline bool sfp_a0d_vendor_name_is_valid(const uint8_t *name)
+{
+    bool found_padding = false;
+    bool has_content   = false;
+
+    for (uint8_t i = 0; i < SFP_A0_LEN_VENDOR_NAME; i++) {
+        uint8_t c = name[i];
+
+        if (c < 0x20u || c > 0x7Eu)
+            return false;
+        if (c == 0x20u) {
+            found_padding = true;
+            continue;
+        }
+        if (found_padding)
+            return false;
+        has_content = true;
+    }
+    return has_content;
+}
+
+/* Campo de texto sem o padding de espaços à direita */
+static inline uint8_t sfp_a0d_text_len(const uint8_t *s, uint8_t len)
+{
+    while (len > 0 && s[len - 1] == ' ')
+        len--;
+    return len;
+}
+
+/* Bytes 60-61: comprimento de onda (só faz sentido em módulo óptico) */
+static inline uint16_t sfp_a0d_wavelength_nm(const uint8_t *d)
+{
+    return (uint16_t)(((uint16_t)d[A0_WAVELENGTH] << 8) | d[A0_WAVELENGTH + 1]);
+}
+
+/* ============================================
+ * Byte 92 — Diagnostic Monitoring Type
+ * ============================================ */
+static inline sfp_cal_type_t sfp_a0d_calibration(const uint8_t *d)
+{
+    uint8_t b = d[A0_DIAG_MONITORING_TYPE];
+
+    if (b & (1u << SFP_A0_BIT_INTERNAL_CAL)) return SFP_CAL_INTERNAL;
+    if (b & (1u << SFP_A0_BIT_EXTERNAL_CAL)) return SFP_CAL_EXTERNAL;
+    return SFP_CAL_NOT_SUPPORTED;
+}
+
+#endif /* SFP_A0H_DECODE_H */
@@ -1,5 +1,69 @@
 #include "a2h.h"
 #include <math.h>
+#include <stddef.h>
+
+/* ============================================
+ * Registro de regiões do A2h (bytes 0-127)
+ * ============================================ */
+static const sfp_a2_region_t a2_regions[] = {
+    { A2_TEMP_HIGH_ALARM,       56, SFP_A2_REGION_STATIC,  "Limiares de alarme/aviso" },
+    { A2_CAL_CONST_OR_ENHANCED, 36, SFP_A2_REGION_STATIC,  "Calibração externa" },
+    { 92,                        3, SFP_A2_REGION_STATIC,  "Reservado" },
+    { A2_CC_DMI,                 1, SFP_A2_REGION_STATIC,  "CC_DMI" },
+    { A2_TEMP_CURR,             14, SFP_A2_REGION_DYNAMIC, "Diagnósticos A/D" },
+    { STATUS_CONTROL,            2, SFP_A2_REGION_DYNAMIC, "Status/Controle" },
+    { A2_ALARM_FLAGS,            2, SFP_A2_REGION_DYNAMIC, "Flags de alarme" },
+    { A2_TX_INPUT_EQ_CTRL,       2, SFP_A2_REGION_DYNAMIC, "Controle de equalização" },
+    { A2_WARNING_FLAGS,          2, SFP_A2_REGION_DYNAMIC, "Flags de aviso" },
+    { A2_EXT_STATUS_CONTROL,     2, SFP_A2_REGION_DYNAMIC, "Status/Controle estendido" },
+    { 120,                       7, SFP_A2_REGION_STATIC,  "Fornecedor" },
+    { A2_PAGE_SELECT,            1, SFP_A2_REGION_STATIC,  "Seletor de página" },
+};
+
+#define A2_REGION_COUNT (sizeof(a2_regions) / sizeof(a2_regions[0]))
+
+const sfp_a2_region_t *sfp_a2_regions(uint8_t *count)
+{
+    if (count)
+        *count = A2_REGION_COUNT;
+    return a2_regions;
+}
+
+const sfp_a2_region_t *sfp_a2_region_of(uint8_t offset)
+{
+    for (size_t i = 0; i < A2_REGION_COUNT; i++) {
+        if (offset >= a2_regions[i].offset &&
+            offset < a2_regions[i].offset + a2_regions[i].length)
+            return &a2_regions[i];
+    }
+    return NULL;
+}
+
+/**
+ * Menor janela contígua que cobre todas as regiões dinâmicas.
+ * Com a tabela acima: bytes 96-119 (24 bytes), uma única transação I2C.
+ */
+bool sfp_a2_dynamic_window(uint8_t *offset, uint8_t *length)
+{
+    unsigned first = SFP_A2_SIZE;
+    unsigned end   = 0;
+
+    for (size_t i = 0; i < A2_REGION_COUNT; i++) {
+        if (a2_regions[i].kind != SFP_A2_REGION_DYNAMIC)
+            continue;
+        if (a2_regions[i].offset < first)
+            first = a2_regions[i].offset;
+        if (a2_regions[i].offset + a2_regions[i].length > end)
+            end = a2_regions[i].offset + a2_regions[i].length;
+    }
+
+    if (end <= first)
+        return false;
+
+    if (offset) *offset = (uint8_t)first;
+    if (length) *length = (uint8_t)(end - first);
+    return true;
+}
 
 /* ============================================
  * Byte 00-01 -High Temperature Alarm
@@ -501,6 +565,37 @@ float sfp_a2h_get_rx_power_low_warning(const sfp_a2h_t *a2){
     return a2->thresholds.rx_power_low_warning;
 }
 
+void sfp_parse_a2h_thresholds(const uint8_t *a2_data, sfp_a2h_t *a2){
+    if(!a2_data || !a2){
+        return;
+    }
+
+    sfp_parse_a2h_temp_high_alarm(a2_data, a2);
+    sfp_parse_a2h_temp_low_alarm(a2_data, a2);
+    sfp_parse_a2h_temp_high_warning(a2_data, a2);
+    sfp_parse_a2h_temp_low_warning(a2_data, a2);
+
+    sfp_parse_a2h_vcc_high_alarm(a2_data, a2);
+    sfp_parse_a2h_vcc_low_alarm(a2_data, a2);
+    sfp_parse_a2h_vcc_high_warning(a2_data, a2);
+    sfp_parse_a2h_vcc_low_warning(a2_data, a2);
+
+    sfp_parse_a2h_tx_bias_high_alarm(a2_data, a2);
+    sfp_parse_a2h_tx_bias_low_alarm(a2_data, a2);
+    sfp_parse_a2h_tx_bias_high_warning(a2_data, a2);
+    sfp_parse_a2h_tx_bias_low_warning(a2_data, a2);
+
+    sfp_parse_a2h_tx_power_high_alarm(a2_data, a2);
+    sfp_parse_a2h_tx_power_low_alarm(a2_data, a2);
+    sfp_parse_a2h_tx_power_high_warning(a2_data, a2);
+    sfp_parse_a2h_tx_power_low_warning(a2_data, a2);
+
+    sfp_parse_a2h_rx_power_high_alarm(a2_data, a2);
+    sfp_parse_a2h_rx_power_low_alarm(a2_data, a2);
+    sfp_parse_a2h_rx_power_high_warning(a2_data, a2);
+    sfp_parse_a2h_rx_power_low_warning(a2_data, a2);
+}
+
 
 /**
  * Verifica se o transceptor implementa a página de diagnósticos A2h.
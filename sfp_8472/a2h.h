@@ -9,6 +9,30 @@
 /*SIZE do Bloco do A2H*/
 #define SFP_A2_SIZE 128
 
+/* ============================================
+ * Regiões do A2h (Tabela 9-1)
+ *
+ * STATIC:  gravadas na fábrica (limiares, calibração, checksum, área do
+ *          fornecedor). Lidas uma vez por inserção do módulo.
+ * DYNAMIC: atualizadas pelo módulo (medidas A/D, status, flags). São as
+ *          únicas que precisam ser relidas periodicamente.
+ * ============================================ */
+typedef enum {
+    SFP_A2_REGION_STATIC = 0,
+    SFP_A2_REGION_DYNAMIC
+} sfp_a2_region_kind_t;
+
+typedef struct {
+    uint8_t offset;
+    uint8_t length;
+    sfp_a2_region_kind_t kind;
+    const char *name;
+} sfp_a2_region_t;
+
+/* Janela crítica: status/controle + flags de alarme e aviso (bytes 110-117) */
+#define SFP_A2_ALARM_OFFSET  STATUS_CONTROL
+#define SFP_A2_ALARM_LEN     (A2_EXT_STATUS_CONTROL - STATUS_CONTROL)
+
 // Estrutura para os Limiares de Alarme e Aviso (Bytes 0-55)
 typedef struct {
     float temp_high_alarm;    // Bytes 00-01
@@ -95,6 +119,13 @@ typedef struct {
 } sfp_a2h_t;
 
 
+/* ============================================
+ * Registro de regiões
+ * ============================================ */
+const sfp_a2_region_t *sfp_a2_regions(uint8_t *count);
+const sfp_a2_region_t *sfp_a2_region_of(uint8_t offset);
+bool sfp_a2_dynamic_window(uint8_t *offset, uint8_t *length);
+
 bool check_sfp_a2h_exists(const uint8_t *a2_data);
 bool get_sfp_vcc(const uint8_t *a2_data, float *vcc);
 
@@ -185,6 +216,9 @@ float sfp_a2h_get_rx_power_high_warning(const sfp_a2h_t *a2);
 void sfp_parse_a2h_rx_power_low_warning(const uint8_t *a2_data, sfp_a2h_t *a2);
 float sfp_a2h_get_rx_power_low_warning(const sfp_a2h_t *a2);
 
+/* Todos os limiares acima (bytes 0-39), uma vez por inserção */
+void sfp_parse_a2h_thresholds(const uint8_t *a2_data, sfp_a2h_t *a2);
+
 
 /* ============================================
  * RX POWER 
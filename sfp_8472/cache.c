@@ -0,0 +1,94 @@
+#include "cache.h"
+#include <string.h>
+
+/* ============================================
+ * CRC-32 (tabela de 16 entradas: 4 bits por passo)
+ * ============================================ */
+static const uint32_t crc32_nibble[16] = {
+    0x00000000u, 0x1DB71064u, 0x3B6E20C8u, 0x26D930ACu,
+    0x76DC4190u, 0x6B6B51F4u, 0x4DB26158u, 0x5005713Cu,
+    0xEDB88320u, 0xF00F9344u, 0xD6D6A3E8u, 0xCB61B38Cu,
+    0x9B64C2B0u, 0x86D3D2D4u, 0xA00AE278u, 0xBDBDF21Cu
+};
+
+uint32_t sfp_crc32(uint32_t crc, const uint8_t *data, size_t len)
+{
+    crc = ~crc;
+    for (size_t i = 0; data && i < len; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0x0F];
+        crc = (crc >> 4) ^ crc32_nibble[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+uint32_t sfp_a0_fingerprint(const uint8_t *a0_data)
+{
+    if (!a0_data)
+        return 0;
+
+    uint8_t cc[2] = { a0_data[A0_CC_BASE], a0_data[A0_CC_EXT] };
+    uint32_t crc = 0;
+
+    crc = sfp_crc32(crc, &a0_data[A0_VENDOR_NAME], SFP_A0_LEN_VENDOR_NAME);
+    crc = sfp_crc32(crc, &a0_data[A0_VENDOR_PN], A0_VENDOR_REV - A0_VENDOR_PN);
+    crc = sfp_crc32(crc, &a0_data[A0_VENDOR_SN], A0_DATE_CODE - A0_VENDOR_SN);
+    crc = sfp_crc32(crc, cc, sizeof(cc));
+    return crc;
+}
+
+/* ============================================
+ * Cache LRU
+ * ============================================ */
+void sfp_module_cache_init(sfp_module_cache_t *c)
+{
+    if (c)
+        memset(c, 0, sizeof(*c));
+}
+
+const sfp_module_cache_entry_t *sfp_module_cache_lookup(sfp_module_cache_t *c, uint32_t fingerprint)
+{
+    if (!c)
+        return NULL;
+
+    for (uint8_t i = 0; i < SFP_MODULE_CACHE_ENTRIES; i++) {
+        sfp_module_cache_entry_t *e = &c->entry[i];
+        if (e->valid && e->fingerprint == fingerprint) {
+            e->last_used = ++c->tick;
+            c->hits++;
+            return e;
+        }
+    }
+
+    c->misses++;
+    return NULL;
+}
+
+sfp_module_cache_entry_t *sfp_module_cache_insert(sfp_module_cache_t *c, uint32_t fingerprint)
+{
+    if (!c)
+        return NULL;
+
+    sfp_module_cache_entry_t *slot = NULL;
+
+    for (uint8_t i = 0; i < SFP_MODULE_CACHE_ENTRIES; i++) {
+        sfp_module_cache_entry_t *e = &c->entry[i];
+
+        /* Mesmo módulo: sobrescreve no lugar */
+        if (e->valid && e->fingerprint == fingerprint) {
+            slot = e;
+            break;
+        }
+        if (!slot || (slot->valid && (!e->valid || e->last_used < slot->last_used)))
+            slot = e;
+    }
+
+    if (slot->valid && slot->fingerprint != fingerprint)
+        c->evictions++;
+
+    memset(slot, 0, sizeof(*slot));
+    slot->valid       = true;
+    slot->fingerprint = fingerprint;
+    slot->last_used   = ++c->tick;
+    return slot;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file cache.h
+ * @brief Identidade do módulo (fingerprint) + cache LRU dos dados decodificados
+ *
+ * @details
+ *  O fingerprint é um CRC32 dos campos que identificam o módulo no A0h:
+ *  nome do fornecedor (20-35), part number (40-55), número de série (68-83)
+ *  e os checksums CC_BASE (63) e CC_EXT (95). Como os checksums cobrem o
+ *  restante dos bytes 0-94, módulos diferentes — ou o mesmo módulo
+ *  regravado — geram fingerprints diferentes.
+ *
+ *  Cada entrada guarda o que é caro obter numa inserção: o A0h base
+ *  decodificado, os limiares do A2h decodificados, a região estática crua
+ *  do A2h (0-95), a velocidade negociada e a classificação. Ao reinserir um módulo
+ *  conhecido basta ler o A0h para calcular o fingerprint.
+ *
+ *  As entradas ficam em RAM: o cache não sobrevive a um reset.
+ */
+
+#ifndef SFP_CACHE_H
+#define SFP_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "defs.h"
+#include "a0h.h"
+#include "a2h.h"
+#include "classify.h"
+
+/** @brief Módulos lembrados (o menos usado recentemente é descartado) */
+#ifndef SFP_MODULE_CACHE_ENTRIES
+#define SFP_MODULE_CACHE_ENTRIES  4
+#endif
+
+/** @brief Bytes do A0h necessários para o fingerprint (0-95) */
+#define SFP_FINGERPRINT_LEN       (A0_CC_EXT + 1)
+
+/** @brief Região estática do A2h guardada no cache (0-95) */
+#define SFP_CACHE_A2_STATIC_LEN   A2_TEMP_CURR
+
+typedef struct {
+    bool     valid;
+    uint32_t fingerprint;
+    uint32_t last_used;     /* relógio lógico do LRU */
+
+    sfp_a0h_base_t a0;
+    sfp_a0h_extended_t a0_ext;
+    bool     has_dmi;
+    sfp_a2h_t a2;           /* limiares já decodificados */
+    uint8_t  a2_static[SFP_CACHE_A2_STATIC_LEN];
+    uint32_t baud;          /* velocidade negociada (0 = padrão) */
+    sfp_class_t cls;        /* classificação do módulo */
+} sfp_module_cache_entry_t;
+
+typedef struct {
+    sfp_module_cache_entry_t entry[SFP_MODULE_CACHE_ENTRIES];
+    uint32_t tick;
+
+    /* Estatísticas */
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+} sfp_module_cache_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* CRC-32 (IEEE 802.3, refletido); crc = 0 para iniciar */
+uint32_t sfp_crc32(uint32_t crc, const uint8_t *data, size_t len);
+
+/* Fingerprint dos bytes 0-95 do A0h */
+uint32_t sfp_a0_fingerprint(const uint8_t *a0_data);
+
+void sfp_module_cache_init(sfp_module_cache_t *c);
+
+/* Entrada do módulo (atualiza o LRU) ou NULL se desconhecido */
+const sfp_module_cache_entry_t *sfp_module_cache_lookup(sfp_module_cache_t *c, uint32_t fingerprint);
+
+/* Reserva a entrada do módulo (descarta a menos usada); o chamador preenche os dados */
+sfp_module_cache_entry_t *sfp_module_cache_insert(sfp_module_cache_t *c, uint32_t fingerprint);
+
+#endif /* SFP_CACHE_H */
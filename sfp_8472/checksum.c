@@ -0,0 +1,152 @@
+#include "checksum.h"
+#include "defs.h"
+#include <string.h>
+
+static const sfp_chk_desc_t chk_desc[SFP_CHK_COUNT] = {
+    [SFP_CHK_BASE] = { ADDR_A0, A0_IDENTIFIER, A0_CC_BASE },
+    [SFP_CHK_EXT]  = { ADDR_A0, A0_OPTIONS,    A0_CC_EXT  },
+    [SFP_CHK_DMI]  = { ADDR_A2, 0,             A2_CC_DMI  },
+};
+
+/* ============================================
+ * Soma
+ * ============================================ */
+uint8_t sfp_sum8(const uint8_t *data, size_t len)
+{
+    uint32_t lo = 0, hi = 0;
+    size_t i = 0;
+
+    if (!data)
+        return 0;
+
+    /* Cada lane de 16 bits recebe no máximo 255 por palavra: 256 palavras
+       por bloco antes de esvaziar os acumuladores */
+    while (len - i >= 4) {
+        size_t words = (len - i) / 4;
+        if (words > 256)
+            words = 256;
+
+        uint32_t a = 0, b = 0;
+        for (size_t w = 0; w < words; w++, i += 4) {
+            uint32_t v;
+            memcpy(&v, &data[i], sizeof(v));
+            a += v & 0x00FF00FFu;
+            b += (v >> 8) & 0x00FF00FFu;
+        }
+        lo += (a & 0xFFFFu) + (a >> 16);
+        hi += (b & 0xFFFFu) + (b >> 16);
+    }
+
+    uint32_t sum = lo + hi;
+    for (; i < len; i++)
+        sum += data[i];
+
+    return (uint8_t)sum;
+}
+
+const sfp_chk_desc_t *sfp_checksum_desc(sfp_chk_range_t r)
+{
+    if ((unsigned)r >= SFP_CHK_COUNT)
+        return NULL;
+    return &chk_desc[r];
+}
+
+bool sfp_checksum_range_ok(sfp_chk_range_t r, const uint8_t *image)
+{
+    const sfp_chk_desc_t *d = sfp_checksum_desc(r);
+
+    if (!d || !image)
+        return false;
+
+    return sfp_sum8(&image[d->start], (size_t)(d->cc - d->start)) == image[d->cc];
+}
+
+/* ============================================
+ * Resultados por fingerprint
+ * ============================================ */
+void sfp_checksum_init(sfp_checksum_t *c)
+{
+    if (!c)
+        return;
+
+    memset(c, 0, sizeof(*c));
+    c->current = -1;
+}
+
+void sfp_checksum_select(sfp_checksum_t *c, uint32_t fingerprint)
+{
+    if (!c)
+        return;
+
+    for (uint8_t i = 0; i < SFP_CHECKSUM_ENTRIES; i++) {
+        if (c->entry[i].used && c->entry[i].fingerprint == fingerprint) {
+            c->current = (int8_t)i;
+            return;
+        }
+    }
+
+    sfp_checksum_entry_t *e = &c->entry[c->next];
+    c->current = (int8_t)c->next;
+    c->next    = (uint8_t)((c->next + 1) % SFP_CHECKSUM_ENTRIES);
+
+    e->fingerprint = fingerprint;
+    e->checked     = 0;
+    e->ok          = 0;
+    e->used        = true;
+}
+
+void sfp_checksum_touch(sfp_checksum_t *c, uint8_t dev_addr, uint8_t offset, uint8_t len)
+{
+    if (!c || c->current < 0 || len == 0)
+        return;
+
+    sfp_checksum_entry_t *e = &c->entry[c->current];
+    unsigned end = (unsigned)offset + len;     /* exclusivo */
+
+    for (uint8_t r = 0; r < SFP_CHK_COUNT; r++) {
+        const sfp_chk_desc_t *d = &chk_desc[r];
+
+        /* Faixa somada mais o próprio byte de checksum */
+        if (d->dev_addr == dev_addr && offset <= d->cc && end > d->start)
+            e->checked &= (uint8_t)~SFP_CHK_MASK(r);
+    }
+}
+
+uint8_t sfp_checksum_verify(sfp_checksum_t *c, const uint8_t *a0, const uint8_t *a2)
+{
+    if (!c || c->current < 0)
+        return 0;
+
+    sfp_checksum_entry_t *e = &c->entry[c->current];
+
+    for (uint8_t r = 0; r < SFP_CHK_COUNT; r++) {
+        uint8_t m = SFP_CHK_MASK(r);
+
+        if (e->checked & m) {
+            c->skipped++;
+            continue;
+        }
+
+        const uint8_t *img = (chk_desc[r].dev_addr == ADDR_A0) ? a0 : a2;
+        if (!img)
+            continue;
+
+        if (sfp_checksum_range_ok((sfp_chk_range_t)r, img))
+            e->ok |= m;
+        else
+            e->ok &= (uint8_t)~m;
+        e->checked |= m;
+        c->computed++;
+    }
+
+    return (uint8_t)(e->ok & e->checked);
+}
+
+bool sfp_checksum_valid(const sfp_checksum_t *c, sfp_chk_range_t r)
+{
+    if (!c || c->current < 0 || (unsigned)r >= SFP_CHK_COUNT)
+        return false;
+
+    const sfp_checksum_entry_t *e = &c->entry[c->current];
+    return (e->checked & e->ok & SFP_CHK_MASK(r)) != 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file checksum.h
+ * @brief Checksums CC_BASE, CC_EXT (A0h) e CC_DMI (A2h) com revalidação incremental
+ *
+ * @details
+ *  Os três checksums da SFF-8472 são a soma de 8 bits de uma faixa fixa:
+ *
+ *      CC_BASE  A0h  0-62  -> byte 63
+ *      CC_EXT   A0h 64-94  -> byte 95
+ *      CC_DMI   A2h  0-94  -> byte 95
+ *
+ *  sfp_sum8() soma quatro bytes por iteração (palavras de 32 bits com
+ *  dois acumuladores de 16 bits por lane), sem exigir alinhamento.
+ *
+ *  O resultado de cada faixa fica guardado por fingerprint do módulo
+ *  (cache.h). Uma leitura parcial marca com sfp_checksum_touch() só as
+ *  faixas que ela sobrepôs; sfp_checksum_verify() recalcula apenas essas.
+ *  A janela dinâmica do A2h (96-119) não cruza nenhuma faixa, então
+ *  verificar a integridade a cada amostra não soma nada, e reinserir um
+ *  módulo já visto reaproveita os resultados.
+ */
+
+#ifndef SFP_CHECKSUM_H
+#define SFP_CHECKSUM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/** @brief Módulos com resultados lembrados */
+#ifndef SFP_CHECKSUM_ENTRIES
+#define SFP_CHECKSUM_ENTRIES  4
+#endif
+
+typedef enum {
+    SFP_CHK_BASE = 0,   /* CC_BASE */
+    SFP_CHK_EXT,        /* CC_EXT */
+    SFP_CHK_DMI,        /* CC_DMI */
+    SFP_CHK_COUNT
+} sfp_chk_range_t;
+
+#define SFP_CHK_MASK(r)     ((uint8_t)(1u << (r)))
+#define SFP_CHK_MASK_ALL    ((uint8_t)((1u << SFP_CHK_COUNT) - 1))
+
+typedef struct {
+    uint8_t dev_addr;   /* 0x50 ou 0x51 */
+    uint8_t start;      /* primeiro byte somado */
+    uint8_t cc;         /* byte do checksum (fim exclusivo da soma) */
+} sfp_chk_desc_t;
+
+typedef struct {
+    uint32_t fingerprint;
+    uint8_t  checked;   /* faixas com resultado atual (SFP_CHK_MASK) */
+    uint8_t  ok;        /* faixas que conferem */
+    bool     used;
+} sfp_checksum_entry_t;
+
+typedef struct {
+    sfp_checksum_entry_t entry[SFP_CHECKSUM_ENTRIES];
+    int8_t  current;    /* entrada do módulo presente ou -1 */
+    uint8_t next;       /* substituição circular */
+
+    /* Estatísticas */
+    uint32_t computed;  /* faixas efetivamente somadas */
+    uint32_t skipped;   /* faixas atendidas pelo resultado guardado */
+} sfp_checksum_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* Soma de 8 bits (mod 256) de len bytes */
+uint8_t sfp_sum8(const uint8_t *data, size_t len);
+
+const sfp_chk_desc_t *sfp_checksum_desc(sfp_chk_range_t r);
+
+/* Confere uma faixa na imagem do dispositivo (A0h ou A2h, a partir do byte 0) */
+bool sfp_checksum_range_ok(sfp_chk_range_t r, const uint8_t *image);
+
+void sfp_checksum_init(sfp_checksum_t *c);
+
+/* Módulo presente; um fingerprint novo começa sem resultados */
+void sfp_checksum_select(sfp_checksum_t *c, uint32_t fingerprint);
+
+/* Bytes [offset, offset+len) de dev_addr foram relidos */
+void sfp_checksum_touch(sfp_checksum_t *c, uint8_t dev_addr, uint8_t offset, uint8_t len);
+
+/* Recalcula as faixas pendentes (a0/a2 podem ser NULL) e devolve a máscara
+   das faixas que conferem */
+uint8_t sfp_checksum_verify(sfp_checksum_t *c, const uint8_t *a0, const uint8_t *a2);
+
+/* Resultado guardado da faixa (false se ainda não verificada) */
+bool sfp_checksum_valid(const sfp_checksum_t *c, sfp_chk_range_t r);
+
+#endif /* SFP_CHECKSUM_H */
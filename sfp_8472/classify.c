@@ -0,0 +1,249 @@
+#include "classify.h"
+#include "sff8024.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+/* ============================================
+ * Padrão
+ * ============================================ */
+
+/*
+ * Bits de compliance (bytes 3-10) em ordem de prioridade: o primeiro
+ * presente nomeia o módulo. Ethernet vem antes de Fibre Channel e SONET
+ * porque módulos multi-padrão costumam anunciar também um FC/SONET
+ * compatível; os bits de cabo só valem se nada mais específico aparecer.
+ */
+static const sfp_compliance_bit_t class_bits[] = {
+    SFP_CC_ETH_10G_BASE_ER,  SFP_CC_ETH_10G_BASE_LRM,
+    SFP_CC_ETH_10G_BASE_LR,  SFP_CC_ETH_10G_BASE_SR,
+    SFP_CC_ETH_1000_BASE_SX, SFP_CC_ETH_1000_BASE_LX,
+    SFP_CC_ETH_1000_BASE_CX, SFP_CC_ETH_1000_BASE_T,
+    SFP_CC_ETH_100_BASE_FX,  SFP_CC_ETH_100_BASE_LX,
+    SFP_CC_ETH_BASE_BX_10,   SFP_CC_ETH_BASE_PX,
+};
+
+static const sfp_compliance_bit_t class_bits_late[] = {
+    SFP_CC_OC_192_SR,
+    SFP_CC_OC_48_LR,    SFP_CC_OC_48_IR,    SFP_CC_OC_48_SR,
+    SFP_CC_OC_12_SM_LR, SFP_CC_OC_12_SM_IR, SFP_CC_OC_12_SR,
+    SFP_CC_OC_3_SM_LR,  SFP_CC_OC_3_SM_IR,  SFP_CC_OC_3_SR,
+    SFP_CC_INFINIBAND_1X_SX, SFP_CC_INFINIBAND_1X_LX,
+    SFP_CC_INFINIBAND_1X_COPPER_ACTIVE, SFP_CC_INFINIBAND_1X_COPPER_PASSIVE,
+    SFP_CC_ESCON_SMF, SFP_CC_ESCON_MMF,
+    SFP_CC_PASSIVE_CABLE, SFP_CC_ACTIVE_CABLE,
+};
+
+/* Byte 10: maior velocidade Fibre Channel anunciada */
+static const struct {
+    sfp_compliance_bit_t bit;
+    const char *name;
+} class_fc[] = {
+    { SFP_CC_CS_3200_MBPS, "32GFC" },
+    { SFP_CC_CS_1600_MBPS, "16GFC" },
+    { SFP_CC_CS_1200_MBPS, "10GFC" },
+    { SFP_CC_CS_800_MBPS,  "8GFC"  },
+    { SFP_CC_CS_400_MBPS,  "4GFC"  },
+    { SFP_CC_CS_200_MBPS,  "2GFC"  },
+    { SFP_CC_CS_100_MBPS,  "1GFC"  },
+};
+
+#define COUNT(a) (sizeof(a) / sizeof((a)[0]))
+
+static const char *first_bit(const sfp_compliance_decoded_t *dc,
+                             const sfp_compliance_bit_t *bits, size_t n)
+{
+    for (size_t i = 0; i < n; i++) {
+        if (sfp_cc_has(dc, bits[i]))
+            return sfp_compliance_bit_name(bits[i]);
+    }
+    return NULL;
+}
+
+static const char *class_standard(const sfp_a0h_base_t *a0)
+{
+    /* Byte 36 é mais específico que os bits (25G+, BASE-T, BiDi...) */
+    uint8_t ext = (uint8_t)a0->ext_compliance;
+    if (ext != EXT_SPEC_COMPLIANCE_UNSPECIFIED &&
+        ext != EXT_SPEC_COMPLIANCE_VENDOR_SPECIFIC &&
+        sfp_ext_compliance_known(ext))
+        return sfp_ext_compliance_name(ext);
+
+    const char *s = first_bit(&a0->dc, class_bits, COUNT(class_bits));
+    if (s)
+        return s;
+
+    for (size_t i = 0; i < COUNT(class_fc); i++) {
+        if (sfp_cc_has(&a0->dc, class_fc[i].bit))
+            return class_fc[i].name;
+    }
+
+    s = first_bit(&a0->dc, class_bits_late, COUNT(class_bits_late));
+    if (s)
+        return s;
+
+    /* Sem compliance: pelo menos o formato (SFP/SFP+, GBIC...) */
+    return sfp_identifier_name((uint8_t)a0->identifier);
+}
+
+/* ============================================
+ * Meio, alcance e taxa
+ * ============================================ */
+static sfp_media_t class_media(const sfp_a0h_base_t *a0)
+{
+    const sfp_compliance_decoded_t *dc = &a0->dc;
+
+    if (a0->variant == SFP_VARIANT_PASSIVE_CABLE)
+        return SFP_MEDIA_PASSIVE_CABLE;
+    if (a0->variant == SFP_VARIANT_ACTIVE_CABLE)
+        return SFP_MEDIA_ACTIVE_CABLE;
+    if (a0->connector == SFP_CONNECTOR_RJ45 || sfp_cc_has(dc, SFP_CC_ETH_1000_BASE_T))
+        return SFP_MEDIA_TWISTED_PAIR;
+
+    if (a0->smf_length_km || a0->smf_length_m || sfp_cc_has(dc, SFP_CC_SINGLE_MODE))
+        return SFP_MEDIA_SMF;
+    if (a0->om2_length_m || a0->om1_length_m || a0->om4_or_copper_length_m ||
+        a0->om3_or_cable_length_m ||
+        sfp_cc_has(dc, SFP_CC_MULTIMODE_M5) || sfp_cc_has(dc, SFP_CC_MULTIMODE_M6))
+        return SFP_MEDIA_MMF;
+
+    /* Sem alcance nem meio declarados: 850 nm é multimodo, 1260+ monomodo */
+    if (a0->wavelength_nm >= 1260)
+        return SFP_MEDIA_SMF;
+    if (a0->wavelength_nm)
+        return SFP_MEDIA_MMF;
+    return SFP_MEDIA_UNKNOWN;
+}
+
+static uint32_t class_reach_m(const sfp_a0h_base_t *a0, sfp_media_t media)
+{
+    switch (media) {
+    case SFP_MEDIA_PASSIVE_CABLE:
+    case SFP_MEDIA_ACTIVE_CABLE:
+        /* Byte 18: comprimento do cabo em metros */
+        return a0->om4_or_copper_length_m;
+    case SFP_MEDIA_TWISTED_PAIR:
+        /* Bytes 14-19 não descrevem o lance de par trançado */
+        return 0;
+    default:
+        break;
+    }
+
+    uint32_t reach = (uint32_t)a0->smf_length_km * 1000u;
+    if (a0->smf_length_m > reach)          reach = a0->smf_length_m;
+    if (a0->om2_length_m > reach)          reach = a0->om2_length_m;
+    if (a0->om1_length_m > reach)          reach = a0->om1_length_m;
+    if (a0->om4_or_copper_length_m > reach) reach = a0->om4_or_copper_length_m;
+    if (a0->om3_or_cable_length_m > reach) reach = a0->om3_or_cable_length_m;
+    return reach;
+}
+
+/* Byte 12 ou, acima de 25.4 GBd, byte 66 em 250 MBd (sfp_rate_decode()) */
+static uint32_t class_rate_mbd(const sfp_a0h_base_t *a0)
+{
+    sfp_rate_t rate;
+
+    if (!sfp_a0_get_rate(a0, &rate))
+        return 0;
+    return rate.nominal_mbd;
+}
+
+/* ============================================
+ * Texto
+ * ============================================ */
+
+/* Acrescenta um campo separado por " / "; trunca sem estourar o buffer */
+static size_t class_append(char *buf, size_t pos, const char *fmt, ...)
+{
+    if (pos >= SFP_CLASS_TEXT_LEN - 1)
+        return pos;
+
+    if (pos) {
+        int n = snprintf(buf + pos, SFP_CLASS_TEXT_LEN - pos, " / ");
+        pos = (n < 0) ? pos : pos + (size_t)n;
+        if (pos >= SFP_CLASS_TEXT_LEN)
+            return SFP_CLASS_TEXT_LEN - 1;
+    }
+
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf + pos, SFP_CLASS_TEXT_LEN - pos, fmt, ap);
+    va_end(ap);
+
+    if (n < 0)
+        return pos;
+    pos += (size_t)n;
+    return pos >= SFP_CLASS_TEXT_LEN ? SFP_CLASS_TEXT_LEN - 1 : pos;
+}
+
+static void class_text(sfp_class_t *c)
+{
+    size_t pos = 0;
+    c->text[0] = '\0';
+
+    pos = class_append(c->text, pos, "%s", c->standard);
+
+    if (c->wavelength_nm)
+        pos = class_append(c->text, pos, "%unm", (unsigned)c->wavelength_nm);
+
+    if (c->reach_m >= 1000 && c->reach_m % 1000 == 0)
+        pos = class_append(c->text, pos, "%lukm", (unsigned long)(c->reach_m / 1000));
+    else if (c->reach_m >= 1000)
+        pos = class_append(c->text, pos, "%lu.%lukm", (unsigned long)(c->reach_m / 1000),
+                           (unsigned long)(c->reach_m % 1000 / 100));
+    else if (c->reach_m)
+        pos = class_append(c->text, pos, "%lum", (unsigned long)c->reach_m);
+
+    if (c->connector != SFP_CONNECTOR_UNKNOWN && c->connector != SFP_CONNECTOR_NO_SEPARABLE)
+        pos = class_append(c->text, pos, "%s", sfp_connector_name((uint8_t)c->connector));
+
+    /* Taxa em Gb/s com até duas casas, sem zeros à direita (1.25, 10.3, 25.78) */
+    if (c->rate_mbd >= 1000) {
+        unsigned long h = (c->rate_mbd + 5) / 10;
+        unsigned long frac = h % 100;
+        if (frac == 0)
+            pos = class_append(c->text, pos, "%lu Gb/s", h / 100);
+        else if (frac % 10 == 0)
+            pos = class_append(c->text, pos, "%lu.%lu Gb/s", h / 100, frac / 10);
+        else
+            pos = class_append(c->text, pos, "%lu.%02lu Gb/s", h / 100, frac);
+    } else if (c->rate_mbd) {
+        pos = class_append(c->text, pos, "%lu Mb/s", (unsigned long)c->rate_mbd);
+    }
+}
+
+/* ============================================
+ * Classificação
+ * ============================================ */
+bool sfp_classify(const sfp_a0h_base_t *a0, sfp_class_t *out)
+{
+    if (!a0 || !out)
+        return false;
+
+    out->standard  = class_standard(a0);
+    out->media     = class_media(a0);
+    out->connector = (sfp_connector_type_t)a0->connector;
+    out->reach_m   = class_reach_m(a0, out->media);
+    out->rate_mbd  = class_rate_mbd(a0);
+    out->wavelength_nm = 0;
+    if (out->media == SFP_MEDIA_SMF || out->media == SFP_MEDIA_MMF)
+        sfp_a0_get_wavelength_nm(a0, &out->wavelength_nm);
+
+    class_text(out);
+    return true;
+}
+
+const char *sfp_media_name(sfp_media_t media)
+{
+    static const char *const names[] = {
+        [SFP_MEDIA_UNKNOWN]       = "Desconhecido",
+        [SFP_MEDIA_SMF]           = "Monomodo",
+        [SFP_MEDIA_MMF]           = "Multimodo",
+        [SFP_MEDIA_PASSIVE_CABLE] = "Cabo passivo",
+        [SFP_MEDIA_ACTIVE_CABLE]  = "Cabo ativo",
+        [SFP_MEDIA_TWISTED_PAIR]  = "Par trançado",
+    };
+
+    if ((unsigned)media >= COUNT(names))
+        return names[SFP_MEDIA_UNKNOWN];
+    return names[media];
+}
@@ -0,0 +1,55 @@
+/**
+ * @file classify.h
+ * @brief Classificação canônica do transceptor a partir do A0h decodificado
+ *
+ * @details
+ *  Junta o que o A0h diz sobre o módulo num descritor único: padrão
+ *  (Extended Compliance do byte 36 ou bits de compliance 3-10), meio,
+ *  comprimento de onda (60-61), maior alcance anunciado (14-19),
+ *  conector (2) e taxa nominal (12, ou 66 na forma estendida), além do
+ *  texto pronto para exibição, por exemplo "10GBASE-LR / 1310nm / 10km / LC / 10.3 Gb/s".
+ *
+ *  É calculado uma vez por inserção (e guardado no cache de módulos);
+ *  o menu só copia os campos, sem custo por quadro.
+ */
+
+#ifndef SFP_CLASSIFY_H
+#define SFP_CLASSIFY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "a0h.h"
+
+/** @brief Tamanho do texto do descritor (com terminador) */
+#define SFP_CLASS_TEXT_LEN  96
+
+typedef enum {
+    SFP_MEDIA_UNKNOWN = 0,
+    SFP_MEDIA_SMF,              /* fibra monomodo */
+    SFP_MEDIA_MMF,              /* fibra multimodo */
+    SFP_MEDIA_PASSIVE_CABLE,    /* DAC */
+    SFP_MEDIA_ACTIVE_CABLE,     /* cabo ativo (ACC/AOC) */
+    SFP_MEDIA_TWISTED_PAIR      /* BASE-T (RJ45) */
+} sfp_media_t;
+
+typedef struct {
+    const char          *standard;      /* padrão (texto constante) */
+    sfp_media_t          media;
+    uint16_t             wavelength_nm; /* 0 = não se aplica */
+    uint32_t             reach_m;       /* 0 = não informado */
+    sfp_connector_type_t connector;
+    uint32_t             rate_mbd;      /* taxa nominal; 0 = não informada */
+    char                 text[SFP_CLASS_TEXT_LEN];
+} sfp_class_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* Classifica o módulo; false só com argumentos nulos */
+bool sfp_classify(const sfp_a0h_base_t *a0, sfp_class_t *out);
+
+const char *sfp_media_name(sfp_media_t media);
+
+#endif /* SFP_CLASSIFY_H */
@@ -0,0 +1,4 @@
+#include "sff8024.h"
+
+/* Pools e vetores de consulta (gerados no build a partir de sff_spec.txt) */
+#include "sfp_8472/sff8024_tables.h"
@@ -0,0 +1,26 @@
+/**
+ * @file sff8024.h
+ * @brief Textos dos códigos SFF-8024 em tabelas compactas
+ *
+ * @details
+ *  Identifier (byte 0), Connector (byte 2), Encoding (byte 11), Extended
+ *  Compliance (byte 36) e Rate Identifier (byte 13) vêm de
+ *  sfp_8472/sff_spec.txt: tools/gen_sff_spec.py gera no build os enums e
+ *  as consultas sfp_<tabela>_name() (sff8024_codes.h) e as tabelas
+ *  (sff8024_tables.h, definidas em sff8024.c).
+ *
+ *  Cada tabela é um pool de textos sem repetição e um vetor indexado pelo
+ *  código; códigos reservados ou desconhecidos caem na sentinela do offset
+ *  0. A consulta é uma comparação e duas ou três leituras, sem laço, e
+ *  tudo é const (flash no RP2040). Menu, prints e ferramentas de host
+ *  usam os mesmos textos.
+ */
+
+#ifndef SFP_SFF8024_H
+#define SFP_SFF8024_H
+
+#include <stdint.h>
+
+#include "sfp_8472/sff8024_codes.h"
+
+#endif /* SFP_SFF8024_H */
@@ -0,0 +1,81 @@
+#include "vendor_db.h"
+#include "defs.h"
+#include <string.h>
+
+typedef struct {
+    const char *prefix;
+    uint8_t     len;
+    const char *family;
+    uint16_t    quirks;
+} sfp_vendor_pn_t;
+
+typedef struct {
+    uint32_t    oui;
+    const char *name;
+    uint16_t    quirks;
+    uint8_t     first_pn;
+    uint8_t     pn_count;
+} sfp_vendor_entry_t;
+
+/* vdb_pn, vdb_vendor e vdb_slot (gerados no build) */
+#include "sfp_8472/vendor_db_table.h"
+
+_Static_assert(VDB_VENDORS < 256, "vdb_slot guarda o índice em 8 bits");
+_Static_assert(VDB_PN_MAX <= 8, "prefixos por OUI acima do limite da busca");
+
+/* ============================================
+ * Consulta
+ * ============================================ */
+static inline uint32_t vdb_hash(uint32_t oui)
+{
+    return (oui * VDB_HASH_MULT) >> (32 - VDB_HASH_BITS);
+}
+
+bool sfp_vendor_lookup(uint32_t oui, const char *pn, size_t pn_len, sfp_vendor_info_t *out)
+{
+    if (!out)
+        return false;
+
+    uint8_t s = vdb_slot[vdb_hash(oui & 0xFFFFFFu)];
+    if (s == 0 || vdb_vendor[s - 1].oui != (oui & 0xFFFFFFu))
+        return false;
+
+    const sfp_vendor_entry_t *v = &vdb_vendor[s - 1];
+    out->oui    = v->oui;
+    out->vendor = v->name;
+    out->family = NULL;
+    out->quirks = v->quirks;
+
+    /* Do prefixo mais longo para o mais curto: o primeiro é o mais específico */
+    for (uint8_t i = 0; pn && i < v->pn_count; i++) {
+        const sfp_vendor_pn_t *p = &vdb_pn[v->first_pn + i];
+        if (p->len <= pn_len && memcmp(pn, p->prefix, p->len) == 0) {
+            out->family  = p->family;
+            out->quirks |= p->quirks;
+            break;
+        }
+    }
+    return true;
+}
+
+bool sfp_vendor_lookup_a0(const sfp_a0h_base_t *a0, sfp_vendor_info_t *out)
+{
+    if (!a0)
+        return false;
+
+    return sfp_vendor_lookup(sfp_vendor_oui_to_u32(a0), a0->vendor_pn,
+                             sizeof(a0->vendor_pn), out);
+}
+
+bool sfp_vendor_lookup_raw(const uint8_t *a0_data, sfp_vendor_info_t *out)
+{
+    if (!a0_data)
+        return false;
+
+    uint32_t oui = ((uint32_t)a0_data[A0_VENDOR_OUI] << 16) |
+                   ((uint32_t)a0_data[A0_VENDOR_OUI + 1] << 8) |
+                   ((uint32_t)a0_data[A0_VENDOR_OUI + 2]);
+
+    return sfp_vendor_lookup(oui, (const char *)&a0_data[A0_VENDOR_PN],
+                             A0_VENDOR_REV - A0_VENDOR_PN, out);
+}
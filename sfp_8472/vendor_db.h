@@ -0,0 +1,53 @@
+/**
+ * @file vendor_db.h
+ * @brief Base estática de fabricantes: OUI + prefixo do Vendor PN
+ *
+ * @details
+ *  A tabela é gerada no build (tools/gen_vendor_db.py) a partir de
+ *  sfp_8472/vendor_db.txt e fica toda em const: no RP2040 mora na flash
+ *  e a consulta não usa RAM além da pilha.
+ *
+ *  A OUI (A0h 37-39) é localizada por hash perfeito (um slot por OUI,
+ *  sem sondagem). Os prefixos de part number da OUI são comparados do
+ *  mais longo para o mais curto, no máximo VDB_PN_MAX por fabricante,
+ *  então a consulta tem custo limitado independentemente do tamanho da
+ *  base.
+ */
+
+#ifndef SFP_VENDOR_DB_H
+#define SFP_VENDOR_DB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "a0h.h"
+
+/* ============================================
+ * Quirks conhecidos
+ * ============================================ */
+#define SFP_QUIRK_IGNORE_LOS        (1u << 0)   /* LOS sem significado (BASE-T) */
+#define SFP_QUIRK_IGNORE_TX_FAULT   (1u << 1)   /* TX_FAULT ativo em operação normal */
+#define SFP_QUIRK_I2C_STD_ONLY      (1u << 2)   /* EEPROM só confiável em 100 kHz */
+
+typedef struct {
+    uint32_t    oui;
+    const char *vendor;     /* nome canônico */
+    const char *family;     /* família do part number ou NULL */
+    uint16_t    quirks;     /* SFP_QUIRK_*: fabricante | part number */
+} sfp_vendor_info_t;
+
+/**********************************************
+ * Function Prototypes
+ **********************************************/
+
+/* OUI de 24 bits + Vendor PN cru (pn_len bytes, completado com espaços) */
+bool sfp_vendor_lookup(uint32_t oui, const char *pn, size_t pn_len, sfp_vendor_info_t *out);
+
+/* Mesma consulta a partir do A0h decodificado */
+bool sfp_vendor_lookup_a0(const sfp_a0h_base_t *a0, sfp_vendor_info_t *out);
+
+/* ... ou da imagem crua do A0h (bytes 0-95), antes de decodificar */
+bool sfp_vendor_lookup_raw(const uint8_t *a0_data, sfp_vendor_info_t *out);
+
+#endif /* SFP_VENDOR_DB_H */
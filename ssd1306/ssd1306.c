@@ -6,13 +6,38 @@
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
 #include "hardware/i2c.h"
+#include "I2C/i2c.h"
 #include "math.h"
+#include "I2C/trace.h"
+#include "I2C/stats.h"
 
 #if defined(SSD1306_USE_I2C)
 
 const uint8_t I2C_SDA_PIN = 14;
 const uint8_t I2C_SCL_PIN = 15;
 
+// Optional transaction trace and latency histogram of the low-level write path
+static struct sfp_trace *ssd1306_trace;
+static struct sfp_stats *ssd1306_stats;
+
+void ssd1306_SetTrace(struct sfp_trace *tr) {
+    ssd1306_trace = tr;
+}
+
+void ssd1306_SetStats(struct sfp_stats *st) {
+    ssd1306_stats = st;
+}
+
+static void ssd1306_I2CWrite(const uint8_t* buffer, size_t len) {
+    uint64_t start = time_us_64();
+    int ret = sfp_i2c_write(SSD1306_I2C_PORT, SSD1306_I2C_ADDR, buffer, len);
+    uint64_t end = time_us_64();
+
+    sfp_trace_record(ssd1306_trace, SFP_TRACE_WRITE, SSD1306_I2C_ADDR, buffer[0],
+                     buffer, len, ret, start, end);
+    sfp_stats_record(ssd1306_stats, SSD1306_I2C_ADDR, (uint32_t)(end - start), ret >= 0);
+}
+
 void ssd1306_Reset(void) {
     /* for I2C - do nothing */
 }
@@ -23,7 +48,7 @@ void ssd1306_WriteCommand(uint8_t byte) {
     buffer[0] = 0x00;            // Endereço do registrador
     buffer[1] = byte;            // Dado a ser enviado
 
-    i2c_write_blocking(SSD1306_I2C_PORT, SSD1306_I2C_ADDR, buffer, sizeof(buffer), false);
+    ssd1306_I2CWrite(buffer, sizeof(buffer));
 }
 
 // Send data
@@ -32,7 +57,7 @@ void ssd1306_WriteData(uint8_t* buffer, size_t buff_size) {
     temp_buffer[0] = 0x40;             // Endereço do registrador (Control byte)
     memcpy(&temp_buffer[1], buffer, buff_size); // Copia os dados para o buffer temporário
 
-    i2c_write_blocking(SSD1306_I2C_PORT, SSD1306_I2C_ADDR, temp_buffer, sizeof(temp_buffer), false);
+    ssd1306_I2CWrite(temp_buffer, sizeof(temp_buffer));
 }
 
 #else
@@ -65,12 +90,8 @@ void ssd1306_Init(void) {
     sleep_ms(100);
 
     // I2C is "open drain", pull ups to keep signal high when no data is being
-    // sent
-    i2c_init(i2c1, SSD1306_I2C_CLK * 1000);
-    gpio_set_function(I2C_SDA_PIN, GPIO_FUNC_I2C);
-    gpio_set_function(I2C_SCL_PIN, GPIO_FUNC_I2C);
-    gpio_pull_up(I2C_SDA_PIN);
-    gpio_pull_up(I2C_SCL_PIN);
+    // sent. Also hooks the bus into the interrupt-driven driver (I2C/i2c.c).
+    sfp_i2c_init(SSD1306_I2C_PORT, I2C_SDA_PIN, I2C_SCL_PIN, SSD1306_I2C_CLK * 1000);
 
     // Init OLED
     ssd1306_SetDisplayOn(0); //display off
@@ -187,6 +208,26 @@ void ssd1306_UpdateScreen(void) {
     }
 }
 
+/*
+ * Pack one RAM page as a single I2C transaction for an external writer
+ * (e.g. the transaction scheduler): page/column address commands with the
+ * continuation bit set, followed by the page data.
+ * Returns the packet length (SSD1306_PAGE_PACKET_SIZE) or 0 on bad page.
+ */
+size_t ssd1306_PackPage(uint8_t page, uint8_t *out) {
+    if(page >= SSD1306_HEIGHT/8 || out == NULL) {
+        return 0;
+    }
+
+    out[0] = 0x80; out[1] = 0xB0 + page;                         // Set the current RAM page address.
+    out[2] = 0x80; out[3] = 0x00 + SSD1306_X_OFFSET_LOWER;
+    out[4] = 0x80; out[5] = 0x10 + SSD1306_X_OFFSET_UPPER;
+    out[6] = 0x40;                                               // Data follows
+    memcpy(&out[7], &SSD1306_Buffer[SSD1306_WIDTH*page], SSD1306_WIDTH);
+
+    return SSD1306_PAGE_PACKET_SIZE;
+}
+
 /*
  * Draw one pixel in the screenbuffer
  * X => X Coordinate
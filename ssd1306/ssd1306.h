@@ -9,7 +9,11 @@ _BEGIN_STD_C
 
 #include "ssd1306_conf.h"
 
-#define SSD1306_I2C_CLK 100
+/* Max SSD1306 I2C clock in kHz (Fast-mode, tCYCLE >= 2.5 us per datasheet).
+   The effective rate is negotiated at startup in main.c. */
+#ifndef SSD1306_I2C_CLK
+#define SSD1306_I2C_CLK 400
+#endif
 
 #ifdef SSD1306_X_OFFSET
 #define SSD1306_X_OFFSET_LOWER (SSD1306_X_OFFSET & 0x0F)
@@ -77,10 +81,14 @@ typedef struct {
     const uint8_t *const char_width;    /**< Proportional character width in pixels (NULL for monospaced) */
 } SSD1306_Font_t;
 
+/* One I2C transaction per RAM page: 3 commands (Co=1) + data control byte + page data */
+#define SSD1306_PAGE_PACKET_SIZE (7 + SSD1306_WIDTH)
+
 // Procedure definitions
 void ssd1306_Init(void);
 void ssd1306_Fill(SSD1306_COLOR color);
 void ssd1306_UpdateScreen(void);
+size_t ssd1306_PackPage(uint8_t page, uint8_t *out);
 void ssd1306_DrawPixel(uint8_t x, uint8_t y, SSD1306_COLOR color);
 char ssd1306_WriteChar(const char ch, SSD1306_Font_t Font, SSD1306_COLOR color);
 char ssd1306_WriteString(const char* str, SSD1306_Font_t Font, SSD1306_COLOR color);
@@ -134,6 +142,20 @@ void ssd1306_WriteCommand(uint8_t byte);
 void ssd1306_WriteData(uint8_t* buffer, size_t buff_size);
 SSD1306_Error_t ssd1306_FillBuffer(uint8_t* buf, uint32_t len);
 
+/**
+ * @brief Records every low-level write in a transaction trace (I2C/trace.h).
+ * @param[in] tr Trace buffer, or NULL to disable.
+ */
+struct sfp_trace;
+void ssd1306_SetTrace(struct sfp_trace *tr);
+
+/**
+ * @brief Adds the duration of every low-level write to a latency histogram (I2C/stats.h).
+ * @param[in] st Histogram set, or NULL to disable.
+ */
+struct sfp_stats;
+void ssd1306_SetStats(struct sfp_stats *st);
+
 _END_STD_C
 
 #endif // __SSD1306_H__
@@ -0,0 +1,298 @@
+#!/usr/bin/env python3
+"""Gera os enums, tabelas de texto e offsets SFF-8024/8472 a partir de sff_spec.txt.
+
+Uso: gen_sff_spec.py <sff_spec.txt> <diretório de saída>
+
+Saídas (em <saída>/sfp_8472/):
+  sff8024_codes.h     enums dos códigos + consultas inline sfp_<tabela>_name()
+                      e sfp_<tabela>_known()
+  sff8024_tables.h    definições das tabelas (incluído só por sff8024.c)
+  sff8472_offsets.h   enums de offsets de A0h/A2h (incluído por defs.h)
+
+Cada tabela de texto é um pool de strings (sentinela no offset 0, textos
+repetidos guardados uma vez) e um vetor indexado pelo código que vai só
+até o maior código com texto. O gerador escolhe, por tabela, o layout
+menor em flash:
+  - direto: offset no pool por código (8 bits se o pool cabe em 256 bytes);
+  - indexado: índice de 8 bits por código + offset por texto, para tabelas
+    longas e esparsas (faixas de vendor specific, 0xFF).
+Em ambos a consulta é no máximo uma comparação e três leituras.
+
+O tamanho de cada vetor sai como SFF8024_<TABELA>_CODES e os cabeçalhos
+gerados conferem em tempo de compilação que o maior código do enum com
+texto cabe no vetor, que os vetores têm o tamanho declarado, que o índice
+de 8 bits alcança todos os textos e que o pool cabe no tipo do offset.
+"""
+
+import os
+import re
+import sys
+
+SPEC = "sfp_8472/sff_spec.txt"
+HEADER = f"/* Gerado por tools/gen_sff_spec.py a partir de {SPEC} — não editar */\n"
+
+
+def fail(path, line, msg):
+    sys.exit(f"{path}:{line}: {msg}")
+
+
+def parse_code(path, n, s):
+    if not re.fullmatch(r"0x[0-9A-Fa-f]{2}", s):
+        fail(path, n, f"código inválido '{s}' (esperado 0xNN)")
+    return int(s, 16)
+
+
+def check_text(path, n, text):
+    if '"' in text or "\\" in text:
+        fail(path, n, "texto com aspas ou barra invertida")
+
+
+def parse(path):
+    codes, offsets = [], []
+    names = set()
+    cur = None
+
+    def new_name(n, name):
+        if not re.fullmatch(r"[A-Z][A-Z0-9_]*", name):
+            fail(path, n, f"nome inválido '{name}'")
+        if name in names:
+            fail(path, n, f"nome '{name}' repetido")
+        names.add(name)
+
+    with open(path, encoding="utf-8") as f:
+        for n, raw in enumerate(f, 1):
+            line = raw.split("#", 1)[0].strip()
+            if not line:
+                continue
+
+            if line.startswith("@codes "):
+                head, _, sentinel = line[len("@codes "):].partition(";")
+                parts = head.split()
+                if len(parts) != 2 or not sentinel.strip():
+                    fail(path, n, "esperado '@codes <tabela> <tipo> ; <texto>'")
+                check_text(path, n, sentinel.strip())
+                cur = {"kind": "codes", "table": parts[0], "type": parts[1],
+                       "sentinel": sentinel.strip(), "rows": [], "line": n}
+                codes.append(cur)
+                continue
+            if line.startswith("@offsets "):
+                cur = {"kind": "offsets", "type": line.split()[1], "rows": [], "line": n}
+                offsets.append(cur)
+                continue
+            if line.startswith("@group "):
+                if not cur or cur["kind"] != "offsets":
+                    fail(path, n, "@group fora de um bloco @offsets")
+                cur["rows"].append(("group", line[len("@group "):].strip()))
+                continue
+            if cur is None:
+                fail(path, n, "linha fora de um bloco @codes/@offsets")
+
+            cols = [c.strip() for c in line.split(";")]
+            if len(cols) != 3:
+                fail(path, n, "esperados 3 campos separados por ';'")
+            key, name, text = cols
+            check_text(path, n, text)
+
+            if cur["kind"] == "codes":
+                lo, _, hi = key.partition("-")
+                first = parse_code(path, n, lo)
+                last = parse_code(path, n, hi) if hi else first
+                if name == "-":
+                    if not text:
+                        fail(path, n, "faixa sem nome precisa de texto")
+                elif hi:
+                    fail(path, n, "faixa de códigos não vira membro do enum (use '-')")
+                else:
+                    new_name(n, name)
+                prev = cur["rows"][-1][1] if cur["rows"] else -1
+                if first <= prev or last < first:
+                    fail(path, n, "códigos fora de ordem ou repetidos")
+                cur["rows"].append((first, last, None if name == "-" else name, text))
+            else:
+                if not re.fullmatch(r"\d+", key) or int(key) > 255:
+                    fail(path, n, f"offset inválido '{key}'")
+                new_name(n, name)
+                prev = [r for r in cur["rows"] if r[0] == "field"]
+                if prev and int(key) <= prev[-1][1]:
+                    fail(path, n, "offsets fora de ordem ou repetidos")
+                cur["rows"].append(("field", int(key), name, text))
+
+    for blk in codes + offsets:
+        if not blk["rows"]:
+            fail(path, blk["line"], "bloco vazio")
+    return codes, offsets
+
+
+def build_table(blk):
+    """Pool deduplicado e vetores de consulta de uma tabela @codes."""
+    pool, where = [], {}
+
+    def intern(text):
+        if text not in where:
+            where[text] = len(pool)
+            pool.append(text)
+        return where[text]
+
+    intern(blk["sentinel"])
+    limit = 1 + max(last for _, last, _, text in blk["rows"] if text)
+    idx = [0] * limit
+    for first, last, _, text in blk["rows"]:
+        if text:
+            for code in range(first, last + 1):
+                idx[code] = intern(text)
+
+    start, size = [], 0
+    for text in pool:
+        start.append(size)
+        size += len(text.encode("utf-8")) + 1
+    if size > 0xFFFF:
+        sys.exit(f"gen_sff_spec: pool de '{blk['table']}' passa de 64 KiB")
+    width = 1 if size <= 0x100 else 2
+
+    direct = limit * width
+    indexed = limit + len(pool) * width
+    if direct <= indexed or len(pool) > 256:
+        return {"pool": pool, "size": size, "limit": limit, "idx": None,
+                "off": [start[i] for i in idx], "width": width}
+    return {"pool": pool, "size": size, "limit": limit, "idx": idx,
+            "off": start, "width": width}
+
+
+def comment(text):
+    return f" /* {text} */" if text else ""
+
+
+def emit_codes(codes, out):
+    o = [HEADER, "#ifndef SFP_SFF8024_CODES_H", "#define SFP_SFF8024_CODES_H", "",
+         "#include <stdbool.h>", "#include <stdint.h>", ""]
+    for blk in codes:
+        members = [(first, name, text) for first, _, name, text in blk["rows"] if name]
+        width = max(len(name) for _, name, _ in members)
+        o.append(f"/* {blk['table']} ({blk['type']}) */")
+        o.append("typedef enum {")
+        for i, (code, name, text) in enumerate(members):
+            sep = "," if i + 1 < len(members) else " "
+            o.append(f"    {name:<{width}} = 0x{code:02X}{sep}{comment(text)}".rstrip())
+        o.append(f"}} {blk['type']};\n")
+
+    for blk in codes:
+        t, tb = blk["table"], blk["built"]
+        off_type = "uint8_t" if tb["width"] == 1 else "uint16_t"
+        limit = f"SFF8024_{t.upper()}_CODES"
+        top = max((first, name) for first, _, name, text in blk["rows"] if name and text)[1]
+        o.append(f"#define {limit} {tb['limit']}u\n")
+        o.append(f"_Static_assert({top} < {limit}, \"{t}: código do enum fora do vetor\");")
+        o.append(f"_Static_assert({limit} <= 256u, \"{t}: vetor maior que o código de 8 bits\");\n")
+        o.append(f"extern const char sff8024_{t}_pool[];")
+        if tb["idx"]:
+            o.append(f"extern const uint8_t sff8024_{t}_idx[{limit}];")
+            o.append(f"extern const {off_type} sff8024_{t}_off[{len(tb['off'])}];\n")
+        else:
+            o.append(f"extern const {off_type} sff8024_{t}_off[{limit}];\n")
+
+        lookup = f"sff8024_{t}_idx[code]" if tb["idx"] else "code"
+        entry = f"sff8024_{t}_off[{lookup}]"
+        o.append(f"static inline const char *sfp_{t}_name(uint8_t code)")
+        o.append("{")
+        if tb["limit"] == 256:
+            o.append(f"    return sff8024_{t}_pool + {entry};")
+        else:
+            o.append(f"    return sff8024_{t}_pool + (code < {limit} ? {entry} : 0u);")
+        o.append("}\n")
+
+        # Código com texto próprio (fora da sentinela)
+        slot = f"sff8024_{t}_idx[code]" if tb["idx"] else f"sff8024_{t}_off[code]"
+        o.append(f"static inline bool sfp_{t}_known(uint8_t code)")
+        o.append("{")
+        if tb["limit"] == 256:
+            o.append(f"    return {slot} != 0;")
+        else:
+            o.append(f"    return code < {limit} && {slot} != 0;")
+        o.append("}\n")
+    o.append("#endif /* SFP_SFF8024_CODES_H */")
+    write(out, o)
+
+
+def c_array(o, decl, values):
+    o.append(f"{decl} = {{")
+    for i in range(0, len(values), 16):
+        o.append("    " + ", ".join(str(v) for v in values[i:i + 16]) + ",")
+    o.append("};")
+
+
+def count(name):
+    return f"(sizeof({name}) / sizeof({name}[0]))"
+
+
+def emit_tables(codes, out):
+    o = [HEADER]
+    for blk in codes:
+        t, tb = blk["table"], blk["built"]
+        off_type = "uint8_t" if tb["width"] == 1 else "uint16_t"
+        limit = f"SFF8024_{t.upper()}_CODES"
+        pool, idx, off = (f"sff8024_{t}_{a}" for a in ("pool", "idx", "off"))
+        flash = tb["size"] + (tb["limit"] if tb["idx"] else 0) + len(tb["off"]) * tb["width"]
+        o.append(f"/* {t}: {tb['limit']} códigos, {len(tb['pool'])} textos, "
+                 f"{'indexada' if tb['idx'] else 'direta'}, {flash} bytes */")
+        o.append(f"const char sff8024_{t}_pool[] =")
+        for i, s in enumerate(tb["pool"]):
+            o.append(f'    "{s}\\0"' + (";" if i + 1 == len(tb["pool"]) else ""))
+        if tb["idx"]:
+            c_array(o, f"const uint8_t sff8024_{t}_idx[{tb['limit']}]", tb["idx"])
+        c_array(o, f"const {off_type} sff8024_{t}_off[{len(tb['off'])}]", tb["off"])
+
+        # Completude: vetor por código do tamanho declarado, índice de 8 bits
+        # alcançando todos os textos e pool (+ NUL final) no tipo do offset
+        if tb["idx"]:
+            o.append(f"_Static_assert({count(idx)} == {limit}, \"{t}: índice incompleto\");")
+            o.append(f"_Static_assert({count(off)} <= 256u, \"{t}: textos além do índice de 8 bits\");")
+        else:
+            o.append(f"_Static_assert({count(off)} == {limit}, \"{t}: vetor de offsets incompleto\");")
+        o.append(f"_Static_assert(sizeof({pool}) - 1u <= {off_type[:-2].upper()}_MAX + 1u,")
+        o.append(f"               \"{t}: pool não cabe em {off_type}\");")
+        o.append("")
+    write(out, o)
+
+
+def emit_offsets(offsets, out):
+    o = [HEADER, "#ifndef SFP_SFF8472_OFFSETS_H", "#define SFP_SFF8472_OFFSETS_H", ""]
+    for blk in offsets:
+        fields = [r for r in blk["rows"] if r[0] == "field"]
+        width = max(len(r[2]) for r in fields)
+        last = fields[-1][2]
+        o.append("typedef enum {")
+        for r in blk["rows"]:
+            if r[0] == "group":
+                if o[-1] != "typedef enum {":
+                    o.append("")
+                o.append(f"    /* {r[1]} */")
+                continue
+            _, offset, name, text = r
+            sep = " " if name == last else ","
+            o.append(f"    {name:<{width}} = {offset:>3}{sep}{comment(text)}".rstrip())
+        o.append(f"}} {blk['type']};\n")
+    o.append("#endif /* SFP_SFF8472_OFFSETS_H */")
+    write(out, o)
+
+
+def write(path, lines):
+    with open(path, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("uso: gen_sff_spec.py <sff_spec.txt> <diretório de saída>")
+    codes, offsets = parse(sys.argv[1])
+    for blk in codes:
+        blk["built"] = build_table(blk)
+
+    out = os.path.join(sys.argv[2], "sfp_8472")
+    os.makedirs(out, exist_ok=True)
+    emit_codes(codes, os.path.join(out, "sff8024_codes.h"))
+    emit_tables(codes, os.path.join(out, "sff8024_tables.h"))
+    emit_offsets(offsets, os.path.join(out, "sff8472_offsets.h"))
+
+
+if __name__ == "__main__":
+    main()
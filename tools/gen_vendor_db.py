@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Gera a tabela de fabricantes (vendor_db_table.h) a partir de vendor_db.txt.
+
+Uso: gen_vendor_db.py <vendor_db.txt> <saida.h>
+
+Cada OUI vira uma entrada de fabricante; os prefixos de part number da
+mesma OUI ficam contíguos, do mais longo para o mais curto, para que o
+primeiro que casar seja o mais específico. As OUIs são indexadas por um
+hash multiplicativo perfeito: o gerador procura o multiplicador que leva
+cada OUI a um slot distinto, então a consulta é um produto, um shift e
+uma comparação.
+"""
+
+import re
+import sys
+
+LEN_VENDOR = 19     # SFP_Data.fabricante (menu.h) menos o terminador
+LEN_FAMILY = 19     # SFP_Data.tipo
+LEN_PN = 16         # Vendor PN (A0h 40-55)
+PN_MAX = 8          # prefixos por OUI (limite da busca linear)
+
+
+def fail(path, line, msg):
+    sys.exit(f"{path}:{line}: {msg}")
+
+
+def parse(path):
+    vendors = {}
+    with open(path, encoding="utf-8") as f:
+        for n, raw in enumerate(f, 1):
+            line = raw.split("#", 1)[0].strip()
+            if not line:
+                continue
+            cols = [c.strip() for c in line.split(";")]
+            if len(cols) != 5:
+                fail(path, n, "esperados 5 campos separados por ';'")
+            oui_s, pn, name, family, quirks = cols
+
+            if not re.fullmatch(r"[0-9A-Fa-f]{2}(:[0-9A-Fa-f]{2}){2}", oui_s):
+                fail(path, n, f"OUI inválida '{oui_s}'")
+            oui = int(oui_s.replace(":", ""), 16)
+            if not name or len(name) > LEN_VENDOR:
+                fail(path, n, f"fabricante vazio ou maior que {LEN_VENDOR}")
+            if len(family) > LEN_FAMILY:
+                fail(path, n, f"família maior que {LEN_FAMILY}")
+            if not pn or len(pn) > LEN_PN or '"' in pn or "\\" in pn:
+                fail(path, n, f"prefixo de PN inválido '{pn}'")
+            flags = [q.strip() for q in quirks.split("|") if q.strip()]
+            for q in flags:
+                if not re.fullmatch(r"[A-Z0-9_]+", q):
+                    fail(path, n, f"quirk inválido '{q}'")
+
+            v = vendors.setdefault(oui, {"name": None, "quirks": None, "pn": {}, "line": n})
+            if pn == "*":
+                if v["name"] is not None:
+                    fail(path, n, f"OUI {oui_s} com mais de uma linha '*'")
+                if family:
+                    fail(path, n, "a linha '*' não tem família")
+                v["name"], v["quirks"] = name, flags
+            else:
+                if pn in v["pn"]:
+                    fail(path, n, f"prefixo '{pn}' repetido para {oui_s}")
+                v["pn"][pn] = (name, family, flags, n)
+
+    for oui, v in vendors.items():
+        if v["name"] is None:
+            fail(path, v["line"], f"OUI {oui:06X} sem linha '*'")
+        if len(v["pn"]) > PN_MAX:
+            fail(path, v["line"], f"OUI {oui:06X} com mais de {PN_MAX} prefixos")
+        for pn, (name, _, _, n) in v["pn"].items():
+            if name != v["name"]:
+                fail(path, n, f"fabricante '{name}' diverge de '{v['name']}' na mesma OUI")
+    return vendors
+
+
+def perfect_hash(keys):
+    """Menor tabela 2^bits (e multiplicador) sem colisões."""
+    bits = max(1, (len(keys) - 1).bit_length())
+    while bits <= 8:
+        mult = 0x9E3779B1
+        for _ in range(1 << 16):
+            slots = {((k * mult) & 0xFFFFFFFF) >> (32 - bits) for k in keys}
+            if len(slots) == len(keys):
+                return bits, mult
+            mult = (mult * 1664525 + 1013904223) & 0xFFFFFFFF | 1
+        bits += 1
+    sys.exit("gen_vendor_db: nenhum hash perfeito com até 256 slots")
+
+
+def quirk_expr(flags):
+    return " | ".join(f"SFP_QUIRK_{q}" for q in flags) if flags else "0"
+
+
+def c_str(s):
+    return f'"{s}"' if s else "NULL"
+
+
+def emit(vendors, src, out):
+    ouis = sorted(vendors)
+    bits, mult = perfect_hash(ouis)
+
+    pn_rows, vendor_rows = [], []
+    for oui in ouis:
+        v = vendors[oui]
+        first = len(pn_rows)
+        for pn in sorted(v["pn"], key=lambda p: (-len(p), p)):
+            _, family, flags, _ = v["pn"][pn]
+            pn_rows.append((pn, family, flags))
+        vendor_rows.append((oui, v["name"], v["quirks"], first, len(pn_rows) - first))
+
+    slot = [0] * (1 << bits)
+    for i, oui in enumerate(ouis):
+        slot[((oui * mult) & 0xFFFFFFFF) >> (32 - bits)] = i + 1
+
+    o = []
+    o.append(f"/* Gerado por tools/gen_vendor_db.py a partir de {src} — não editar */\n")
+    o.append(f"#define VDB_HASH_BITS   {bits}")
+    o.append(f"#define VDB_HASH_MULT   0x{mult:08X}u")
+    o.append(f"#define VDB_VENDORS     {len(vendor_rows)}")
+    o.append(f"#define VDB_PREFIXES    {len(pn_rows)}")
+    o.append(f"#define VDB_PN_MAX      {max(r[4] for r in vendor_rows)}\n")
+
+    o.append("static const sfp_vendor_pn_t vdb_pn[VDB_PREFIXES] = {")
+    for pn, family, flags in pn_rows:
+        o.append(f'    {{ "{pn}", {len(pn)}, {c_str(family)}, {quirk_expr(flags)} }},')
+    o.append("};\n")
+
+    o.append("static const sfp_vendor_entry_t vdb_vendor[VDB_VENDORS] = {")
+    for oui, name, flags, first, count in vendor_rows:
+        o.append(f'    {{ 0x{oui:06X}u, "{name}", {quirk_expr(flags)}, {first}, {count} }},')
+    o.append("};\n")
+
+    o.append("/* Índice em vdb_vendor + 1 (0 = slot vazio) */")
+    o.append("static const uint8_t vdb_slot[1u << VDB_HASH_BITS] = {")
+    for i in range(0, len(slot), 16):
+        o.append("    " + ", ".join(str(s) for s in slot[i:i + 16]) + ",")
+    o.append("};")
+
+    with open(out, "w", encoding="utf-8") as f:
+        f.write("\n".join(o) + "\n")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("uso: gen_vendor_db.py <vendor_db.txt> <saida.h>")
+    emit(parse(sys.argv[1]), "sfp_8472/vendor_db.txt", sys.argv[2])
+
+
+if __name__ == "__main__":
+    main()
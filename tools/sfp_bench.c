@@ -0,0 +1,628 @@
+/**
+ * @file sfp_bench.c
+ * @brief Micro-benchmark no host de cada sfp_parse_* e dos textos do menu
+ *
+ * @details
+ *  Mede, sobre um corpus de módulos, o custo de cada parser do A0h/A2h,
+ *  de cada função de texto de menu/sfp_strings.c e da decodificação
+ *  completa de um módulo (A0h 0-95 + limiares e RX do A2h):
+ *
+ *      ns/op     menor média entre ROUNDS rodadas
+ *      bytes/op  bytes da EEPROM que a operação consome (parsers) ou
+ *                bytes de texto que produz (strings, média no corpus)
+ *
+ *  O corpus embutido tem uma imagem A0h+A2h por classe de módulo
+ *  (óptico SR/LR/ER, 1G SX/LX, DAC, AOC e 1000BASE-T), montada campo a
+ *  campo conforme a SFF-8472 com fabricantes e part numbers reais e
+ *  checksums corretos. Dumps reais entram pela linha de comando: binário
+ *  com o A0h nos primeiros bytes e, a partir do byte 256, o A2h (formato
+ *  do `ethtool -m <if> raw on`).
+ *
+ *  Antes de medir, confere que a cadeia de parsers por campo
+ *  (sfp_parse_a0_base + sfp_parse_a0_extended) e sfp_parse_a0_all()
+ *  produzem os mesmos sfp_a0h_base_t/sfp_a0h_extended_t e que a visão
+ *  sem cópia (a0_view.h) decodifica os mesmos valores, sobre o corpus e
+ *  sobre imagens A0h pseudoaleatórias (as três variantes de mídia do
+ *  byte 8, checksums corretos). Divergência sai com código 1.
+ *
+ *  Com --budget, cada caso listado no arquivo tem um teto em ns/op; um
+ *  caso acima do teto faz o programa sair com código 2 (alvo `bench`).
+ *
+ *  Uso: sfp_bench [--iters N] [--budget arquivo] [dump.bin ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a0_view.h"
+#include "sfp_8472/a2h.h"
+#include "sfp_8472/checksum.h"
+#include "sfp_8472/classify.h"
+#include "sfp_8472/defs.h"
+#include "menu/sfp_strings.h"
+
+#define CORPUS_MAX      64
+#define VERIFY_RANDOM   64          /* imagens A0h aleatórias na conferência */
+#define DEFAULT_ITERS   20000
+#define ROUNDS          5           /* Vale a menor média das rodadas */
+#define NAME_MAX_LEN    40
+#define DUMP_A2_OFFSET  256         /* A2h num dump do ethtool */
+
+typedef struct {
+    char    name[NAME_MAX_LEN];
+    uint8_t a0[SFP_A0_SIZE];
+    uint8_t a2[SFP_A2_SIZE];
+
+    /* Decodificado uma vez: entrada das funções de texto */
+    sfp_a0h_base_t dec;
+} bench_module_t;
+
+typedef struct {
+    sfp_a0h_base_t     a0;
+    sfp_a0h_extended_t ext;
+    sfp_a2h_t          a2;
+    sfp_compliance_codes_t cc;
+    sfp_class_t        cls;
+    const char        *str;
+} bench_out_t;
+
+typedef struct {
+    const char *name;
+    void (*fn)(const bench_module_t *m, bench_out_t *o);
+    uint16_t bytes;     /* bytes da EEPROM por operação; 0 = texto (medido) */
+} bench_case_t;
+
+static bench_module_t corpus[CORPUS_MAX];
+static size_t corpus_len;
+
+static volatile uint32_t sink;
+
+/* ============================================
+ * Corpus embutido
+ * ============================================ */
+typedef struct {
+    const char *name;
+    const char *vendor;
+    uint32_t    oui;
+    const char *pn;
+    const char *sn;
+    uint8_t     connector;
+    uint8_t     cc[8];          /* bytes 3-10 */
+    uint8_t     encoding;
+    uint8_t     br;             /* 100 MBd */
+    uint8_t     len[6];         /* bytes 14-19 */
+    uint8_t     ext_compliance;
+    uint16_t    wavelength;     /* ou compliance do cabo (byte 60) */
+    uint8_t     diag;           /* byte 92 */
+} module_spec_t;
+
+static const module_spec_t builtin[] = {
+    { "10G SR",     "FINISAR CORP.", 0x009065, "FTLX8571D3BCL",   "AQL0K1Q",  0x07,
+      { 0x10, 0, 0, 0, 0, 0, 0, 0 }, 0x06, 0x67, { 0, 0, 8, 3, 10, 30 }, 0x00, 850, 0x68 },
+    { "10G LR",     "FINISAR CORP.", 0x009065, "FTLX1471D3BCL",   "UNB1A2C",  0x07,
+      { 0x20, 0, 0, 0, 0, 0, 0, 0 }, 0x06, 0x67, { 10, 100, 0, 0, 0, 0 }, 0x00, 1310, 0x68 },
+    { "10G ER",     "OEM",           0x000000, "SFP-10G-ER",      "G2010ER1", 0x07,
+      { 0x80, 0, 0, 0, 0, 0, 0, 0 }, 0x06, 0x67, { 40, 255, 0, 0, 0, 0 }, 0x00, 1550, 0x68 },
+    { "1G SX",      "CISCO-AVAGO",   0x00000C, "GLC-SX-MMD",      "AGJ1623R", 0x07,
+      { 0, 0, 0, 0x01, 0, 0, 0, 0 }, 0x01, 0x0D, { 0, 0, 55, 27, 0, 0 }, 0x00, 850, 0x68 },
+    { "1G LX",      "FINISAR CORP.", 0x009065, "FTLF1318P3BTL",   "PKS2H4T",  0x07,
+      { 0, 0, 0, 0x02, 0, 0, 0, 0 }, 0x01, 0x0D, { 10, 100, 55, 55, 0, 0 }, 0x00, 1310, 0x68 },
+    { "10G DAC",    "CISCO-MOLEX",   0x00000C, "SFP-H10GB-CU1M",  "MOC1547",  0x21,
+      { 0, 0, 0, 0, 0, 0x04, 0, 0 }, 0x00, 0x67, { 0, 0, 0, 0, 1, 0 }, 0x00, 0x0100, 0x00 },
+    { "10G AOC",    "OEM",           0x000000, "SFP-10G-AOC3M",   "A1903003", 0x23,
+      { 0, 0, 0, 0, 0, 0x08, 0, 0 }, 0x06, 0x67, { 0, 0, 0, 0, 3, 0 }, 0x00, 0x0C00, 0x68 },
+    { "1000BASE-T", "FINISAR CORP.", 0x009065, "FCLF8521P2BTL",   "PQD5C6H",  0x22,
+      { 0, 0, 0, 0x08, 0, 0, 0, 0 }, 0x01, 0x0D, { 0, 0, 0, 0, 100, 0 }, 0x00, 0, 0x00 },
+};
+
+static void put_text(uint8_t *dst, const char *s, size_t len)
+{
+    memset(dst, ' ', len);
+    memcpy(dst, s, strlen(s) < len ? strlen(s) : len);
+}
+
+static void put_u16(uint8_t *dst, uint16_t v)
+{
+    dst[0] = (uint8_t)(v >> 8);
+    dst[1] = (uint8_t)v;
+}
+
+/* Limiares e medidas plausíveis (DMI calibrado internamente) */
+static void a2_build(uint8_t *a2, unsigned n)
+{
+    static const uint16_t thr[20] = {
+        75 * 256, (uint16_t)(-5 * 256), 70 * 256, 0,       /* temperatura (q8.8) */
+        36000, 30000, 35000, 31000,                         /* VCC (100 uV) */
+        45000, 1000, 40000, 2000,                           /* bias (2 uA) */
+        12589, 1000, 10000, 1585,                           /* TX (0.1 uW) */
+        12589, 100, 10000, 158                              /* RX (0.1 uW) */
+    };
+
+    memset(a2, 0, SFP_A2_SIZE);
+    for (unsigned i = 0; i < 20; i++)
+        put_u16(&a2[A2_TEMP_HIGH_ALARM + 2 * i], thr[i]);
+    a2[A2_CC_DMI] = sfp_sum8(a2, A2_CC_DMI);
+
+    put_u16(&a2[A2_TEMP_CURR],     (uint16_t)((30 + n) * 256));
+    put_u16(&a2[A2_VCC_CURR],      33000 + 10 * n);
+    put_u16(&a2[A2_TX_BIAS_CURR],  3000 + 100 * n);
+    put_u16(&a2[A2_TX_POWER_CURR], 5000 + 50 * n);
+    put_u16(&a2[A2_RX_POWER],      4000 + 70 * n);
+}
+
+static void module_build(bench_module_t *m, const module_spec_t *s, unsigned n)
+{
+    uint8_t *a0 = m->a0;
+
+    snprintf(m->name, sizeof(m->name), "%s", s->name);
+    memset(a0, 0, SFP_A0_SIZE);
+
+    a0[A0_IDENTIFIER]     = SFP_ID_SFP;
+    a0[A0_EXT_IDENTIFIER] = SFP_EXT_IDENTIFIER_EXPECTED;
+    a0[A0_CONNECTOR]      = s->connector;
+    memcpy(&a0[A0_TRANSCEIVER], s->cc, sizeof(s->cc));
+    a0[A0_ENCODING]       = s->encoding;
+    a0[A0_BR_NOMINAL]     = s->br;
+    memcpy(&a0[A0_LENGTH_SMF_KM], s->len, sizeof(s->len));
+    put_text(&a0[A0_VENDOR_NAME], s->vendor, SFP_A0_LEN_VENDOR_NAME);
+    a0[A0_EXT_TRANSCEIVER] = s->ext_compliance;
+    a0[A0_VENDOR_OUI]     = (uint8_t)(s->oui >> 16);
+    a0[A0_VENDOR_OUI + 1] = (uint8_t)(s->oui >> 8);
+    a0[A0_VENDOR_OUI + 2] = (uint8_t)s->oui;
+    put_text(&a0[A0_VENDOR_PN], s->pn, A0_VENDOR_REV - A0_VENDOR_PN);
+    put_text(&a0[A0_VENDOR_REV], "A", A0_WAVELENGTH - A0_VENDOR_REV);
+    put_u16(&a0[A0_WAVELENGTH], s->wavelength);
+    a0[A0_CC_BASE] = sfp_sum8(a0, A0_CC_BASE);
+
+    put_u16(&a0[A0_OPTIONS], 0x001A);                  /* LOS, TX_FAULT, TX_DISABLE */
+    put_text(&a0[A0_VENDOR_SN], s->sn, SFP_A0_LEN_VENDOR_SN);
+    put_text(&a0[A0_DATE_CODE], "210315", SFP_A0_LEN_DATE_CODE);
+    a0[A0_DIAG_MONITORING_TYPE] = s->diag;
+    a0[A0_ENHANCED_OPTIONS]     = s->diag ? 0xF0 : 0x00;
+    a0[A0_COMPLIANCE]           = s->diag ? 0x03 : 0x00;
+    a0[A0_CC_EXT] = sfp_sum8(&a0[A0_OPTIONS], A0_CC_EXT - A0_OPTIONS);
+
+    a2_build(m->a2, n);
+}
+
+static void corpus_generate(void)
+{
+    for (unsigned i = 0; i < sizeof(builtin) / sizeof(builtin[0]); i++)
+        module_build(&corpus[corpus_len++], &builtin[i], i);
+}
+
+static void corpus_load(const char *path)
+{
+    static uint8_t buf[DUMP_A2_OFFSET + SFP_A2_SIZE];
+
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "sfp_bench: %s: não foi possível abrir\n", path);
+        return;
+    }
+    memset(buf, 0, sizeof(buf));
+    size_t n = fread(buf, 1, sizeof(buf), f);
+    fclose(f);
+
+    if (n < SFP_A0_SIZE) {
+        fprintf(stderr, "sfp_bench: %s: %zu bytes (mínimo %d)\n", path, n, SFP_A0_SIZE);
+        return;
+    }
+    if (corpus_len >= CORPUS_MAX)
+        return;
+
+    bench_module_t *m = &corpus[corpus_len++];
+    const char *base = strrchr(path, '/');
+    snprintf(m->name, sizeof(m->name), "%s", base ? base + 1 : path);
+    memcpy(m->a0, buf, SFP_A0_SIZE);
+    memcpy(m->a2, &buf[DUMP_A2_OFFSET], SFP_A2_SIZE);   /* zeros sem A2h */
+}
+
+/* ============================================
+ * Conferência: cadeia x tabela x visão
+ * ============================================ */
+static uint32_t lcg(uint32_t *s)
+{
+    *s = *s * 1664525u + 1013904223u;
+    return *s >> 8;
+}
+
+/* Bytes aleatórios com identificador, variante do byte 8, vendor name e
+   checksums coerentes: cobre os valores especiais dos alcances */
+static void random_a0(uint8_t *d, unsigned n, uint32_t *seed)
+{
+    static const char *vendors[] = { "FINISAR CORP.", "CISCO", "FS", "Intel Corp", "AVAGO" };
+    static const uint8_t media[] = { 0x00, 0x04, 0x08 };   /* óptico, passivo, ativo */
+
+    for (size_t i = 0; i < SFP_A0_SIZE; i++)
+        d[i] = (uint8_t)lcg(seed);
+
+    d[A0_IDENTIFIER]      = SFP_ID_SFP;
+    d[A0_EXT_IDENTIFIER]  = SFP_EXT_IDENTIFIER_EXPECTED;
+    d[A0_TRANSCEIVER + 5] = (d[A0_TRANSCEIVER + 5] & ~0x0Cu) | media[n % 3];
+    put_text(&d[A0_VENDOR_NAME], vendors[n % (sizeof(vendors) / sizeof(vendors[0]))],
+             SFP_A0_LEN_VENDOR_NAME);
+    d[A0_CC_BASE] = sfp_sum8(d, A0_CC_BASE);
+    d[A0_CC_EXT]  = sfp_sum8(&d[A0_OPTIONS], A0_CC_EXT - A0_OPTIONS);
+}
+
+/* Visão sobre a imagem crua x campos já decodificados */
+static bool view_matches(const uint8_t *d, const sfp_a0h_base_t *a, const sfp_a0h_extended_t *e)
+{
+    sfp_a0_view_t v = sfp_a0_view(d);
+    sfp_compliance_decoded_t dc = sfp_a0v_compliance(v);
+    char name[SFP_A0_VIEW_TEXT_MAX], expected[SFP_A0_VIEW_TEXT_MAX];
+    sfp_nominal_rate_status_t rs;
+    sfp_smf_length_status_t ss;
+    sfp_om3_length_status_t s3;
+    uint16_t nm = 0;
+
+    bool ok = sfp_a0v_identifier(v) == a->identifier &&
+              sfp_a0v_connector(v) == (sfp_connector_type_t)a->connector &&
+              dc.bits == a->dc.bits &&
+              sfp_a0v_has(v, SFP_CC_SEE_BYTE_62) == sfp_cc_has(&a->dc, SFP_CC_SEE_BYTE_62) &&
+              sfp_a0v_is_copper(v) == a->is_copper &&
+              sfp_a0v_variant(v) == a->variant &&
+              sfp_a0v_nominal_rate_mbd(v, &rs) == a->rate.nominal_mbd && rs == a->rate.status &&
+              sfp_a0v_smf_length_km(v, &ss) == a->smf_length_km && ss == a->smf_status_km &&
+              sfp_a0v_smf_length_m(v, &ss) == a->smf_length_m && ss == a->smf_status_m &&
+              sfp_a0v_om2_length_m(v, NULL) == a->om2_length_m &&
+              sfp_a0v_om1_length_m(v, NULL) == a->om1_length_m &&
+              sfp_a0v_om4_or_copper_length_m(v, NULL) == a->om4_or_copper_length_m &&
+              sfp_a0v_om3_or_cable_length_m(v, &s3) == a->om3_or_cable_length_m &&
+              s3 == a->om3_or_cable_status &&
+              sfp_a0v_vendor_oui(v) == sfp_vendor_oui_to_u32(a) &&
+              sfp_a0v_cc_base_is_valid(v) == a->cc_base_is_valid &&
+              sfp_a0v_cc_ext_is_valid(v) == e->cc_ext_is_valid &&
+              sfp_a0v_calibration(v) == e->calibration &&
+              sfp_a0v_dmi_implemented(v) == e->dmi_implemented &&
+              sfp_a0v_change_addr_req(v) == e->change_addr_req;
+
+    if (sfp_a0v_wavelength_nm(v, &nm))
+        ok = ok && nm == a->wavelength_nm;
+
+    bool valid = sfp_a0v_vendor_name(v, name);
+    return ok && valid == sfp_a0_get_vendor_name(a, expected) && strcmp(name, expected) == 0;
+}
+
+static bool verify_one(const uint8_t *d, const char *name)
+{
+    sfp_a0h_base_t a, b;
+    sfp_a0h_extended_t ea, eb;
+
+    memset(&a, 0, sizeof(a));
+    memset(&b, 0, sizeof(b));
+    memset(&ea, 0, sizeof(ea));
+    memset(&eb, 0, sizeof(eb));
+
+    sfp_parse_a0_base(d, &a);
+    sfp_parse_a0_extended(d, &ea);
+    sfp_parse_a0_all(d, &b, &eb);
+
+    if (memcmp(&a, &b, sizeof(a)) != 0 || memcmp(&ea, &eb, sizeof(ea)) != 0) {
+        fprintf(stderr, "sfp_bench: %s: cadeia por campo diverge de sfp_parse_a0_all\n", name);
+        return false;
+    }
+    if (!view_matches(d, &b, &eb)) {
+        fprintf(stderr, "sfp_bench: %s: visão diverge dos parsers\n", name);
+        return false;
+    }
+    return true;
+}
+
+static bool verify(void)
+{
+    uint8_t d[SFP_A0_SIZE];
+    uint32_t seed = 0x5F8472u;
+    char name[NAME_MAX_LEN];
+
+    for (size_t i = 0; i < corpus_len; i++) {
+        if (!verify_one(corpus[i].a0, corpus[i].name))
+            return false;
+    }
+    for (unsigned n = 0; n < VERIFY_RANDOM; n++) {
+        random_a0(d, n, &seed);
+        snprintf(name, sizeof(name), "aleatória %u", n);
+        if (!verify_one(d, name))
+            return false;
+    }
+    return true;
+}
+
+/* ============================================
+ * Casos
+ * ============================================ */
+
+/* Parsers do A0h base: nome, bytes lidos */
+#define A0_BASE_CASES(X)                                            \
+    X(identifier, 1) X(ext_identifier, 1) X(connector, 1)           \
+    X(encoding, 1) X(nominal_rate, 3) X(rate_identifier, 1)         \
+    X(smf_km, 1) X(smf_m, 1) X(om2, 1) X(om1, 1)                    \
+    X(om4_or_copper, 2) X(om3_or_cable, 2) X(vendor_name, 16)       \
+    X(ext_compliance, 1) X(vendor_oui, 3) X(vendor_pn, 16)          \
+    X(vendor_rev, 4) X(media, 3) X(cc_base, 64)
+
+#define A0_EXT_CASES(X)                                             \
+    X(dmi, 1) X(change_addr_req, 1) X(calibration, 1)               \
+    X(options, 2) X(br_margins, 2) X(vendor_sn, 16)                 \
+    X(date_code, 8) X(rx_power_type, 1) X(enhanced_options, 1)      \
+    X(sff_8472_compliance, 1) X(cc_ext, 32)
+
+#define A2_CASES(X)                                                 \
+    X(data_ready, 1)                                                \
+    X(temp_high_alarm, 2) X(temp_low_alarm, 2)                      \
+    X(temp_high_warning, 2) X(temp_low_warning, 2)                  \
+    X(vcc_high_alarm, 2) X(vcc_low_alarm, 2)                        \
+    X(vcc_high_warning, 2) X(vcc_low_warning, 2)                    \
+    X(tx_bias_high_alarm, 2) X(tx_bias_low_alarm, 2)                \
+    X(tx_bias_high_warning, 2) X(tx_bias_low_warning, 2)            \
+    X(tx_power_high_alarm, 2) X(tx_power_low_alarm, 2)              \
+    X(tx_power_high_warning, 2) X(tx_power_low_warning, 2)          \
+    X(rx_power_high_alarm, 2) X(rx_power_low_alarm, 2)              \
+    X(rx_power_high_warning, 2) X(rx_power_low_warning, 2)          \
+    X(thresholds, 40) X(rx_power, 2)
+
+#define CC_BYTES(X) X(3) X(4) X(5) X(6) X(7) X(8) X(9) X(10)
+
+#define X(f, n) static void a0_##f(const bench_module_t *m, bench_out_t *o) \
+    { sfp_parse_a0_base_##f(m->a0, &o->a0); }
+A0_BASE_CASES(X)
+#undef X
+
+#define X(f, n) static void ext_##f(const bench_module_t *m, bench_out_t *o) \
+    { sfp_parse_a0_extended_##f(m->a0, &o->ext); }
+A0_EXT_CASES(X)
+#undef X
+
+#define X(f, n) static void a2_##f(const bench_module_t *m, bench_out_t *o) \
+    { sfp_parse_a2h_##f(m->a2, &o->a2); }
+A2_CASES(X)
+#undef X
+
+#define X(b) static void str_cc##b(const bench_module_t *m, bench_out_t *o) \
+    { o->str = sfp_compliance_byte##b##_to_string(&m->dec.dc); }
+CC_BYTES(X)
+#undef X
+
+static void a0_compliance(const bench_module_t *m, bench_out_t *o)
+{
+    sfp_parse_a0_base_compliance(m->a0, &o->cc);
+}
+
+static void a0_fc_speed_2(const bench_module_t *m, bench_out_t *o)
+{
+    sfp_parse_a0_fc_speed_2(m->a0, &o->a0);
+}
+
+static void a0_base(const bench_module_t *m, bench_out_t *o)
+{
+    sfp_parse_a0_base(m->a0, &o->a0);
+}
+
+static void a0_extended(const bench_module_t *m, bench_out_t *o)
+{
+    sfp_parse_a0_extended(m->a0, &o->ext);
+}
+
+/* O que sfp_parse_a0_all() substitui: os dois parsers em sequência */
+static void a0_chain(const bench_module_t *m, bench_out_t *o)
+{
+    sfp_parse_a0_base(m->a0, &o->a0);
+    sfp_parse_a0_extended(m->a0, &o->ext);
+}
+
+static void a0_all(const bench_module_t *m, bench_out_t *o)
+{
+    sfp_parse_a0_all(m->a0, &o->a0, &o->ext);
+}
+
+/* O que main.c decodifica num módulo novo */
+static void module_full(const bench_module_t *m, bench_out_t *o)
+{
+    sfp_parse_a0_all(m->a0, &o->a0, &o->ext);
+    sfp_parse_a2h_thresholds(m->a2, &o->a2);
+    sfp_parse_a2h_rx_power(m->a2, &o->a2);
+}
+
+static void str_ext_compliance(const bench_module_t *m, bench_out_t *o)
+{
+    o->str = ext_compliance_to_string(m->dec.ext_compliance);
+}
+
+static void str_identifier(const bench_module_t *m, bench_out_t *o)
+{
+    o->str = sfp_identifier_to_string(m->dec.identifier);
+}
+
+static void str_encoding(const bench_module_t *m, bench_out_t *o)
+{
+    o->str = sfp_encoding_to_string(m->dec.encoding);
+}
+
+static void str_om2(const bench_module_t *m, bench_out_t *o)
+{
+    o->str = sfp_om2_to_string(m->dec.om2_status, m->dec.om2_length_m);
+}
+
+/* Uma vez por inserção em main.c; o texto é a saída medida */
+static void classify(const bench_module_t *m, bench_out_t *o)
+{
+    sfp_classify(&m->dec, &o->cls);
+    o->str = o->cls.text;
+}
+
+static const bench_case_t cases[] = {
+#define X(f, n) { "sfp_parse_a0_base_" #f, a0_##f, n },
+    A0_BASE_CASES(X)
+#undef X
+    { "sfp_parse_a0_base_compliance", a0_compliance, 8 },
+    { "sfp_parse_a0_fc_speed_2",      a0_fc_speed_2, 1 },
+#define X(f, n) { "sfp_parse_a0_extended_" #f, ext_##f, n },
+    A0_EXT_CASES(X)
+#undef X
+#define X(f, n) { "sfp_parse_a2h_" #f, a2_##f, n },
+    A2_CASES(X)
+#undef X
+    { "sfp_parse_a0_base",            a0_base,     A0_CC_BASE + 1 + 2 },  /* + 66-67 (taxa) */
+    { "sfp_parse_a0_extended",        a0_extended, A0_CC_EXT + 1 - A0_OPTIONS },
+    { "cadeia_por_campo",             a0_chain,    A0_CC_EXT + 1 },
+    { "sfp_parse_a0_all",             a0_all,      A0_CC_EXT + 1 },
+    { "modulo_completo",              module_full, A0_CC_EXT + 1 + 40 + 2 },
+    { "ext_compliance_to_string",     str_ext_compliance, 0 },
+    { "sfp_identifier_to_string",     str_identifier,     0 },
+#define X(b) { "sfp_compliance_byte" #b "_to_string", str_cc##b, 0 },
+    CC_BYTES(X)
+#undef X
+    { "sfp_encoding_to_string",       str_encoding, 0 },
+    { "sfp_om2_to_string",            str_om2,      0 },
+    { "sfp_classify",                 classify,     0 },
+};
+
+#define CASES (sizeof(cases) / sizeof(cases[0]))
+
+/* ============================================
+ * Medição
+ * ============================================ */
+static double now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static double bench(const bench_case_t *c, unsigned iters)
+{
+    bench_out_t o;
+    memset(&o, 0, sizeof(o));
+
+    double t0 = now_ns();
+    for (unsigned it = 0; it < iters; it++) {
+        for (size_t i = 0; i < corpus_len; i++) {
+            c->fn(&corpus[i], &o);
+            sink += o.a0.identifier + o.ext.calibration + (uint32_t)o.a2.rx_power + o.cc.byte3 +
+                    (o.str ? (uint8_t)o.str[0] : 0);
+        }
+    }
+    return (now_ns() - t0) / ((double)iters * (double)corpus_len);
+}
+
+/* Bytes de texto produzidos, em média no corpus */
+static double text_bytes(const bench_case_t *c)
+{
+    bench_out_t o;
+    size_t total = 0;
+
+    memset(&o, 0, sizeof(o));
+    for (size_t i = 0; i < corpus_len; i++) {
+        o.str = NULL;
+        c->fn(&corpus[i], &o);
+        total += o.str ? strlen(o.str) : 0;
+    }
+    return (double)total / (double)corpus_len;
+}
+
+/* ============================================
+ * Orçamento: "<caso> <ns/op máximo>" por linha, '#' comenta
+ * ============================================ */
+static double budget[CASES];
+
+static bool budget_load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "sfp_bench: %s: não foi possível abrir\n", path);
+        return false;
+    }
+
+    char line[128];
+    unsigned n = 0;
+    while (fgets(line, sizeof(line), f)) {
+        n++;
+        char *hash = strchr(line, '#');
+        if (hash)
+            *hash = '\0';
+
+        char name[64];
+        double ns;
+        int fields = sscanf(line, "%63s %lf", name, &ns);
+        if (fields <= 0)
+            continue;
+
+        size_t i = 0;
+        while (i < CASES && strcmp(cases[i].name, name) != 0)
+            i++;
+        if (fields != 2 || ns <= 0 || i == CASES) {
+            fprintf(stderr, "sfp_bench: %s:%u: entrada inválida\n", path, n);
+            fclose(f);
+            return false;
+        }
+        budget[i] = ns;
+    }
+    fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned iters = DEFAULT_ITERS;
+    const char *budget_path = NULL;
+
+    corpus_generate();
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--iters") == 0 && i + 1 < argc) {
+            unsigned long v = strtoul(argv[++i], NULL, 10);
+            if (v > 0)
+                iters = (unsigned)v;
+        } else if (strcmp(argv[i], "--budget") == 0 && i + 1 < argc) {
+            budget_path = argv[++i];
+        } else {
+            corpus_load(argv[i]);
+        }
+    }
+    if (budget_path && !budget_load(budget_path))
+        return 1;
+    if (!verify())
+        return 1;
+
+    for (size_t i = 0; i < corpus_len; i++)
+        sfp_parse_a0_all(corpus[i].a0, &corpus[i].dec, &(sfp_a0h_extended_t){ 0 });
+
+    printf("Corpus: %zu módulos, %u iterações\n", corpus_len, iters);
+    for (size_t i = 0; i < corpus_len; i++)
+        printf("  %-12s %.16s\n", corpus[i].name, corpus[i].dec.vendor_pn);
+    printf("\n%-40s %9s %9s %9s\n", "caso", "ns/op", "bytes/op", "teto");
+
+    int over = 0;
+    double chain = 0, table = 0;
+    for (size_t c = 0; c < CASES; c++) {
+        bench(&cases[c], iters / 10 + 1);      /* aquecimento */
+
+        double best = 0;
+        for (int r = 0; r < ROUNDS; r++) {
+            double t = bench(&cases[c], iters);
+            if (r == 0 || t < best)
+                best = t;
+        }
+
+        if (cases[c].fn == a0_chain) chain = best;
+        if (cases[c].fn == a0_all)   table = best;
+
+        double bytes = cases[c].bytes ? cases[c].bytes : text_bytes(&cases[c]);
+        printf("%-40s %9.1f %9.1f", cases[c].name, best, bytes);
+        if (budget[c] > 0) {
+            printf(" %9.0f%s", budget[c], best > budget[c] ? "  ESTOURO" : "");
+            over += best > budget[c];
+        }
+        printf("\n");
+    }
+    printf("\n%-40s %9.2fx\n", "ganho da tabela sobre a cadeia", chain / table);
+
+    if (over) {
+        fprintf(stderr, "sfp_bench: %d caso(s) acima do orçamento\n", over);
+        return 2;
+    }
+    return 0;
+}
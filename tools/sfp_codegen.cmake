@@ -0,0 +1,32 @@
+# Tabelas geradas no build, compartilhadas pelo firmware e pelas ferramentas
+# de host. Quem inclui define SFP_ROOT e usa SFP_GEN_DIR (include) e
+# SFP_GENERATED_SOURCES (fontes do alvo).
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+set(SFP_GEN_DIR ${CMAKE_CURRENT_BINARY_DIR}/generated)
+
+# Base de fabricantes (sfp_8472/vendor_db.h)
+add_custom_command(
+    OUTPUT  ${SFP_GEN_DIR}/sfp_8472/vendor_db_table.h
+    COMMAND ${CMAKE_COMMAND} -E make_directory ${SFP_GEN_DIR}/sfp_8472
+    COMMAND ${Python3_EXECUTABLE} ${SFP_ROOT}/tools/gen_vendor_db.py
+            ${SFP_ROOT}/sfp_8472/vendor_db.txt
+            ${SFP_GEN_DIR}/sfp_8472/vendor_db_table.h
+    DEPENDS ${SFP_ROOT}/tools/gen_vendor_db.py ${SFP_ROOT}/sfp_8472/vendor_db.txt
+    COMMENT "Gerando vendor_db_table.h")
+
+# Códigos SFF-8024 e offsets SFF-8472 (sfp_8472/sff8024.h, sfp_8472/defs.h)
+set(SFP_SPEC_OUTPUTS
+    ${SFP_GEN_DIR}/sfp_8472/sff8024_codes.h
+    ${SFP_GEN_DIR}/sfp_8472/sff8024_tables.h
+    ${SFP_GEN_DIR}/sfp_8472/sff8472_offsets.h)
+add_custom_command(
+    OUTPUT  ${SFP_SPEC_OUTPUTS}
+    COMMAND ${Python3_EXECUTABLE} ${SFP_ROOT}/tools/gen_sff_spec.py
+            ${SFP_ROOT}/sfp_8472/sff_spec.txt ${SFP_GEN_DIR}
+    DEPENDS ${SFP_ROOT}/tools/gen_sff_spec.py ${SFP_ROOT}/sfp_8472/sff_spec.txt
+    COMMENT "Gerando tabelas SFF-8024/8472")
+
+set(SFP_GENERATED_SOURCES
+    ${SFP_GEN_DIR}/sfp_8472/vendor_db_table.h
+    ${SFP_SPEC_OUTPUTS})
@@ -0,0 +1,30 @@
+/**
+ * @file check.h
+ * @brief Asserções mínimas dos testes de host (ctest)
+ *
+ * @details
+ *  CHECK() registra a falha com arquivo/linha e segue o teste, para que
+ *  uma execução mostre todas as divergências; CHECK_DONE() devolve o
+ *  código de saída (0 = tudo certo) que o ctest interpreta.
+ */
+
+#ifndef SFP_TEST_CHECK_H
+#define SFP_TEST_CHECK_H
+
+#include <stdio.h>
+
+static unsigned check_failures;
+
+#define CHECK(cond)                                                        \
+    do {                                                                   \
+        if (!(cond)) {                                                     \
+            fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #cond); \
+            check_failures++;                                              \
+        }                                                                  \
+    } while (0)
+
+#define CHECK_DONE()                                                       \
+    (check_failures ? (fprintf(stderr, "%u verificações falharam\n",      \
+                               check_failures), 1) : 0)
+
+#endif /* SFP_TEST_CHECK_H */
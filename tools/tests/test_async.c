@@ -0,0 +1,179 @@
+/**
+ * @file test_async.c
+ * @brief Máquina de estados da leitura assíncrona (I2C/async.c)
+ *
+ * @details
+ *  Usa read_start/read_poll do backend emulado: start -> BUSY enquanto a
+ *  latência injetada não passa, depois DONE, ou ERROR com NAK/timeout.
+ *  Cobre também o caminho bloqueante de backends sem leitura assíncrona.
+ */
+
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/async.h"
+#include "I2C/retry.h"
+#include "sfp_8472/a0h.h"
+#include "check.h"
+
+typedef struct {
+    unsigned calls;
+    bool ok;
+} cb_log_t;
+
+static void on_done(sfp_async_read_t *req, bool ok, void *user)
+{
+    cb_log_t *log = user;
+    (void)req;
+
+    log->calls++;
+    log->ok = ok;
+}
+
+/* Poll até sair de BUSY (limite generoso para não travar o ctest) */
+static sfp_async_state_t poll_until_done(sfp_async_read_t *req, unsigned *busy_polls)
+{
+    sfp_async_state_t st = SFP_ASYNC_BUSY;
+
+    *busy_polls = 0;
+    for (unsigned i = 0; i < 10000000u && st == SFP_ASYNC_BUSY; i++) {
+        st = sfp_read_block_async_poll(req);
+        if (st == SFP_ASYNC_BUSY)
+            (*busy_polls)++;
+    }
+    return st;
+}
+
+static void test_done(sfp_host_eeprom_t *dev, const sfp_transport_t *t)
+{
+    sfp_async_read_t req = { 0 };
+    sfp_async_read_t other = { 0 };
+    cb_log_t log = { 0 };
+    uint8_t buf[16], buf2[4];
+    unsigned busy;
+
+    dev->latency_us = 2000;
+    CHECK(sfp_read_block_async_start(&req, t, SFP_I2C_ADDR_A0, 0x10, buf, sizeof(buf),
+                                     on_done, &log));
+    CHECK(req.state == SFP_ASYNC_BUSY);
+    CHECK(sfp_read_block_async_busy(&req));
+
+    /* Requisição em andamento não é reiniciada; o backend aceita uma por vez */
+    CHECK(!sfp_read_block_async_start(&req, t, SFP_I2C_ADDR_A0, 0, buf, 1, on_done, &log));
+    CHECK(!sfp_read_block_async_start(&other, t, SFP_I2C_ADDR_A0, 0, buf2, sizeof(buf2),
+                                      NULL, NULL));
+
+    CHECK(poll_until_done(&req, &busy) == SFP_ASYNC_DONE);
+    CHECK(busy > 0);
+    CHECK(log.calls == 1 && log.ok);
+    CHECK(req.result == (int)sizeof(buf));
+    CHECK(req.end_us - req.start_us >= dev->latency_us);
+    for (size_t i = 0; i < sizeof(buf); i++)
+        CHECK(buf[i] == (uint8_t)(0x10 + i));
+
+    /* Estado terminal é estável: novo poll não repete o callback */
+    CHECK(sfp_read_block_async_poll(&req) == SFP_ASYNC_DONE);
+    CHECK(log.calls == 1);
+    dev->latency_us = 0;
+}
+
+static void test_nak(sfp_host_eeprom_t *dev, sfp_transport_t *t)
+{
+    sfp_async_read_t req = { 0 };
+    cb_log_t log = { 0 };
+    sfp_retry_t retry;
+    uint8_t buf[8];
+    unsigned busy;
+
+    sfp_retry_init(&retry);
+    t->retry = &retry;
+
+    dev->transactions = 0;
+    dev->nak_every    = 1;
+    CHECK(sfp_read_block_async_start(&req, t, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf),
+                                     on_done, &log));
+    CHECK(poll_until_done(&req, &busy) == SFP_ASYNC_ERROR);
+    CHECK(req.result == SFP_XFER_ERR_NAK);
+    CHECK(log.calls == 1 && !log.ok);
+    dev->nak_every = 0;
+
+    /* Endereço sem dispositivo também termina em NAK */
+    CHECK(sfp_read_block_async_start(&req, t, 0x52, 0, buf, sizeof(buf), on_done, &log));
+    CHECK(poll_until_done(&req, &busy) == SFP_ASYNC_ERROR);
+    CHECK(req.result == SFP_XFER_ERR_NAK);
+
+    const sfp_dev_counters_t *c = sfp_retry_counters(&retry, SFP_I2C_ADDR_A0);
+    CHECK(c && c->nak == 1 && c->ok == 0);
+    t->retry = NULL;
+}
+
+static void test_timeout(sfp_host_eeprom_t *dev, const sfp_transport_t *t)
+{
+    sfp_async_read_t req = { 0 };
+    cb_log_t log = { 0 };
+    uint8_t buf[8];
+    unsigned busy;
+
+    dev->bus_stuck = true;
+    CHECK(sfp_read_block_async_start(&req, t, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf),
+                                     on_done, &log));
+    CHECK(poll_until_done(&req, &busy) == SFP_ASYNC_ERROR);
+    CHECK(req.result == SFP_XFER_ERR_TIMEOUT);
+    CHECK(log.calls == 1 && !log.ok);
+    dev->bus_stuck = false;
+
+    /* Depois do erro a requisição pode ser reutilizada */
+    CHECK(sfp_read_block_async_start(&req, t, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf),
+                                     on_done, &log));
+    CHECK(poll_until_done(&req, &busy) == SFP_ASYNC_DONE);
+}
+
+/* Backend sem read_start/read_poll: leitura bloqueante entregue no 1o poll */
+static void test_blocking_fallback(const sfp_transport_t *t)
+{
+    sfp_transport_ops_t ops = *t->ops;
+    sfp_transport_t sync = *t;
+    sfp_async_read_t req = { 0 };
+    cb_log_t log = { 0 };
+    uint8_t buf[4];
+
+    ops.read_start = NULL;
+    ops.read_poll  = NULL;
+    sync.ops = &ops;
+
+    CHECK(sfp_read_block_async_start(&req, &sync, SFP_I2C_ADDR_A0, 0x20, buf, sizeof(buf),
+                                     on_done, &log));
+    CHECK(req.state == SFP_ASYNC_BUSY && log.calls == 0);
+    CHECK(sfp_read_block_async_poll(&req) == SFP_ASYNC_DONE);
+    CHECK(log.calls == 1 && log.ok && buf[0] == 0x20 && buf[3] == 0x23);
+
+    CHECK(sfp_read_block_async_start(&req, &sync, 0x52, 0, buf, sizeof(buf), on_done, &log));
+    CHECK(sfp_read_block_async_poll(&req) == SFP_ASYNC_ERROR);
+    CHECK(log.calls == 2 && !log.ok);
+}
+
+int main(void)
+{
+    static sfp_host_eeprom_t dev;
+    sfp_transport_t t;
+    uint8_t a0[SFP_HOST_EEPROM_SIZE];
+
+    for (size_t i = 0; i < sizeof(a0); i++)
+        a0[i] = (uint8_t)i;
+
+    sfp_host_eeprom_init(&dev);
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A0, a0, sizeof(a0)));
+    sfp_host_transport_init(&t, &dev);
+
+    /* Argumentos inválidos */
+    sfp_async_read_t req = { 0 };
+    CHECK(!sfp_read_block_async_start(&req, &t, SFP_I2C_ADDR_A0, 0, NULL, 1, NULL, NULL));
+    CHECK(!sfp_read_block_async_start(&req, &t, SFP_I2C_ADDR_A0, 0, a0, 0, NULL, NULL));
+    CHECK(sfp_read_block_async_poll(NULL) == SFP_ASYNC_ERROR);
+
+    test_done(&dev, &t);
+    test_nak(&dev, &t);
+    test_timeout(&dev, &t);
+    test_blocking_fallback(&t);
+    return CHECK_DONE();
+}
@@ -0,0 +1,127 @@
+/**
+ * @file test_cache.c
+ * @brief Fingerprint e cache LRU de módulos (sfp_8472/cache.c)
+ *
+ * @details
+ *  CRC-32 contra o vetor de verificação padrão, fingerprint sensível ao
+ *  número de série e aos checksums, caminho de hit (dados guardados na
+ *  inserção voltam na consulta) e descarte da entrada menos usada.
+ */
+
+#include <string.h>
+
+#include "sfp_8472/cache.h"
+#include "sfp_8472/checksum.h"
+#include "check.h"
+
+static void build_a0(uint8_t *a0, uint8_t serial)
+{
+    memset(a0, 0, SFP_FINGERPRINT_LEN);
+    a0[A0_IDENTIFIER] = 0x03;
+    memset(&a0[A0_VENDOR_NAME], ' ', SFP_A0_LEN_VENDOR_NAME);
+    memcpy(&a0[A0_VENDOR_NAME], "FINISAR", 7);
+    memcpy(&a0[A0_VENDOR_PN], "FTLX1471D3BCL", 13);
+    a0[A0_VENDOR_SN] = serial;
+    a0[A0_CC_BASE] = sfp_sum8(a0, A0_CC_BASE);
+    a0[A0_CC_EXT]  = sfp_sum8(&a0[A0_OPTIONS], A0_CC_EXT - A0_OPTIONS);
+}
+
+static void test_fingerprint(void)
+{
+    static const uint8_t check[] = "123456789";
+    uint8_t a[SFP_FINGERPRINT_LEN], b[SFP_FINGERPRINT_LEN];
+
+    CHECK(sfp_crc32(0, check, sizeof(check) - 1) == 0xCBF43926u);
+    CHECK(sfp_crc32(sfp_crc32(0, check, 4), check + 4, 5) == 0xCBF43926u);
+
+    build_a0(a, 0x11);
+    build_a0(b, 0x11);
+    CHECK(sfp_a0_fingerprint(a) == sfp_a0_fingerprint(b));
+
+    /* Outro número de série */
+    build_a0(b, 0x12);
+    CHECK(sfp_a0_fingerprint(a) != sfp_a0_fingerprint(b));
+
+    /* Regravado fora dos campos de identidade: muda o CC_BASE */
+    build_a0(b, 0x11);
+    b[A0_BR_NOMINAL] = 103;
+    b[A0_CC_BASE] = sfp_sum8(b, A0_CC_BASE);
+    CHECK(sfp_a0_fingerprint(a) != sfp_a0_fingerprint(b));
+
+    CHECK(sfp_a0_fingerprint(NULL) == 0);
+}
+
+static void test_hit_path(sfp_module_cache_t *c)
+{
+    uint8_t a0[SFP_FINGERPRINT_LEN];
+    uint32_t fp;
+
+    build_a0(a0, 0x21);
+    fp = sfp_a0_fingerprint(a0);
+
+    CHECK(sfp_module_cache_lookup(c, fp) == NULL);
+    CHECK(c->misses == 1 && c->hits == 0);
+
+    sfp_module_cache_entry_t *e = sfp_module_cache_insert(c, fp);
+    CHECK(e && e->valid && e->fingerprint == fp);
+    e->baud    = 400000;
+    e->has_dmi = true;
+    e->a2.thresholds.temp_high_alarm = 75.0f;
+    e->a2_static[A2_TEMP_HIGH_ALARM] = 75;
+
+    const sfp_module_cache_entry_t *hit = sfp_module_cache_lookup(c, fp);
+    CHECK(hit == e && c->hits == 1);
+    CHECK(hit->baud == 400000 && hit->has_dmi);
+    CHECK(hit->a2.thresholds.temp_high_alarm == 75.0f);
+    CHECK(hit->a2_static[A2_TEMP_HIGH_ALARM] == 75);
+
+    /* Reinserção do mesmo módulo: mesma entrada, zerada, sem descarte */
+    CHECK(sfp_module_cache_insert(c, fp) == e);
+    CHECK(e->baud == 0 && c->evictions == 0);
+}
+
+static void test_lru_eviction(sfp_module_cache_t *c)
+{
+    uint32_t fp[SFP_MODULE_CACHE_ENTRIES + 1];
+    uint8_t a0[SFP_FINGERPRINT_LEN];
+
+    sfp_module_cache_init(c);
+    for (int i = 0; i <= SFP_MODULE_CACHE_ENTRIES; i++) {
+        build_a0(a0, (uint8_t)(0x40 + i));
+        fp[i] = sfp_a0_fingerprint(a0);
+    }
+
+    /* Enche o cache sem descartar */
+    for (int i = 0; i < SFP_MODULE_CACHE_ENTRIES; i++)
+        CHECK(sfp_module_cache_insert(c, fp[i]) != NULL);
+    CHECK(c->evictions == 0);
+
+    /* Consulta renova a primeira: a menos usada passa a ser a segunda */
+    CHECK(sfp_module_cache_lookup(c, fp[0]) != NULL);
+    CHECK(sfp_module_cache_insert(c, fp[SFP_MODULE_CACHE_ENTRIES]) != NULL);
+    CHECK(c->evictions == 1);
+
+    CHECK(sfp_module_cache_lookup(c, fp[1]) == NULL);
+    CHECK(sfp_module_cache_lookup(c, fp[0]) != NULL);
+    for (int i = 2; i <= SFP_MODULE_CACHE_ENTRIES; i++)
+        CHECK(sfp_module_cache_lookup(c, fp[i]) != NULL);
+
+    /* Agora fp[0] é a mais antiga */
+    CHECK(sfp_module_cache_insert(c, fp[1]) != NULL);
+    CHECK(c->evictions == 2);
+    CHECK(sfp_module_cache_lookup(c, fp[0]) == NULL);
+
+    CHECK(sfp_module_cache_lookup(NULL, fp[0]) == NULL);
+    CHECK(sfp_module_cache_insert(NULL, fp[0]) == NULL);
+}
+
+int main(void)
+{
+    static sfp_module_cache_t cache;
+
+    sfp_module_cache_init(&cache);
+    test_fingerprint();
+    test_hit_path(&cache);
+    test_lru_eviction(&cache);
+    return CHECK_DONE();
+}
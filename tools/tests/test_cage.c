@@ -0,0 +1,192 @@
+/**
+ * @file test_cage.c
+ * @brief Poller de gaiolas (I2C/cage.c) e seleção de canal (I2C/mux.c)
+ *
+ * @details
+ *  Três gaiolas atrás do multiplexador emulado: uma com DMI, uma vazia e
+ *  uma sem DMI. Verifica gaiola vazia, recarga na inserção e na remoção,
+ *  seleção de canal evitada quando o canal já está ativo, o atalho do
+ *  cache de módulos e a fatia de tempo do round-robin.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/mux.h"
+#include "I2C/cage.h"
+#include "sfp_8472/checksum.h"
+#include "check.h"
+
+#define PERIOD_US  30000u
+#define CAGES      3
+
+static sfp_host_mux_t hmux;
+static sfp_transport_t bus;
+static sfp_mux_t mux;
+static sfp_cage_table_t tbl;
+
+static void build_module(sfp_host_eeprom_t *dev, uint8_t serial, bool dmi)
+{
+    uint8_t a0[SFP_A0_SIZE] = { 0 };
+    uint8_t a2[SFP_HOST_EEPROM_SIZE] = { 0 };
+
+    a0[A0_IDENTIFIER]     = 0x03;
+    a0[A0_EXT_IDENTIFIER] = SFP_EXT_IDENTIFIER_EXPECTED;
+    a0[A0_VENDOR_SN]      = serial;
+    a0[A0_DIAG_MONITORING_TYPE] = dmi ? 0x68 : 0x00;
+    a0[A0_CC_BASE] = sfp_sum8(a0, A0_CC_BASE);
+    a0[A0_CC_EXT]  = sfp_sum8(&a0[A0_OPTIONS], A0_CC_EXT - A0_OPTIONS);
+
+    a2[A2_TEMP_HIGH_ALARM] = 80;
+    a2[A2_TEMP_CURR]       = 30;
+
+    sfp_host_eeprom_init(dev);
+    sfp_host_eeprom_set(dev, SFP_I2C_ADDR_A0, a0, sizeof(a0));
+    if (dmi)
+        sfp_host_eeprom_set(dev, SFP_I2C_ADDR_A2, a2, sizeof(a2));
+}
+
+/* Uma volta completa: cada gaiola é atendida uma vez, ignorando a fatia */
+static void poll_round(void)
+{
+    for (int i = 0; i < CAGES; i++) {
+        tbl.next_slot_us = 0;
+        CHECK(sfp_cages_poll(&tbl));
+    }
+}
+
+static void test_empty_and_load(void)
+{
+    poll_round();
+
+    const sfp_cage_t *c0 = sfp_cages_get(&tbl, 0);
+    const sfp_cage_t *c1 = sfp_cages_get(&tbl, 1);
+    const sfp_cage_t *c2 = sfp_cages_get(&tbl, 2);
+
+    CHECK(c0->state == SFP_CAGE_READY && c0->has_dmi && c0->insertions == 1);
+    CHECK(c0->a0_idx.identifier == 0x03 && c0->a0_idx.cc_base_ok && c0->a0_idx.cc_ext_ok);
+    CHECK(c0->a2.thresholds.temp_high_alarm == 80.0f);
+    CHECK(c0->a2_raw[A2_TEMP_CURR] == 30);
+
+    CHECK(c1->state == SFP_CAGE_EMPTY && c1->insertions == 0 && c1->polls == 1);
+    CHECK(c2->state == SFP_CAGE_READY && !c2->has_dmi);
+    CHECK(sfp_cages_get(&tbl, CAGES) == NULL);
+
+    /* Vazia continua vazia; as prontas só amostram (sem nova inserção) */
+    poll_round();
+    CHECK(c1->state == SFP_CAGE_EMPTY && c1->polls == 2);
+    CHECK(c0->insertions == 1 && c2->insertions == 1);
+}
+
+/* Probe + A0h + A2h na mesma gaiola: uma escrita de seleção, o resto é hit */
+static void test_select_skipped(void)
+{
+    uint32_t sel = mux.selects, hits = mux.select_hits, wire = hmux.selects;
+
+    tbl.next = 0;
+    tbl.next_slot_us = 0;
+    CHECK(sfp_cages_poll(&tbl));        /* amostra da gaiola 0 (A2h dinâmico) */
+    tbl.next = 0;
+    tbl.next_slot_us = 0;
+    CHECK(sfp_cages_poll(&tbl));        /* de novo, canal já ativo */
+
+    CHECK(mux.selects - sel <= 1);
+    CHECK(mux.select_hits - hits >= 1);
+    CHECK(hmux.selects - wire == mux.selects - sel);
+    CHECK(mux.current == 0);
+
+    /* Seleção explícita do canal ativo não vai ao barramento */
+    wire = hmux.selects;
+    CHECK(sfp_mux_select(&mux, 0));
+    CHECK(hmux.selects == wire);
+    CHECK(sfp_mux_deselect(&mux) && mux.current == SFP_MUX_NONE && hmux.mask == 0);
+    CHECK(sfp_mux_select(&mux, 0) && hmux.selects == wire + 2 && hmux.mask == 0x01);
+    CHECK(!sfp_mux_select(&mux, SFP_MUX_CHANNELS));
+    tbl.next = 1;
+}
+
+static void test_insert_remove(sfp_host_eeprom_t *late, sfp_host_eeprom_t *first)
+{
+    const sfp_cage_t *c0 = sfp_cages_get(&tbl, 0);
+    const sfp_cage_t *c1 = sfp_cages_get(&tbl, 1);
+
+    /* Módulo inserido na gaiola 1: recarregado na próxima fatia dela */
+    build_module(late, 0x22, true);
+    CHECK(sfp_host_mux_attach(&hmux, 1, late));
+    poll_round();
+    CHECK(c1->state == SFP_CAGE_READY && c1->insertions == 1);
+    CHECK(c1->a0_idx.fingerprint != c0->a0_idx.fingerprint);
+
+    /* Removido da gaiola 0: a amostra falha e a gaiola volta a vazia */
+    uint32_t errors = c0->errors;
+    CHECK(sfp_host_mux_attach(&hmux, 0, NULL));
+    poll_round();
+    CHECK(c0->state == SFP_CAGE_EMPTY && c0->errors == errors + 1);
+
+    /* Mesmo módulo de volta: hit no cache, A2h estático vem da entrada */
+    uint32_t hits = tbl.cache->hits;
+    CHECK(sfp_host_mux_attach(&hmux, 0, first));
+    first->transactions = 0;
+    poll_round();
+    CHECK(c0->state == SFP_CAGE_READY && c0->insertions == 2);
+    CHECK(tbl.cache->hits == hits + 1);
+    CHECK(c0->a2.thresholds.temp_high_alarm == 80.0f);
+}
+
+static uint64_t now_us(void)
+{
+    return sfp_transport_now_us(&bus);
+}
+
+/* Fatia = period / count: uma gaiola por fatia, atrasos não viram rajada */
+static void test_slot_timing(void)
+{
+    uint32_t slot = PERIOD_US / CAGES;
+
+    tbl.next_slot_us = 0;
+    uint64_t t0 = now_us();
+    CHECK(sfp_cages_poll(&tbl));
+    CHECK(!sfp_cages_poll(&tbl));       /* mesma fatia */
+    CHECK(tbl.next_slot_us >= t0 + slot);
+
+    while (now_us() < tbl.next_slot_us)
+        ;
+    uint64_t due = tbl.next_slot_us;
+    CHECK(sfp_cages_poll(&tbl));
+    CHECK(tbl.next_slot_us == due + slot);
+
+    /* Atraso de mais de um período: ressincroniza a partir de agora */
+    bus.ops->sleep_us(bus.ctx, PERIOD_US + slot + 1000);
+    uint64_t before = now_us();
+    CHECK(sfp_cages_poll(&tbl));
+    CHECK(tbl.next_slot_us >= before + slot);
+    CHECK(!sfp_cages_poll(&tbl));
+}
+
+int main(void)
+{
+    static sfp_host_eeprom_t mod_a, mod_c, mod_late;
+    static sfp_module_cache_t cache;
+
+    build_module(&mod_a, 0x11, true);
+    build_module(&mod_c, 0x33, false);
+
+    sfp_host_mux_init(&hmux, SFP_MUX_ADDR_DEFAULT);
+    CHECK(sfp_host_mux_attach(&hmux, 0, &mod_a));
+    CHECK(sfp_host_mux_attach(&hmux, 2, &mod_c));
+    sfp_host_mux_transport_init(&bus, &hmux);
+
+    sfp_mux_init(&mux, &bus, SFP_MUX_ADDR_DEFAULT);
+    CHECK(!sfp_cages_init(&tbl, &mux, SFP_MUX_CHANNELS + 1, PERIOD_US));
+    CHECK(sfp_cages_init(&tbl, &mux, CAGES, PERIOD_US));
+    sfp_module_cache_init(&cache);
+    tbl.cache = &cache;
+
+    test_empty_and_load();
+    test_select_skipped();
+    test_insert_remove(&mod_late, &mod_a);
+    test_slot_timing();
+    return CHECK_DONE();
+}
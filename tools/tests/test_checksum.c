@@ -0,0 +1,194 @@
+/**
+ * @file test_checksum.c
+ * @brief Checksums e revalidação incremental (sfp_8472/checksum.c)
+ *
+ * @details
+ *  sfp_sum8() contra a soma byte a byte, com blocos acima de 256 palavras
+ *  (esvaziamento das lanes), bytes 0xFF (pior caso de acumulação), início
+ *  desalinhado e restos de 1-3 bytes. Depois a revalidação por faixa:
+ *  quais escritas invalidam cada checksum (inclusive o próprio byte 63/95),
+ *  faixas pendentes sem imagem, resultados guardados por fingerprint,
+ *  reaproveitamento circular das entradas e os contadores computed/skipped.
+ */
+
+#include <string.h>
+
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a2h.h"
+#include "sfp_8472/checksum.h"
+#include "check.h"
+
+static uint8_t ref_sum8(const uint8_t *d, size_t len)
+{
+    uint8_t sum = 0;
+    for (size_t i = 0; i < len; i++)
+        sum += d[i];
+    return sum;
+}
+
+static void test_sum8(void)
+{
+    static uint8_t buf[1100 + 4];
+    uint32_t seed = 0x8472u;
+    unsigned bad = 0;
+
+    CHECK(sfp_sum8(NULL, 16) == 0);
+    CHECK(sfp_sum8(buf, 0) == 0);
+
+    /* Só 0xFF: cada lane chega a 256 * 255 antes de esvaziar */
+    memset(buf, 0xFF, sizeof(buf));
+    for (size_t len = 1020; len <= 1100; len++) {
+        for (size_t off = 0; off < 4; off++)
+            bad += sfp_sum8(buf + off, len) != ref_sum8(buf + off, len);
+    }
+    CHECK(bad == 0);
+
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        seed = seed * 1664525u + 1013904223u;
+        buf[i] = (uint8_t)(seed >> 24);
+    }
+    for (size_t len = 0; len <= 1100; len++) {
+        for (size_t off = 0; off < 4; off++)
+            bad += sfp_sum8(buf + off, len) != ref_sum8(buf + off, len);
+    }
+    CHECK(bad == 0);
+}
+
+static uint8_t a0[SFP_A0_SIZE];
+static uint8_t a2[SFP_A2_SIZE];
+
+static void build_images(uint8_t seed)
+{
+    for (size_t i = 0; i < sizeof(a0); i++)
+        a0[i] = (uint8_t)(seed + 3 * i);
+    for (size_t i = 0; i < sizeof(a2); i++)
+        a2[i] = (uint8_t)(seed + 5 * i);
+
+    a0[A0_CC_BASE] = sfp_sum8(a0, A0_CC_BASE);
+    a0[A0_CC_EXT]  = sfp_sum8(&a0[A0_OPTIONS], A0_CC_EXT - A0_OPTIONS);
+    a2[A2_CC_DMI]  = sfp_sum8(a2, A2_CC_DMI);
+}
+
+static void test_ranges(void)
+{
+    build_images(1);
+    CHECK(sfp_checksum_range_ok(SFP_CHK_BASE, a0));
+    CHECK(sfp_checksum_range_ok(SFP_CHK_EXT, a0));
+    CHECK(sfp_checksum_range_ok(SFP_CHK_DMI, a2));
+    CHECK(!sfp_checksum_range_ok(SFP_CHK_COUNT, a0));
+    CHECK(!sfp_checksum_range_ok(SFP_CHK_BASE, NULL));
+
+    a0[A0_CC_BASE]++;
+    CHECK(!sfp_checksum_range_ok(SFP_CHK_BASE, a0));
+    CHECK(sfp_checksum_range_ok(SFP_CHK_EXT, a0));
+}
+
+/* Faixas recalculadas por um verify após o touch */
+static uint32_t recomputed(sfp_checksum_t *c, uint8_t addr, uint8_t offset, uint8_t len)
+{
+    uint32_t before = c->computed;
+
+    sfp_checksum_touch(c, addr, offset, len);
+    sfp_checksum_verify(c, a0, a2);
+    return c->computed - before;
+}
+
+static void test_touch(sfp_checksum_t *c)
+{
+    build_images(2);
+    sfp_checksum_init(c);
+    sfp_checksum_select(c, 0x1111u);
+
+    CHECK(sfp_checksum_verify(c, a0, a2) == SFP_CHK_MASK_ALL);
+    CHECK(c->computed == 3 && c->skipped == 0);
+
+    /* Nada tocado: tudo do resultado guardado */
+    CHECK(sfp_checksum_verify(c, a0, a2) == SFP_CHK_MASK_ALL);
+    CHECK(c->computed == 3 && c->skipped == 3);
+
+    /* O próprio byte de checksum invalida a faixa */
+    CHECK(recomputed(c, ADDR_A0, A0_CC_BASE, 1) == 1);
+    CHECK(recomputed(c, ADDR_A0, A0_CC_EXT, 1) == 1);
+    CHECK(recomputed(c, ADDR_A2, A2_CC_DMI, 1) == 1);
+
+    /* Primeiro byte de cada faixa e uma leitura que cruza as duas do A0h */
+    CHECK(recomputed(c, ADDR_A0, A0_IDENTIFIER, 1) == 1);
+    CHECK(recomputed(c, ADDR_A0, A0_OPTIONS, 1) == 1);
+    CHECK(recomputed(c, ADDR_A0, A0_CC_BASE - 1, 3) == 2);
+    CHECK(recomputed(c, ADDR_A0, 0, 128) == 2);
+
+    /* Fora de qualquer faixa: janela dinâmica do A2h, A0h 96+, len 0 */
+    CHECK(recomputed(c, ADDR_A2, A2_TEMP_CURR, 24) == 0);
+    CHECK(recomputed(c, ADDR_A0, A0_CC_EXT + 1, 32) == 0);
+    CHECK(recomputed(c, ADDR_A0, A0_IDENTIFIER, 0) == 0);
+    CHECK(recomputed(c, 0x52, 0, 128) == 0);
+
+    /* Byte corrompido relido: o resultado novo vale */
+    a0[A0_VENDOR_NAME] ^= 0x01;
+    sfp_checksum_touch(c, ADDR_A0, A0_VENDOR_NAME, 16);
+    CHECK(sfp_checksum_verify(c, a0, a2) == (SFP_CHK_MASK_ALL & ~SFP_CHK_MASK(SFP_CHK_BASE)));
+    CHECK(!sfp_checksum_valid(c, SFP_CHK_BASE) && sfp_checksum_valid(c, SFP_CHK_EXT));
+
+    a0[A0_VENDOR_NAME] ^= 0x01;
+    sfp_checksum_touch(c, ADDR_A0, A0_VENDOR_NAME, 16);
+    CHECK(sfp_checksum_verify(c, a0, a2) == SFP_CHK_MASK_ALL);
+
+    /* Sem imagem do A2h: o CC_DMI fica pendente, sem contar */
+    uint32_t computed = c->computed, skipped = c->skipped;
+    sfp_checksum_touch(c, ADDR_A2, 0, 1);
+    CHECK(sfp_checksum_verify(c, a0, NULL) == (SFP_CHK_MASK(SFP_CHK_BASE) | SFP_CHK_MASK(SFP_CHK_EXT)));
+    CHECK(c->computed == computed && c->skipped == skipped + 2);
+    CHECK(!sfp_checksum_valid(c, SFP_CHK_DMI));
+    CHECK(sfp_checksum_verify(c, a0, a2) == SFP_CHK_MASK_ALL);
+    CHECK(c->computed == computed + 1);
+}
+
+static void test_slots(sfp_checksum_t *c)
+{
+    build_images(3);
+    sfp_checksum_init(c);
+
+    CHECK(sfp_checksum_verify(c, a0, a2) == 0);         /* sem módulo */
+    CHECK(!sfp_checksum_valid(c, SFP_CHK_BASE));
+
+    sfp_checksum_select(c, 0xA0u);
+    sfp_checksum_verify(c, a0, a2);
+    CHECK(c->computed == 3);
+
+    /* Outro módulo começa sem resultados */
+    sfp_checksum_select(c, 0xB0u);
+    CHECK(!sfp_checksum_valid(c, SFP_CHK_BASE));
+    sfp_checksum_verify(c, a0, a2);
+    CHECK(c->computed == 6);
+
+    /* Reinserção do primeiro: nada recalculado */
+    sfp_checksum_select(c, 0xA0u);
+    CHECK(sfp_checksum_valid(c, SFP_CHK_DMI));
+    CHECK(sfp_checksum_verify(c, a0, a2) == SFP_CHK_MASK_ALL);
+    CHECK(c->computed == 6 && c->skipped == 3);
+
+    /* Entradas cheias: a substituição circular volta à do primeiro */
+    for (uint32_t fp = 1; fp < SFP_CHECKSUM_ENTRIES; fp++) {
+        sfp_checksum_select(c, 0xC0u + fp);
+        sfp_checksum_verify(c, a0, a2);
+    }
+    sfp_checksum_select(c, 0xB0u);
+    CHECK(sfp_checksum_valid(c, SFP_CHK_BASE));
+    sfp_checksum_select(c, 0xA0u);
+    CHECK(!sfp_checksum_valid(c, SFP_CHK_BASE));
+
+    uint32_t computed = c->computed;
+    sfp_checksum_verify(c, a0, a2);
+    CHECK(c->computed == computed + 3);
+}
+
+int main(void)
+{
+    static sfp_checksum_t c;
+
+    test_sum8();
+    test_ranges();
+    test_touch(&c);
+    test_slots(&c);
+    return CHECK_DONE();
+}
@@ -0,0 +1,177 @@
+/**
+ * @file test_dmi.c
+ * @brief Captura coerente da janela DMI (I2C/dmi.c)
+ *
+ * @details
+ *  Um read do backend emulado envolvido pelo teste altera o A2h depois
+ *  de cada leitura, como uma conversão A/D terminando entre duas
+ *  transações. Verifica a dupla leitura: medida estável, uma conversão no
+ *  meio (descarta e confirma na terceira), medida que nunca estabiliza
+ *  (publicada com coherent = false após SFP_DMI_MAX_READS), mudança só
+ *  nos status/flags (fora da comparação) e falha no meio da captura.
+ */
+
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/dmi.h"
+#include "sfp_8472/a2h.h"
+#include "check.h"
+
+static sfp_host_eeprom_t dev;
+static const sfp_transport_ops_t *host_ops;
+static sfp_transport_ops_t ops;
+static sfp_transport_t bus;
+
+/* Após a leitura n (1..), soma step[n - 1] ao byte 'target' do A2h */
+static struct {
+    uint8_t  target;
+    uint8_t  step[SFP_DMI_MAX_READS];
+    unsigned reads;
+    unsigned fail_at;       /* leitura que falha (0 = nenhuma) */
+} script;
+
+static int tearing_read(void *ctx, uint8_t addr, uint8_t *dst, size_t len, bool nostop)
+{
+    unsigned n = ++script.reads;
+
+    if (n == script.fail_at)
+        return SFP_XFER_ERR_TIMEOUT;
+
+    int ret = host_ops->read(ctx, addr, dst, len, nostop);
+    if (n <= SFP_DMI_MAX_READS)
+        dev.mem[1][script.target] += script.step[n - 1];
+    return ret;
+}
+
+static void setup(uint8_t target, const uint8_t *steps, unsigned fail_at)
+{
+    uint8_t a2[SFP_HOST_EEPROM_SIZE] = { 0 };
+
+    a2[A2_TEMP_CURR] = 30;
+    a2[A2_RX_POWER]  = 0x10;
+
+    sfp_host_eeprom_init(&dev);
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A2, a2, sizeof(a2)));
+    sfp_host_transport_init(&bus, &dev);
+
+    host_ops = bus.ops;
+    ops      = *host_ops;
+    ops.read = tearing_read;
+    bus.ops  = &ops;
+
+    memset(&script, 0, sizeof(script));
+    script.target  = target;
+    script.fail_at = fail_at;
+    if (steps)
+        memcpy(script.step, steps, sizeof(script.step));
+}
+
+static void test_single_read(void)
+{
+    static const uint8_t steps[SFP_DMI_MAX_READS] = { 1, 1, 1, 1 };
+    sfp_dmi_t d;
+
+    setup(A2_TEMP_CURR, steps, 0);
+    sfp_dmi_init(&d, &bus, SFP_I2C_ADDR_A2, false);
+    CHECK(sfp_dmi_latest(&d) == NULL);
+
+    CHECK(sfp_dmi_capture(&d));
+    const sfp_dmi_snapshot_t *s = sfp_dmi_latest(&d);
+    CHECK(s && s->reads == 1 && s->coherent && s->seq == 1);
+    CHECK(s->raw[0] == 30 && d.torn == 0 && script.reads == 1);
+}
+
+static void test_stable(void)
+{
+    sfp_dmi_t d;
+
+    setup(A2_TEMP_CURR, NULL, 0);
+    sfp_dmi_init(&d, &bus, SFP_I2C_ADDR_A2, true);
+
+    CHECK(sfp_dmi_capture(&d));
+    const sfp_dmi_snapshot_t *s = sfp_dmi_latest(&d);
+    CHECK(s && s->reads == 2 && s->coherent);
+    CHECK(d.torn == 0 && d.incoherent == 0);
+}
+
+/* Conversão A/D entre a 1a e a 2a leitura: a 3a confirma o valor novo */
+static void test_one_tear(void)
+{
+    static const uint8_t steps[SFP_DMI_MAX_READS] = { 1, 0, 0, 0 };
+    sfp_dmi_t d;
+
+    setup(A2_TEMP_CURR, steps, 0);
+    sfp_dmi_init(&d, &bus, SFP_I2C_ADDR_A2, true);
+
+    CHECK(sfp_dmi_capture(&d));
+    const sfp_dmi_snapshot_t *s = sfp_dmi_latest(&d);
+    CHECK(s && s->reads == 3 && s->coherent);
+    CHECK(s->raw[0] == 31);
+    CHECK(d.torn == 1 && d.incoherent == 0);
+
+    /* LSB do último campo medido (RX, byte 105) também é comparado */
+    setup(A2_RX_POWER + 1, steps, 0);
+    sfp_dmi_init(&d, &bus, SFP_I2C_ADDR_A2, true);
+    CHECK(sfp_dmi_capture(&d));
+    CHECK(d.torn == 1 && sfp_dmi_latest(&d)->reads == 3);
+}
+
+/* Medida mudando a cada leitura: publicada sem confirmação */
+static void test_never_settles(void)
+{
+    static const uint8_t steps[SFP_DMI_MAX_READS] = { 1, 1, 1, 1 };
+    sfp_dmi_t d;
+
+    setup(A2_TEMP_CURR, steps, 0);
+    sfp_dmi_init(&d, &bus, SFP_I2C_ADDR_A2, true);
+
+    CHECK(sfp_dmi_capture(&d));
+    const sfp_dmi_snapshot_t *s = sfp_dmi_latest(&d);
+    CHECK(s && s->reads == SFP_DMI_MAX_READS && !s->coherent);
+    CHECK(s->raw[0] == 30 + SFP_DMI_MAX_READS - 1);     /* a última lida */
+    CHECK(d.torn == SFP_DMI_MAX_READS - 1 && d.incoherent == 1);
+    CHECK(script.reads == SFP_DMI_MAX_READS);
+}
+
+/* Status/flags (110+) mudam sem tornar a medida incoerente */
+static void test_flags_not_compared(void)
+{
+    static const uint8_t steps[SFP_DMI_MAX_READS] = { 0x80, 0, 0, 0 };
+    sfp_dmi_t d;
+
+    setup(A2_ALARM_FLAGS, steps, 0);
+    sfp_dmi_init(&d, &bus, SFP_I2C_ADDR_A2, true);
+
+    CHECK(sfp_dmi_capture(&d));
+    const sfp_dmi_snapshot_t *s = sfp_dmi_latest(&d);
+    CHECK(s && s->reads == 2 && s->coherent && d.torn == 0);
+    CHECK(s->alarm_flags == 0x8000);
+}
+
+/* Falha na segunda leitura: nada publicado, o snapshot anterior fica */
+static void test_failure_mid_capture(void)
+{
+    sfp_dmi_t d;
+
+    setup(A2_TEMP_CURR, NULL, 0);
+    sfp_dmi_init(&d, &bus, SFP_I2C_ADDR_A2, true);
+    CHECK(sfp_dmi_capture(&d));
+    const sfp_dmi_snapshot_t *prev = sfp_dmi_latest(&d);
+
+    script.fail_at = script.reads + 2;
+    CHECK(!sfp_dmi_capture(&d));
+    CHECK(d.failures == 1 && d.captures == 1);
+    CHECK(sfp_dmi_latest(&d) == prev && prev->seq == 1);
+}
+
+int main(void)
+{
+    test_single_read();
+    test_stable();
+    test_one_tear();
+    test_never_settles();
+    test_flags_not_compared();
+    test_failure_mid_capture();
+    return CHECK_DONE();
+}
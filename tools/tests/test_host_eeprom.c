@@ -0,0 +1,252 @@
+/**
+ * @file test_host_eeprom.c
+ * @brief Regressão do pipeline A0h/A2h sobre a EEPROM emulada
+ *
+ * @details
+ *  Grava dumps A0h/A2h de um 10GBASE-LR em arquivo, carrega-os com
+ *  sfp_host_eeprom_load() e passa pelo mesmo caminho da firmware
+ *  (sfp_read_block + sfp_parse_*). Também exercita a injeção de NAK
+ *  (com e sem política de tentativas) e de latência, e a escrita com
+ *  ACK polling durante o ciclo interno da EEPROM.
+ */
+
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/retry.h"
+#include "I2C/stats.h"
+#include "I2C/trace.h"
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a2h.h"
+#include "sfp_8472/checksum.h"
+#include "check.h"
+
+#define A0_DUMP "test_host_eeprom_a0.bin"
+#define A2_DUMP "test_host_eeprom_a2.bin"
+
+static void build_a0(uint8_t *a0)
+{
+    memset(a0, 0, SFP_A0_SIZE);
+    a0[A0_IDENTIFIER]     = 0x03;
+    a0[A0_EXT_IDENTIFIER] = SFP_EXT_IDENTIFIER_EXPECTED;
+    a0[A0_CONNECTOR]      = SFP_CONNECTOR_LC;
+    a0[A0_TRANSCEIVER]    = 0x20;           /* 10GBASE-LR */
+    a0[A0_ENCODING]       = 0x06;           /* 64B/66B */
+    a0[A0_BR_NOMINAL]     = 103;            /* 10.3 GBd */
+    a0[A0_LENGTH_SMF_KM]  = 10;
+    memset(&a0[A0_VENDOR_NAME], ' ', SFP_A0_LEN_VENDOR_NAME);
+    memcpy(&a0[A0_VENDOR_NAME], "FINISAR", 7);
+    a0[A0_WAVELENGTH]     = 0x05;           /* 1310 nm */
+    a0[A0_WAVELENGTH + 1] = 0x1E;
+    a0[A0_BR_MAX]         = 5;
+    a0[A0_BR_MIN]         = 10;
+    a0[A0_DIAG_MONITORING_TYPE] = 0x68;     /* DMI, calibração interna */
+    a0[A0_CC_BASE] = sfp_sum8(a0, A0_CC_BASE);
+    a0[A0_CC_EXT]  = sfp_sum8(&a0[A0_OPTIONS], A0_CC_EXT - A0_OPTIONS);
+}
+
+static void build_a2(uint8_t *a2)
+{
+    memset(a2, 0, SFP_HOST_EEPROM_SIZE);
+    a2[A2_TEMP_HIGH_ALARM] = 75;            /* 75.0 °C (q8.8) */
+    a2[A2_TEMP_LOW_ALARM]  = 0xFB;          /* -5.0 °C */
+    a2[A2_TEMP_CURR]       = 36;
+    a2[A2_TEMP_CURR + 1]   = 0x80;          /* 36.5 °C */
+    a2[A2_VCC_CURR]        = 0x80;          /* 0x80E8 * 100 uV = 3.3000 V */
+    a2[A2_VCC_CURR + 1]    = 0xE8;
+}
+
+static bool write_dump(const char *path, const uint8_t *data, size_t len)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return false;
+
+    bool ok = fwrite(data, 1, len, f) == len;
+    return fclose(f) == 0 && ok;
+}
+
+/* Dumps em arquivo -> EEPROM emulada -> sfp_read_block -> parsers */
+static void test_dump_pipeline(sfp_host_eeprom_t *dev, const sfp_transport_t *t)
+{
+    uint8_t a0[SFP_A0_SIZE], a2[SFP_A2_SIZE];
+    sfp_a0h_base_t base;
+    sfp_a0h_extended_t ext;
+    sfp_a2h_t info;
+    char vendor[SFP_A0_LEN_VENDOR_NAME + 1];
+    uint16_t nm = 0;
+    float vcc = 0;
+
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A0, 0, a0, SFP_A0_SIZE));
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A2, 0, a2, SFP_A2_SIZE));
+    CHECK(dev->transactions == 4);
+
+    memset(&base, 0, sizeof(base));
+    memset(&ext, 0, sizeof(ext));
+    sfp_parse_a0_all(a0, &base, &ext);
+
+    CHECK(base.identifier == 0x03);
+    CHECK(sfp_a0_get_connector(&base) == SFP_CONNECTOR_LC);
+    CHECK(sfp_cc_has(&base.dc, SFP_CC_ETH_10G_BASE_LR));
+    CHECK(sfp_cc_any(&base.dc, SFP_CC_MASK_ETH_10G));
+    CHECK(!sfp_cc_any(&base.dc, SFP_CC_MASK_FC_8G_PLUS));
+    CHECK(sfp_a0_get_nominal_rate_mbd(&base, NULL) == 10300);
+    CHECK(base.rate.max_mbd == 10815 && base.rate.min_mbd == 9270);
+    CHECK(base.smf_length_km == 10);
+    CHECK(sfp_a0_get_wavelength_nm(&base, &nm) && nm == 1310);
+    CHECK(sfp_a0_get_vendor_name(&base, vendor) && strcmp(vendor, "FINISAR") == 0);
+    CHECK(base.cc_base_is_valid);
+    CHECK(ext.cc_ext_is_valid);
+
+    memset(&info, 0, sizeof(info));
+    sfp_parse_a2h_thresholds(a2, &info);
+    CHECK(sfp_a2h_get_temp_high_alarm(&info) == 75.0f);
+    CHECK(sfp_a2h_get_temp_low_alarm(&info) == -5.0f);
+    CHECK(get_sfp_vcc(a2, &vcc) && vcc > 3.2999f && vcc < 3.3001f);
+
+    /* Leitura a partir de um offset: o ponteiro da EEPROM segue o offset */
+    uint8_t rate[2];
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A0, A0_BR_MAX, rate, 2));
+    CHECK(rate[0] == 5 && rate[1] == 10);
+}
+
+/* Grupos de compliance: 10GFC (1200 MB/s) também é FC >= 8G */
+static void test_cc_masks(void)
+{
+    uint8_t a0[SFP_A0_SIZE];
+    sfp_a0h_base_t base;
+    sfp_a0h_extended_t ext;
+
+    build_a0(a0);
+    a0[A0_TRANSCEIVER + 7] = 0x80;          /* byte 10: 1200 MB/s */
+    memset(&base, 0, sizeof(base));
+    memset(&ext, 0, sizeof(ext));
+    sfp_parse_a0_all(a0, &base, &ext);
+
+    CHECK(sfp_cc_has(&base.dc, SFP_CC_CS_1200_MBPS));
+    CHECK(sfp_cc_any(&base.dc, SFP_CC_MASK_FC_8G_PLUS));
+    CHECK(sfp_cc_any(&base.dc, SFP_CC_MASK_FC_SPEED));
+    CHECK(sfp_cc_byte(&base.dc, 10) == 0x80);
+}
+
+/* NAK injetado: sem política a leitura falha; com retry ela se recupera */
+static void test_nak_injection(sfp_host_eeprom_t *dev, sfp_transport_t *t)
+{
+    uint8_t buf[16];
+    sfp_retry_t retry;
+
+    /* sfp_read_block = escrita do offset + leitura; a 2a transação leva NAK */
+    dev->transactions = 0;
+    dev->nak_every    = 2;
+    CHECK(!sfp_read_block(t, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf)));
+    CHECK(dev->naks_injected == 1);
+
+    sfp_retry_init(&retry);
+    retry.backoff_base_us = 1;
+    retry.backoff_max_us  = 1;
+    t->retry = &retry;
+
+    dev->transactions = 0;
+    dev->nak_every    = 3;
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf)));
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf)));
+    CHECK(buf[A0_IDENTIFIER] == 0x03);
+
+    const sfp_dev_counters_t *c = sfp_retry_counters(&retry, SFP_I2C_ADDR_A0);
+    CHECK(c && c->nak == 1 && c->retries == 1 && c->ok == 2);
+
+    /* Dispositivo ausente: NAK em todas as tentativas */
+    dev->nak_every = 0;
+    dev->present[1] = false;
+    CHECK(!sfp_read_block(t, SFP_I2C_ADDR_A2, 0, buf, sizeof(buf)));
+    CHECK(!sfp_probe(t, SFP_I2C_ADDR_A2));
+    c = sfp_retry_counters(&retry, SFP_I2C_ADDR_A2);
+    CHECK(c && c->nak == retry.max_attempts && c->ok == 0);
+    dev->present[1] = true;
+
+    t->retry = NULL;
+}
+
+/* Latência injetada aparece no histograma (duas transações por bloco) */
+static void test_latency_injection(sfp_host_eeprom_t *dev, sfp_transport_t *t)
+{
+    uint8_t buf[8];
+    sfp_stats_t stats;
+
+    sfp_stats_init(&stats);
+    t->stats = &stats;
+    dev->latency_us = 2000;
+
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A2, A2_TEMP_CURR, buf, sizeof(buf)));
+    CHECK(buf[0] == 36 && buf[1] == 0x80);
+
+    const sfp_latency_hist_t *h = sfp_stats_get(&stats, SFP_I2C_ADDR_A2);
+    CHECK(h && h->count == 1 && h->errors == 0);
+    CHECK(h && h->min_us >= 2 * dev->latency_us);
+
+    dev->latency_us = 0;
+    t->stats = NULL;
+}
+
+/* Escrita: ACK polling pelo caminho instrumentado, com espera entre sondagens */
+static void test_write_ack_poll(sfp_host_eeprom_t *dev, sfp_transport_t *t)
+{
+    static sfp_trace_t trace;
+    sfp_stats_t stats;
+    uint8_t data[16], back[16];
+
+    for (size_t i = 0; i < sizeof(data); i++)
+        data[i] = (uint8_t)(0xA0 + i);
+
+    sfp_trace_init(&trace, false);
+    sfp_stats_init(&stats);
+    t->trace = &trace;
+    t->stats = &stats;
+    dev->write_cycle_us = 1000;
+    dev->busy_naks = 0;
+
+    CHECK(sfp_write_block(t, SFP_I2C_ADDR_A2, 0x80, data, sizeof(data), true));
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A2, 0x80, back, sizeof(back)));
+    CHECK(memcmp(back, data, sizeof(data)) == 0);
+    CHECK(dev->page_writes == 2);
+
+    /* 1 ms de ciclo com 150 us entre sondagens: poucas dezenas de NAKs, não milhares */
+    CHECK(dev->busy_naks > 0 && dev->busy_naks <= 2 * (1000 / SFP_EEPROM_ACK_POLL_US + 2));
+
+    /* As sondagens aparecem no trace e no histograma */
+    const sfp_latency_hist_t *h = sfp_stats_get(&stats, SFP_I2C_ADDR_A2);
+    CHECK(h && h->errors >= dev->busy_naks);
+    CHECK(sfp_trace_count(&trace) >= 2 + dev->busy_naks);
+
+    dev->write_cycle_us = 0;
+    t->trace = NULL;
+    t->stats = NULL;
+}
+
+int main(void)
+{
+    static sfp_host_eeprom_t dev;
+    sfp_transport_t t;
+    uint8_t a0[SFP_A0_SIZE], a2[SFP_HOST_EEPROM_SIZE];
+
+    build_a0(a0);
+    build_a2(a2);
+    CHECK(write_dump(A0_DUMP, a0, sizeof(a0)));
+    CHECK(write_dump(A2_DUMP, a2, sizeof(a2)));
+
+    sfp_host_eeprom_init(&dev);
+    CHECK(sfp_host_eeprom_load(&dev, SFP_I2C_ADDR_A0, A0_DUMP));
+    CHECK(sfp_host_eeprom_load(&dev, SFP_I2C_ADDR_A2, A2_DUMP));
+    CHECK(!sfp_host_eeprom_load(&dev, SFP_I2C_ADDR_A0, "nao_existe.bin"));
+    sfp_host_transport_init(&t, &dev);
+
+    test_dump_pipeline(&dev, &t);
+    test_cc_masks();
+    test_nak_injection(&dev, &t);
+    test_latency_injection(&dev, &t);
+    test_write_ack_poll(&dev, &t);
+
+    remove(A0_DUMP);
+    remove(A2_DUMP);
+    return CHECK_DONE();
+}
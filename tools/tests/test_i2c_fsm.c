@@ -0,0 +1,305 @@
+/**
+ * @file test_i2c_fsm.c
+ * @brief Máquina de estados do mestre I2C (I2C/i2c_fsm.c)
+ *
+ * @details
+ *  Faz o papel da ISR: puxa palavras de comando como se enchesse a FIFO
+ *  de TX, devolve bytes pela FIFO de RX e sinaliza TX_ABRT/STOP_DET.
+ *  Verifica os bits RESTART/STOP, o limite de 16 leituras pendentes, a
+ *  drenagem só em meia FIFO e no STOP_DET, abortos, STOP prematuro,
+ *  descritor vazio e o encadeamento da fila.
+ */
+
+#include <string.h>
+
+#include "I2C/i2c_fsm.h"
+#include "I2C/transport.h"
+#include "check.h"
+
+#define CMD_FLAGS (SFP_I2C_CMD_READ | SFP_I2C_CMD_STOP | SFP_I2C_CMD_RESTART)
+
+typedef struct {
+    unsigned calls;
+    int      result;
+} cb_log_t;
+
+static void on_done(sfp_i2c_xfer_t *x, void *user)
+{
+    cb_log_t *log = user;
+
+    log->calls++;
+    log->result = x->result;
+}
+
+static void test_write_restart_read(sfp_i2c_fsm_t *f)
+{
+    static const uint8_t offset[1] = { 0x60 };
+    uint8_t buf[4] = { 0 };
+    sfp_i2c_xfer_t x;
+    cb_log_t log = { 0 };
+    uint32_t cmd[8];
+    unsigned n = 0;
+
+    sfp_i2c_xfer_write_read(&x, 0x51, offset, sizeof(offset), buf, sizeof(buf));
+    x.cb   = on_done;
+    x.user = &log;
+    CHECK(sfp_i2c_fsm_submit(f, &x));
+    CHECK(x.state == SFP_I2C_XFER_ACTIVE && sfp_i2c_fsm_active(f) == &x);
+
+    while (n < 8 && sfp_i2c_fsm_next_cmd(f, &cmd[n]))
+        n++;
+    CHECK(n == 5);
+    CHECK(sfp_i2c_fsm_cmds_done(f));
+
+    /* Offset sem flags; 1a leitura com RESTART; só a última com STOP */
+    CHECK(cmd[0] == 0x60);
+    CHECK(cmd[1] == (SFP_I2C_CMD_READ | SFP_I2C_CMD_RESTART));
+    CHECK(cmd[2] == SFP_I2C_CMD_READ && cmd[3] == SFP_I2C_CMD_READ);
+    CHECK(cmd[4] == (SFP_I2C_CMD_READ | SFP_I2C_CMD_STOP));
+
+    for (uint8_t i = 0; i < 4; i++)
+        sfp_i2c_fsm_rx(f, (uint8_t)(0xB0 + i));
+    CHECK(sfp_i2c_fsm_stop(f) == NULL);
+
+    CHECK(x.state == SFP_I2C_XFER_DONE && x.result == 4);
+    CHECK(log.calls == 1 && log.result == 4);
+    CHECK(buf[0] == 0xB0 && buf[3] == 0xB3);
+    CHECK(sfp_i2c_fsm_active(f) == NULL);
+
+    /* Só escrita: resultado é o número de bytes escritos, STOP no último */
+    static const uint8_t data[3] = { 0x80, 1, 2 };
+    sfp_i2c_xfer_write(&x, 0x51, data, sizeof(data));
+    CHECK(sfp_i2c_fsm_submit(f, &x));
+    n = 0;
+    while (n < 8 && sfp_i2c_fsm_next_cmd(f, &cmd[n]))
+        n++;
+    CHECK(n == 3);
+    CHECK((cmd[0] & CMD_FLAGS) == 0 && (cmd[1] & CMD_FLAGS) == 0);
+    CHECK(cmd[2] == (2u | SFP_I2C_CMD_STOP));
+    sfp_i2c_fsm_stop(f);
+    CHECK(x.result == 3);
+}
+
+/* Leitura maior que a FIFO de RX: no máximo 16 leituras sem byte drenado */
+static void test_long_read(sfp_i2c_fsm_t *f)
+{
+    uint8_t buf[40];
+    sfp_i2c_xfer_t x;
+    uint32_t cmd;
+    unsigned issued = 0, stops = 0;
+
+    sfp_i2c_xfer_read(&x, 0x50, buf, sizeof(buf));
+    CHECK(sfp_i2c_fsm_submit(f, &x));
+
+    while (sfp_i2c_fsm_next_cmd(f, &cmd))
+        issued++;
+    CHECK(issued == SFP_I2C_FIFO_DEPTH);
+    CHECK(!sfp_i2c_fsm_cmds_done(f));
+
+    /* Cada byte drenado libera exatamente uma nova leitura */
+    sfp_i2c_fsm_rx(f, 0);
+    CHECK(sfp_i2c_fsm_next_cmd(f, &cmd));
+    CHECK(!sfp_i2c_fsm_next_cmd(f, &cmd));
+    issued++;
+
+    size_t received = 1;
+    while (received < sizeof(buf)) {
+        sfp_i2c_fsm_rx(f, (uint8_t)received);
+        received++;
+        while (sfp_i2c_fsm_next_cmd(f, &cmd)) {
+            CHECK(cmd & SFP_I2C_CMD_READ);
+            CHECK(!(cmd & SFP_I2C_CMD_RESTART));
+            if (cmd & SFP_I2C_CMD_STOP)
+                stops++;
+            issued++;
+            CHECK(x.reads_issued - x.reads_done <= SFP_I2C_FIFO_DEPTH);
+        }
+    }
+    CHECK(issued == sizeof(buf) && stops == 1);
+    CHECK(sfp_i2c_fsm_cmds_done(f));
+
+    sfp_i2c_fsm_stop(f);
+    CHECK(x.result == (int)sizeof(buf));
+    CHECK(buf[0] == 0 && buf[39] == 39);
+}
+
+/* ISR acordada só por RX_FULL (meia FIFO) e STOP_DET: a leitura nunca
+   fica parada com bytes abaixo do limiar e o resto sai no STOP_DET */
+static void test_half_fifo_drain(sfp_i2c_fsm_t *f)
+{
+    uint8_t buf[21];            /* 16 + resto de 5, abaixo do limiar */
+    uint8_t rx[SFP_I2C_FIFO_DEPTH];
+    size_t rxflr = 0;
+    uint8_t next = 0;
+    unsigned rx_full = 0;
+    bool stop = false;
+    sfp_i2c_xfer_t x;
+    uint32_t cmd;
+
+    sfp_i2c_xfer_read(&x, 0x50, buf, sizeof(buf));
+    CHECK(sfp_i2c_fsm_submit(f, &x));
+
+    for (;;) {
+        /* Cada leitura emitida vira um byte na FIFO de RX */
+        while (sfp_i2c_fsm_next_cmd(f, &cmd)) {
+            CHECK(rxflr < sizeof(rx));
+            rx[rxflr++] = next++;
+            stop = stop || (cmd & SFP_I2C_CMD_STOP);
+        }
+        if (stop)
+            break;
+
+        /* Sem STOP emitido: a próxima interrupção tem de ser RX_FULL */
+        CHECK(rxflr > SFP_I2C_RX_TL);
+        if (rxflr <= SFP_I2C_RX_TL)
+            return;
+        rx_full++;
+        for (size_t i = 0; i < rxflr; i++)
+            sfp_i2c_fsm_rx(f, rx[i]);
+        rxflr = 0;
+    }
+    CHECK(rxflr <= SFP_I2C_RX_TL);
+
+    /* STOP_DET: a ISR drena o resto antes de concluir */
+    for (size_t i = 0; i < rxflr; i++)
+        sfp_i2c_fsm_rx(f, rx[i]);
+    sfp_i2c_fsm_stop(f);
+
+    CHECK(rx_full == 1);
+    CHECK(x.result == (int)sizeof(buf));
+    CHECK(buf[0] == 0 && buf[20] == 20);
+}
+
+/* TX_ABRT (NAK): para de emitir, o STOP conclui com o erro */
+static void test_nak_abort(sfp_i2c_fsm_t *f)
+{
+    static const uint8_t data[3] = { 0, 1, 2 };
+    sfp_i2c_xfer_t x;
+    cb_log_t log = { 0 };
+    uint32_t cmd, failed = f->failed;
+
+    sfp_i2c_xfer_write(&x, 0x52, data, sizeof(data));
+    x.cb   = on_done;
+    x.user = &log;
+    CHECK(sfp_i2c_fsm_submit(f, &x));
+    CHECK(sfp_i2c_fsm_next_cmd(f, &cmd));
+
+    sfp_i2c_fsm_abort(f, SFP_XFER_ERR_NAK);
+    sfp_i2c_fsm_abort(f, SFP_XFER_ERR_TIMEOUT);    /* o primeiro erro vale */
+    CHECK(!sfp_i2c_fsm_next_cmd(f, &cmd));
+    CHECK(sfp_i2c_fsm_cmds_done(f));
+    CHECK(log.calls == 0);
+
+    CHECK(sfp_i2c_fsm_stop(f) == NULL);
+    CHECK(x.result == SFP_XFER_ERR_NAK && log.result == SFP_XFER_ERR_NAK);
+    CHECK(f->failed == failed + 1 && f->error == 0);
+
+    /* Aborto sem ativo é ignorado */
+    sfp_i2c_fsm_abort(f, SFP_XFER_ERR_NAK);
+    CHECK(f->error == 0);
+    CHECK(sfp_i2c_fsm_stop(f) == NULL);
+}
+
+/* STOP_DET antes de todos os comandos (perda de arbitragem) */
+static void test_early_stop(sfp_i2c_fsm_t *f)
+{
+    static const uint8_t offset[1] = { 0 };
+    uint8_t buf[4];
+    sfp_i2c_xfer_t x;
+    uint32_t cmd;
+
+    sfp_i2c_xfer_write_read(&x, 0x50, offset, sizeof(offset), buf, sizeof(buf));
+    CHECK(sfp_i2c_fsm_submit(f, &x));
+    CHECK(sfp_i2c_fsm_next_cmd(f, &cmd));
+    CHECK(sfp_i2c_fsm_next_cmd(f, &cmd));
+    sfp_i2c_fsm_rx(f, 0xAA);
+    sfp_i2c_fsm_stop(f);
+    CHECK(x.result == SFP_XFER_ERR_IO);
+
+    /* Comandos todos emitidos, mas faltam bytes na RX */
+    sfp_i2c_xfer_read(&x, 0x50, buf, 2);
+    CHECK(sfp_i2c_fsm_submit(f, &x));
+    while (sfp_i2c_fsm_next_cmd(f, &cmd))
+        ;
+    sfp_i2c_fsm_rx(f, 0xAA);
+    sfp_i2c_fsm_stop(f);
+    CHECK(x.result == SFP_XFER_ERR_IO);
+}
+
+/* Sem bytes não haveria STOP_DET: concluído já no submit */
+static void test_empty(sfp_i2c_fsm_t *f)
+{
+    sfp_i2c_xfer_t x;
+    cb_log_t log = { 0 };
+    uint32_t cmd;
+
+    sfp_i2c_xfer_write_read(&x, 0x50, NULL, 0, NULL, 0);
+    x.cb   = on_done;
+    x.user = &log;
+    CHECK(!sfp_i2c_fsm_submit(f, &x));
+    CHECK(x.state == SFP_I2C_XFER_DONE && x.result == SFP_XFER_ERR_IO);
+    CHECK(log.calls == 1);
+    CHECK(sfp_i2c_fsm_active(f) == NULL);
+    CHECK(!sfp_i2c_fsm_next_cmd(f, &cmd));
+    CHECK(sfp_i2c_fsm_cmds_done(f));
+}
+
+/* Fila: STOP promove o próximo; cancel conclui todos com o erro */
+static void test_chaining(sfp_i2c_fsm_t *f)
+{
+    static const uint8_t d[3][1] = { { 0x10 }, { 0x20 }, { 0x30 } };
+    sfp_i2c_xfer_t x[3];
+    cb_log_t log[3] = { { 0 } };
+    uint32_t cmd;
+
+    for (int i = 0; i < 3; i++) {
+        sfp_i2c_xfer_write(&x[i], 0x50, d[i], 1);
+        x[i].cb   = on_done;
+        x[i].user = &log[i];
+    }
+    CHECK(sfp_i2c_fsm_submit(f, &x[0]));
+    CHECK(!sfp_i2c_fsm_submit(f, &x[1]));
+    CHECK(!sfp_i2c_fsm_submit(f, &x[2]));
+    CHECK(x[1].state == SFP_I2C_XFER_QUEUED && x[2].state == SFP_I2C_XFER_QUEUED);
+
+    /* O ativo emite só os próprios comandos */
+    CHECK(sfp_i2c_fsm_next_cmd(f, &cmd) && cmd == (0x10u | SFP_I2C_CMD_STOP));
+    CHECK(!sfp_i2c_fsm_next_cmd(f, &cmd));
+
+    CHECK(sfp_i2c_fsm_stop(f) == &x[1]);
+    CHECK(x[0].state == SFP_I2C_XFER_DONE && log[0].result == 1);
+    CHECK(x[1].state == SFP_I2C_XFER_ACTIVE && log[1].calls == 0);
+    CHECK(sfp_i2c_fsm_next_cmd(f, &cmd) && (cmd & 0xFF) == 0x20);
+
+    sfp_i2c_fsm_cancel(f, SFP_XFER_ERR_TIMEOUT);
+    CHECK(sfp_i2c_fsm_active(f) == NULL && f->tail == NULL);
+    CHECK(log[1].calls == 1 && log[1].result == SFP_XFER_ERR_TIMEOUT);
+    CHECK(log[2].calls == 1 && log[2].result == SFP_XFER_ERR_TIMEOUT);
+    CHECK(x[2].state == SFP_I2C_XFER_DONE);
+
+    /* Fila vazia de novo: o próximo submit vira o ativo */
+    sfp_i2c_xfer_write(&x[0], 0x50, d[0], 1);
+    CHECK(sfp_i2c_fsm_submit(f, &x[0]));
+    CHECK(sfp_i2c_fsm_next_cmd(f, &cmd));
+    CHECK(sfp_i2c_fsm_stop(f) == NULL && x[0].result == 1);
+}
+
+int main(void)
+{
+    sfp_i2c_fsm_t f;
+
+    sfp_i2c_fsm_init(&f);
+    CHECK(sfp_i2c_fsm_active(&f) == NULL);
+    CHECK(sfp_i2c_fsm_stop(&f) == NULL);
+
+    test_write_restart_read(&f);
+    test_long_read(&f);
+    test_half_fifo_drain(&f);
+    test_nak_abort(&f);
+    test_early_stop(&f);
+    test_empty(&f);
+    test_chaining(&f);
+
+    CHECK(f.completed == 6);
+    return CHECK_DONE();
+}
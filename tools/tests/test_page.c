@@ -0,0 +1,185 @@
+/**
+ * @file test_page.c
+ * @brief Acesso paginado ao A2h 128-255 (I2C/page.c)
+ *
+ * @details
+ *  Sobre a memória paginada do backend emulado (byte 127 seleciona a
+ *  página): seleção memorizada que evita a escrita, begin/end restaurando
+ *  a página original, sfp_page_invalidate() após escrita externa no byte
+ *  127 e os limites da faixa 128-255. Também a leitura preguiçosa da
+ *  área do fornecedor do A0h (sfp_a0_upper_t).
+ */
+
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/page.h"
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a2h.h"
+#include "check.h"
+
+static sfp_host_eeprom_t dev;
+static sfp_transport_t bus;
+
+/* Página n preenchida com (n << 4) + i, para reconhecer a origem dos bytes */
+static void fill_pages(void)
+{
+    uint8_t a2[SFP_HOST_EEPROM_SIZE] = { 0 };
+    uint8_t page[SFP_HOST_PAGE_SIZE];
+
+    sfp_host_eeprom_init(&dev);
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A2, a2, sizeof(a2)));
+    for (uint8_t n = 0; n < SFP_HOST_A2_PAGES; n++) {
+        for (size_t i = 0; i < sizeof(page); i++)
+            page[i] = (uint8_t)((n << 4) + (i & 0x0F));
+        CHECK(sfp_host_eeprom_set_page(&dev, n, page, sizeof(page)));
+    }
+    sfp_host_transport_init(&bus, &dev);
+}
+
+/* buf lido a partir de 'offset' veio da página n? */
+static bool page_is(const uint8_t *buf, size_t len, uint8_t n, uint8_t offset)
+{
+    for (size_t i = 0; i < len; i++) {
+        if (buf[i] != (uint8_t)((n << 4) + ((offset + i) & 0x0F)))
+            return false;
+    }
+    return true;
+}
+
+static void test_cached_select(sfp_page_t *pg)
+{
+    uint8_t buf[16];
+
+    CHECK(sfp_page_begin(pg));
+    CHECK(pg->current == PAGE_00 && pg->saved == PAGE_00);
+
+    /* Página já ativa: nenhuma escrita no byte 127 */
+    CHECK(sfp_page_read(pg, PAGE_00, 128, buf, sizeof(buf)));
+    CHECK(page_is(buf, sizeof(buf), 0, 128));
+    CHECK(dev.page_selects == 0 && pg->select_hits == 1);
+
+    CHECK(sfp_page_read(pg, PAGE_02, 128, buf, sizeof(buf)));
+    CHECK(page_is(buf, sizeof(buf), 2, 128));
+    CHECK(dev.page_selects == 1 && pg->selects == 1);
+
+    CHECK(sfp_page_read(pg, PAGE_02, 144, buf, sizeof(buf)));
+    CHECK(page_is(buf, sizeof(buf), 2, 144));
+    CHECK(dev.page_selects == 1 && pg->select_hits == 2);
+
+    /* end: volta para a página encontrada no begin */
+    CHECK(sfp_page_end(pg));
+    CHECK(dev.mem[1][A2_PAGE_SELECT] == PAGE_00 && dev.page_selects == 2);
+    CHECK(pg->saved == SFP_PAGE_NONE);
+    CHECK(sfp_page_end(pg));            /* sem begin: nada a restaurar */
+    CHECK(dev.page_selects == 2);
+}
+
+static void test_begin_restores_nonzero(sfp_page_t *pg)
+{
+    uint8_t buf[8];
+
+    /* Outro mestre deixou a página 01h selecionada */
+    dev.mem[1][A2_PAGE_SELECT] = PAGE_01;
+    sfp_page_invalidate(pg);
+
+    CHECK(sfp_page_begin(pg));
+    CHECK(pg->saved == PAGE_01);
+    CHECK(sfp_page_read(pg, PAGE_03, 200, buf, sizeof(buf)));
+    CHECK(page_is(buf, sizeof(buf), 3, 200));
+    CHECK(sfp_page_end(pg));
+    CHECK(dev.mem[1][A2_PAGE_SELECT] == PAGE_01);
+}
+
+static void test_invalidate(sfp_page_t *pg)
+{
+    uint8_t buf[4];
+    uint32_t writes;
+
+    CHECK(sfp_page_select(pg, PAGE_00));
+    writes = dev.page_selects;
+
+    /* Escrita no byte 127 por fora: sem invalidar, a leitura viria da página errada */
+    dev.mem[1][A2_PAGE_SELECT] = PAGE_02;
+    CHECK(sfp_page_read(pg, PAGE_00, 128, buf, sizeof(buf)));
+    CHECK(page_is(buf, sizeof(buf), 2, 128));
+    CHECK(dev.page_selects == writes);
+
+    sfp_page_invalidate(pg);
+    CHECK(pg->current == SFP_PAGE_NONE);
+    CHECK(sfp_page_read(pg, PAGE_00, 128, buf, sizeof(buf)));
+    CHECK(page_is(buf, sizeof(buf), 0, 128));
+    CHECK(dev.page_selects == writes + 1);
+}
+
+static void test_bounds_and_faults(sfp_page_t *pg)
+{
+    uint8_t buf[16];
+
+    CHECK(!sfp_page_read(pg, PAGE_00, 100, buf, 4));
+    CHECK(!sfp_page_read(pg, PAGE_00, 250, buf, 10));
+    CHECK(!sfp_page_read(pg, PAGE_00, 128, buf, 0));
+    CHECK(sfp_page_read(pg, PAGE_00, 248, buf, 8));
+
+    /* Página inexistente no módulo lê 0xFF */
+    CHECK(sfp_page_read(pg, SFP_HOST_A2_PAGES, 128, buf, 4));
+    CHECK(buf[0] == 0xFF && buf[3] == 0xFF);
+
+    /* Módulo removido: falha esquece a página e o begin não guarda nada */
+    dev.present[1] = false;
+    CHECK(!sfp_page_read(pg, PAGE_00, 128, buf, 4));
+    CHECK(pg->current == SFP_PAGE_NONE);
+    CHECK(!sfp_page_begin(pg));
+    CHECK(pg->saved == SFP_PAGE_NONE);
+    dev.present[1] = true;
+}
+
+/* A0h 128-255: uma leitura na primeira consulta, outra só após invalidar */
+static void test_a0_upper(void)
+{
+    uint8_t a0[SFP_HOST_EEPROM_SIZE];
+    sfp_a0_upper_t u;
+
+    for (size_t i = 0; i < sizeof(a0); i++)
+        a0[i] = (uint8_t)i;
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A0, a0, sizeof(a0)));
+
+    sfp_a0_upper_init(&u, &bus);
+    dev.transactions = 0;
+    CHECK(u.reads == 0 && dev.transactions == 0);
+
+    const uint8_t *v = sfp_a0_upper_get(&u);
+    CHECK(v && v[0] == SFP_A0_UPPER_START && v[SFP_A0_UPPER_SIZE - 1] == 0xFF);
+    CHECK(u.reads == 1);
+
+    uint32_t tx = dev.transactions;
+    CHECK(sfp_a0_upper_get(&u) == v && u.reads == 1 && dev.transactions == tx);
+
+    /* Outro módulo: invalidado, relido */
+    dev.mem[0][SFP_A0_UPPER_START] = 0x5A;
+    sfp_a0_upper_invalidate(&u);
+    v = sfp_a0_upper_get(&u);
+    CHECK(v && v[0] == 0x5A && u.reads == 2);
+
+    /* Falha de leitura não deixa dados velhos como válidos */
+    sfp_a0_upper_invalidate(&u);
+    dev.present[0] = false;
+    CHECK(sfp_a0_upper_get(&u) == NULL && !u.loaded);
+    dev.present[0] = true;
+}
+
+int main(void)
+{
+    sfp_page_t pg;
+
+    fill_pages();
+    sfp_page_init(&pg, &bus);
+    CHECK(pg.current == SFP_PAGE_NONE);
+
+    test_cached_select(&pg);
+    test_begin_restores_nonzero(&pg);
+    test_invalidate(&pg);
+    test_bounds_and_faults(&pg);
+    test_a0_upper();
+    return CHECK_DONE();
+}
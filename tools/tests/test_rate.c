@@ -0,0 +1,118 @@
+/**
+ * @file test_rate.c
+ * @brief Taxa de sinalização dos bytes 12/66/67 (sfp_rate_decode, a0h.c)
+ *
+ * @details
+ *  Tabela com byte 12 = 00h, valores comuns, margens inferiores de 100% ou
+ *  mais, a forma estendida (FFh: nominal no byte 66 em 250 MBd, byte 67
+ *  como margem simétrica) e resultados acima de 16 bits. Depois o mesmo
+ *  caminho pela imagem: parser do A0h, getter de 32 bits, visão sem cópia
+ *  e o texto do classificador.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a0_view.h"
+#include "sfp_8472/classify.h"
+#include "check.h"
+
+typedef struct {
+    uint8_t  br_nominal;    /* byte 12 */
+    uint8_t  br_max;        /* byte 66 */
+    uint8_t  br_min;        /* byte 67 */
+    sfp_nominal_rate_status_t status;
+    uint32_t nominal_mbd;
+    uint32_t max_mbd;
+    uint32_t min_mbd;
+} rate_case_t;
+
+static const rate_case_t cases[] = {
+    /* Sem taxa nominal: margens ignoradas */
+    { 0x00,  10,   5, SFP_NOMINAL_RATE_NOT_SPECIFIED,      0,      0,     0 },
+
+    /* Byte 12 em 100 MBd, 66/67 margens superior/inferior */
+    { 0x67,   0,   0, SFP_NOMINAL_RATE_VALID,          10300,  10300, 10300 },
+    { 0x0D,  10,  20, SFP_NOMINAL_RATE_VALID,           1300,   1430,  1040 },
+    { 0x0D,   0,  99, SFP_NOMINAL_RATE_VALID,           1300,   1300,    13 },
+    { 0x0D,   0, 100, SFP_NOMINAL_RATE_VALID,           1300,   1300,     0 },
+    { 0x0D,   0, 150, SFP_NOMINAL_RATE_VALID,           1300,   1300,     0 },
+    { 0xFE, 255, 255, SFP_NOMINAL_RATE_VALID,          25400,  90170,     0 },
+
+    /* FFh: 66 em 250 MBd, 67 vale para os dois lados */
+    { 0xFF, 103,   3, SFP_NOMINAL_RATE_EXTENDED,       25750,  26522, 24977 },
+    { 0xFF, 103,   0, SFP_NOMINAL_RATE_EXTENDED,       25750,  25750, 25750 },
+    { 0xFF, 255, 255, SFP_NOMINAL_RATE_EXTENDED,       63750, 226312,     0 },
+    { 0xFF,   0,  10, SFP_NOMINAL_RATE_EXTENDED,           0,      0,     0 },
+};
+
+static void test_decode_table(void)
+{
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const rate_case_t *tc = &cases[i];
+        sfp_rate_t r;
+
+        memset(&r, 0xA5, sizeof(r));
+        sfp_rate_decode(tc->br_nominal, tc->br_max, tc->br_min, &r);
+
+        bool ok = r.status == tc->status && r.nominal_mbd == tc->nominal_mbd &&
+                  r.max_mbd == tc->max_mbd && r.min_mbd == tc->min_mbd;
+        if (!ok)
+            printf("caso %zu: %02X/%02X/%02X -> %lu %lu %lu (status %d)\n", i,
+                   tc->br_nominal, tc->br_max, tc->br_min, (unsigned long)r.nominal_mbd,
+                   (unsigned long)r.max_mbd, (unsigned long)r.min_mbd, (int)r.status);
+        CHECK(ok);
+    }
+
+    sfp_rate_decode(0x67, 0, 0, NULL);          /* sem destino: ignorado */
+}
+
+/* 25GBASE-SR: byte 12 = FFh, 66 = 103 (25.75 GBd), 67 = 3% */
+static void test_image_path(void)
+{
+    uint8_t d[SFP_A0_SIZE];
+    sfp_a0h_base_t a0;
+    sfp_nominal_rate_status_t st;
+    sfp_rate_t r;
+    sfp_class_t cls;
+
+    memset(d, 0, sizeof(d));
+    d[A0_IDENTIFIER]      = SFP_ID_SFP;
+    d[A0_EXT_IDENTIFIER]  = SFP_EXT_IDENTIFIER_EXPECTED;
+    d[A0_BR_NOMINAL]      = SFP_NOMINAL_RATE_RAW_EXTENDED;
+    d[A0_BR_MAX]          = 103;
+    d[A0_BR_MIN]          = 3;
+
+    memset(&a0, 0, sizeof(a0));
+    sfp_parse_a0_base(d, &a0);
+
+    uint32_t mbd = sfp_a0_get_nominal_rate_mbd(&a0, &st);
+    CHECK(mbd == 25750 && st == SFP_NOMINAL_RATE_EXTENDED);
+    CHECK(sfp_a0_get_rate(&a0, &r));
+    CHECK(r.max_mbd == 26522 && r.min_mbd == 24977);
+
+    CHECK(sfp_a0v_nominal_rate_mbd(sfp_a0_view(d), &st) == 25750);
+    CHECK(st == SFP_NOMINAL_RATE_EXTENDED);
+
+    sfp_classify(&a0, &cls);
+    CHECK(cls.rate_mbd == 25750);
+    CHECK(strstr(cls.text, "25.75 Gb/s") != NULL);
+
+    /* Sem taxa: getter e classificador em 0, sem texto de taxa */
+    d[A0_BR_NOMINAL] = SFP_NOMINAL_RATE_RAW_UNSPECIFIED;
+    sfp_parse_a0_base(d, &a0);
+    CHECK(sfp_a0_get_nominal_rate_mbd(&a0, &st) == 0 && st == SFP_NOMINAL_RATE_NOT_SPECIFIED);
+    CHECK(!sfp_a0_get_rate(&a0, &r));
+    sfp_classify(&a0, &cls);
+    CHECK(cls.rate_mbd == 0 && strstr(cls.text, "b/s") == NULL);
+
+    CHECK(sfp_a0_get_nominal_rate_mbd(NULL, &st) == 0 && st == SFP_NOMINAL_RATE_NOT_SPECIFIED);
+}
+
+int main(void)
+{
+    test_decode_table();
+    test_image_path();
+    return CHECK_DONE();
+}
@@ -0,0 +1,92 @@
+/**
+ * @file test_retry.c
+ * @brief Novas tentativas e recuperação do barramento (I2C/retry.c)
+ *
+ * @details
+ *  Sobre o backend emulado: clock recusado pelo backend (fila da ISR
+ *  ocupada) conta como SFP_XFER_BUSY e não dispara ops->recover, que
+ *  abortaria as transferências em curso; barramento travado (timeout)
+ *  é recuperado e a tentativa seguinte lê normalmente.
+ */
+
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/retry.h"
+#include "I2C/speed.h"
+#include "sfp_8472/a0h.h"
+#include "check.h"
+
+static sfp_host_eeprom_t dev;
+static sfp_speed_profile_t speed;
+static sfp_retry_t retry;
+static sfp_transport_t bus;
+
+static void setup(void)
+{
+    uint8_t a0[SFP_HOST_EEPROM_SIZE];
+
+    for (size_t i = 0; i < sizeof(a0); i++)
+        a0[i] = (uint8_t)i;
+
+    sfp_host_eeprom_init(&dev);
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A0, a0, sizeof(a0)));
+    sfp_host_transport_init(&bus, &dev);
+
+    sfp_speed_init(&speed, SFP_SPEED_DEFAULT_HZ);
+    bus.speed = &speed;
+
+    sfp_retry_init(&retry);
+    retry.backoff_base_us = 1;
+    retry.backoff_max_us  = 4;
+    bus.retry = &retry;
+}
+
+/* Troca de clock recusada: espera e tenta de novo, sem recuperar */
+static void test_busy_not_recovered(void)
+{
+    uint8_t buf[8];
+    const sfp_dev_counters_t *c;
+
+    CHECK(sfp_speed_set(&speed, SFP_I2C_ADDR_A0, 400000));
+    dev.baud_locked = true;
+
+    CHECK(!sfp_read_block(&bus, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf)));
+    c = sfp_retry_counters(&retry, SFP_I2C_ADDR_A0);
+    CHECK(c && c->io == retry.max_attempts && c->retries == retry.max_attempts - 1u);
+    CHECK(c->timeout == 0 && c->recoveries == 0);
+    CHECK(dev.recoveries == 0 && dev.transactions == 0);
+
+    static const uint8_t data[2] = { 0x80, 0x00 };
+    CHECK(!sfp_write_raw(&bus, SFP_I2C_ADDR_A0, data, sizeof(data)));
+    CHECK(c->recoveries == 0 && dev.recoveries == 0);
+
+    /* Fila livre: o clock do perfil é aplicado e a leitura passa */
+    dev.baud_locked = false;
+    CHECK(sfp_read_block(&bus, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf)));
+    CHECK(buf[0] == 0 && buf[7] == 7);
+    CHECK(dev.baud == 400000 && speed.current_baud == 400000);
+    CHECK(c->ok == 1 && c->recoveries == 0);
+}
+
+/* Timeout: recupera o barramento antes da próxima tentativa */
+static void test_timeout_recovered(void)
+{
+    uint8_t buf[4];
+    const sfp_dev_counters_t *c = sfp_retry_counters(&retry, SFP_I2C_ADDR_A0);
+    uint32_t recoveries = c->recoveries;
+
+    dev.bus_stuck = true;
+    CHECK(sfp_read_block(&bus, SFP_I2C_ADDR_A0, 16, buf, sizeof(buf)));
+    CHECK(buf[0] == 16);
+    CHECK(dev.recoveries == 1 && c->recoveries == recoveries + 1);
+    CHECK(c->timeout == 1 && !dev.bus_stuck);
+}
+
+int main(void)
+{
+    setup();
+    test_busy_not_recovered();
+    test_timeout_recovered();
+    return CHECK_DONE();
+}
@@ -0,0 +1,183 @@
+/**
+ * @file test_sched.c
+ * @brief Ordem de despacho do escalonador (I2C/sched.c)
+ *
+ * @details
+ *  Dois módulos emulados fazem o papel dos dois barramentos. Verifica
+ *  que CRITICAL passa à frente de BULK (inclusive quando enfileirada por
+ *  um callback no meio de um frame), a ordem por deadline e por chegada
+ *  dentro da mesma prioridade e as métricas de fila.
+ */
+
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/sched.h"
+#include "sfp_8472/a0h.h"
+#include "check.h"
+
+#define MAX_LOG 16
+
+static sfp_sched_t sched;
+static sfp_transport_t bus_a, bus_b;
+static uint8_t order[MAX_LOG];
+static unsigned done;
+
+static void on_done(sfp_sched_req_t *req, bool ok, void *user)
+{
+    (void)req;
+    CHECK(ok);
+    if (done < MAX_LOG)
+        order[done++] = (uint8_t)(uintptr_t)user;
+}
+
+static void reset_log(void)
+{
+    memset(order, 0, sizeof(order));
+    done = 0;
+}
+
+static uint8_t page[4][3] = { { 0x40, 1, 2 }, { 0x48, 3, 4 }, { 0x50, 5, 6 }, { 0x58, 7, 8 } };
+
+static bool submit_page(sfp_sched_req_t *req, int i, uint64_t deadline)
+{
+    return sfp_sched_submit_write(&sched, req, &bus_a, SFP_I2C_ADDR_A0, page[i], sizeof(page[i]),
+                                  SFP_SCHED_PRIO_BULK, deadline, on_done,
+                                  (void *)(uintptr_t)(10 + i));
+}
+
+/* CRITICAL enfileirada depois das páginas sai primeiro */
+static void test_critical_first(void)
+{
+    sfp_sched_req_t pages[4], alarm;
+    uint8_t buf[8];
+
+    reset_log();
+    for (int i = 0; i < 4; i++)
+        CHECK(submit_page(&pages[i], i, 0));
+    CHECK(sfp_sched_submit_read(&sched, &alarm, &bus_a, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf),
+                                SFP_SCHED_PRIO_CRITICAL, 0, on_done, (void *)(uintptr_t)1));
+    CHECK(sfp_sched_pending(&alarm));
+
+    /* Requisição ainda na fila não pode ser reenviada */
+    CHECK(!submit_page(&pages[0], 0, 0));
+
+    sfp_sched_run(&sched, 1000000u);
+    CHECK(done == 5);
+    CHECK(order[0] == 1);
+    for (int i = 0; i < 4; i++)
+        CHECK(order[1 + i] == 10 + i);
+    CHECK(!sfp_sched_pending(&alarm) && alarm.state == SFP_SCHED_DONE);
+}
+
+/* Callback de uma página enfileira um CRITICAL: preempta as páginas restantes */
+static sfp_sched_req_t late_alarm;
+static uint8_t late_buf[8];
+
+static void on_page_then_alarm(sfp_sched_req_t *req, bool ok, void *user)
+{
+    on_done(req, ok, user);
+    if (done == 1)
+        CHECK(sfp_sched_submit_read(&sched, &late_alarm, &bus_a, SFP_I2C_ADDR_A0, 0, late_buf,
+                                    sizeof(late_buf), SFP_SCHED_PRIO_CRITICAL, 0, on_done,
+                                    (void *)(uintptr_t)1));
+}
+
+static void test_critical_preempts_frame(void)
+{
+    sfp_sched_req_t pages[4];
+
+    reset_log();
+    for (int i = 0; i < 4; i++) {
+        CHECK(sfp_sched_submit_write(&sched, &pages[i], &bus_a, SFP_I2C_ADDR_A0, page[i],
+                                     sizeof(page[i]), SFP_SCHED_PRIO_BULK, 0,
+                                     on_page_then_alarm, (void *)(uintptr_t)(10 + i)));
+    }
+
+    sfp_sched_run(&sched, 1000000u);
+    CHECK(done == 5);
+    CHECK(order[0] == 10);
+    CHECK(order[1] == 1);
+    CHECK(order[2] == 11 && order[3] == 12 && order[4] == 13);
+}
+
+/* Mesma prioridade: deadline mais próximo, sem deadline por último, empate por chegada */
+static void test_deadline_and_seq(void)
+{
+    sfp_sched_req_t r[5];
+    uint8_t buf[5][4];
+    static const uint64_t deadline[5] = { 0, 3000, 1000, 1000, 2000 };
+
+    reset_log();
+    for (int i = 0; i < 5; i++) {
+        CHECK(sfp_sched_submit_read(&sched, &r[i], &bus_a, SFP_I2C_ADDR_A0, 0, buf[i],
+                                    sizeof(buf[i]), SFP_SCHED_PRIO_NORMAL, deadline[i],
+                                    on_done, (void *)(uintptr_t)(20 + i)));
+    }
+
+    /* HIGH sem deadline ainda vence NORMAL com deadline */
+    sfp_sched_req_t high;
+    CHECK(sfp_sched_submit_read(&sched, &high, &bus_a, SFP_I2C_ADDR_A0, 0, buf[0], 1,
+                                SFP_SCHED_PRIO_HIGH, 0, on_done, (void *)(uintptr_t)2));
+
+    sfp_sched_run(&sched, 1000000u);
+    CHECK(done == 6);
+    CHECK(order[0] == 2);
+    CHECK(order[1] == 22 && order[2] == 23);   /* 1000, 1000: ordem de chegada */
+    CHECK(order[3] == 24 && order[4] == 21);   /* 2000, 3000 */
+    CHECK(order[5] == 20);                     /* sem deadline */
+}
+
+/* Barramentos diferentes não se bloqueiam; métricas acompanham a fila */
+static void test_lanes_and_metrics(sfp_host_eeprom_t *slow)
+{
+    sfp_sched_req_t a, b;
+    uint8_t buf_a[4], buf_b[4];
+
+    sfp_sched_reset_metrics(&sched);
+    reset_log();
+
+    /* A leitura lenta em B não atrasa a de A, mesmo com prioridade menor */
+    slow->latency_us = 5000;
+    CHECK(sfp_sched_submit_read(&sched, &b, &bus_b, SFP_I2C_ADDR_A0, 0, buf_b, sizeof(buf_b),
+                                SFP_SCHED_PRIO_CRITICAL, 0, on_done, (void *)(uintptr_t)3));
+    CHECK(sfp_sched_submit_read(&sched, &a, &bus_a, SFP_I2C_ADDR_A0, 0, buf_a, sizeof(buf_a),
+                                SFP_SCHED_PRIO_BULK, 0, on_done, (void *)(uintptr_t)4));
+
+    const sfp_sched_metrics_t *m = sfp_sched_get_metrics(&sched);
+    CHECK(m->depth == 2 && m->depth_max == 2);
+
+    /* sfp_sched_run() volta quando nada avança, como a cada volta do laço principal */
+    for (unsigned i = 0; i < 10000000u && sfp_sched_pending(&b); i++)
+        sfp_sched_run(&sched, 1000000u);
+    CHECK(done == 2);
+    CHECK(order[0] == 4 && order[1] == 3);
+    CHECK(m->depth == 0);
+    CHECK(m->submitted[SFP_SCHED_PRIO_CRITICAL] == 1 && m->completed[SFP_SCHED_PRIO_CRITICAL] == 1);
+    CHECK(m->service_us_max[SFP_SCHED_PRIO_CRITICAL] >= slow->latency_us);
+    CHECK(m->errors[SFP_SCHED_PRIO_BULK] == 0);
+    slow->latency_us = 0;
+}
+
+int main(void)
+{
+    static sfp_host_eeprom_t dev_a, dev_b;
+    uint8_t a0[SFP_HOST_EEPROM_SIZE] = { 0 };
+
+    sfp_host_eeprom_init(&dev_a);
+    sfp_host_eeprom_init(&dev_b);
+    CHECK(sfp_host_eeprom_set(&dev_a, SFP_I2C_ADDR_A0, a0, sizeof(a0)));
+    CHECK(sfp_host_eeprom_set(&dev_b, SFP_I2C_ADDR_A0, a0, sizeof(a0)));
+    sfp_host_transport_init(&bus_a, &dev_a);
+    sfp_host_transport_init(&bus_b, &dev_b);
+    sfp_sched_init(&sched);
+
+    test_critical_first();
+    test_critical_preempts_frame();
+    test_deadline_and_seq();
+    test_lanes_and_metrics(&dev_b);
+
+    /* As escritas BULK chegaram à EEPROM */
+    CHECK(dev_a.mem[0][0x40] == 1 && dev_a.mem[0][0x59] == 8);
+    return CHECK_DONE();
+}
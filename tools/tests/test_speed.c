@@ -0,0 +1,117 @@
+/**
+ * @file test_speed.c
+ * @brief Negociação de velocidade por endereço (I2C/speed.c)
+ *
+ * @details
+ *  O backend emulado corrompe os bytes lidos acima de max_baud, como um
+ *  módulo que não aguenta Fast-mode. A escada 100k/400k/1M tem de parar
+ *  no último degrau íntegro, um CC_BASE já inválido em 100 kHz prende o
+ *  endereço em 100 kHz, e o perfil negociado de cada endereço é o que
+ *  sfp_speed_apply() programa antes das transações seguintes.
+ */
+
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/speed.h"
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a2h.h"
+#include "sfp_8472/checksum.h"
+#include "check.h"
+
+static sfp_host_eeprom_t dev;
+static sfp_speed_profile_t speed;
+static sfp_transport_t bus;
+
+static void setup(bool cc_ok, uint32_t max_baud)
+{
+    uint8_t a0[SFP_HOST_EEPROM_SIZE], a2[SFP_HOST_EEPROM_SIZE];
+
+    for (size_t i = 0; i < sizeof(a0); i++) {
+        a0[i] = (uint8_t)(7 * i + 1);
+        a2[i] = (uint8_t)(3 * i);
+    }
+    a0[A0_CC_BASE] = sfp_sum8(a0, A0_CC_BASE) + (cc_ok ? 0 : 1);
+
+    sfp_host_eeprom_init(&dev);
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A0, a0, sizeof(a0)));
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A2, a2, sizeof(a2)));
+    dev.max_baud = max_baud;
+
+    sfp_host_transport_init(&bus, &dev);
+    sfp_speed_init(&speed, dev.baud);
+    bus.speed = &speed;
+}
+
+/* Limite do módulo -> degrau negociado */
+static void test_ladder(void)
+{
+    static const struct {
+        uint32_t max_baud;
+        uint32_t expected;
+    } cases[] = {
+        { 0,        1000000 },      /* sem limite: Fast-mode Plus */
+        { 1000000,  1000000 },
+        { 400000,   400000 },       /* falha em 1 MHz */
+        { 999999,   400000 },
+        { 100000,   100000 },       /* falha já em 400 kHz */
+    };
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        setup(true, cases[i].max_baud);
+        CHECK(sfp_speed_negotiate_eeprom(&bus, SFP_I2C_ADDR_A0) == cases[i].expected);
+        CHECK(sfp_speed_get(&speed, SFP_I2C_ADDR_A0) == cases[i].expected);
+        CHECK(dev.baud == cases[i].expected && speed.current_baud == cases[i].expected);
+    }
+}
+
+/* CC_BASE inválido na referência: nenhum degrau acima de 100 kHz é tentado */
+static void test_invalid_cc_pins(void)
+{
+    setup(false, 0);
+    CHECK(sfp_speed_negotiate_eeprom(&bus, SFP_I2C_ADDR_A0) == 100000);
+    CHECK(sfp_speed_get(&speed, SFP_I2C_ADDR_A0) == 100000);
+    CHECK(dev.transactions == 2);               /* offset + uma leitura */
+    CHECK(dev.baud == 100000);
+
+    /* Módulo ausente: sem referência, nada negociado */
+    setup(true, 0);
+    dev.present[0] = false;
+    CHECK(sfp_speed_negotiate_eeprom(&bus, SFP_I2C_ADDR_A0) == 0);
+}
+
+/* Cada endereço leva o próprio clock para as transações seguintes */
+static void test_profile_reused(void)
+{
+    uint8_t buf[SFP_A0_SIZE];
+
+    setup(true, 400000);
+    CHECK(sfp_speed_negotiate_eeprom(&bus, SFP_I2C_ADDR_A0) == 400000);
+
+    /* O A2h responde em 1 MHz; o limite de dados só vale para o A0h */
+    CHECK(sfp_speed_set(&speed, SFP_I2C_ADDR_A2, 1000000));
+    dev.max_baud = 0;
+    CHECK(sfp_read_block(&bus, SFP_I2C_ADDR_A2, 0, buf, 16));
+    CHECK(dev.baud == 1000000 && buf[5] == 15);
+
+    dev.max_baud = 400000;
+    CHECK(sfp_read_block(&bus, SFP_I2C_ADDR_A0, 0, buf, sizeof(buf)));
+    CHECK(dev.baud == 400000 && speed.current_baud == 400000);
+    CHECK(sfp_checksum_range_ok(SFP_CHK_BASE, buf));
+
+    /* Já no clock certo: apply não reprograma */
+    dev.baud = 123;
+    CHECK(sfp_speed_apply(&bus, SFP_I2C_ADDR_A0));
+    CHECK(dev.baud == 123);
+
+    /* Endereço sem perfil usa o padrão */
+    CHECK(sfp_speed_get(&speed, 0x3C) == SFP_SPEED_DEFAULT_HZ);
+}
+
+int main(void)
+{
+    test_ladder();
+    test_invalid_cc_pins();
+    test_profile_reused();
+    return CHECK_DONE();
+}
@@ -0,0 +1,153 @@
+/**
+ * @file test_trace.c
+ * @brief Gravação do trace I2C (I2C/trace.c) e insumos do trace_replay
+ *
+ * @details
+ *  Grava uma sessão (A0h 0-127, A2h 0-127 e a sondagem das medidas) sobre
+ *  a EEPROM emulada, com e sem conteúdo, e confere o dump pelo próprio
+ *  decodificador. Deixa no diretório os arquivos usados pelos testes do
+ *  trace_replay (tools/CMakeLists.txt): o trace, os dumps do módulo e um
+ *  dump de A0h com um byte do número de série trocado.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "I2C/transport_host.h"
+#include "I2C/trace.h"
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a2h.h"
+#include "sfp_8472/checksum.h"
+#include "check.h"
+
+static void build_module(uint8_t *a0, uint8_t *a2)
+{
+    memset(a0, 0, SFP_HOST_EEPROM_SIZE);
+    memset(a2, 0, SFP_HOST_EEPROM_SIZE);
+
+    a0[A0_IDENTIFIER]     = 0x03;
+    a0[A0_EXT_IDENTIFIER] = SFP_EXT_IDENTIFIER_EXPECTED;
+    memset(&a0[A0_VENDOR_NAME], ' ', SFP_A0_LEN_VENDOR_NAME);
+    memcpy(&a0[A0_VENDOR_NAME], "FINISAR", 7);
+    memcpy(&a0[A0_VENDOR_SN], "SN0001", 6);
+    a0[A0_DIAG_MONITORING_TYPE] = 0x68;
+    a0[A0_CC_BASE] = sfp_sum8(a0, A0_CC_BASE);
+    a0[A0_CC_EXT]  = sfp_sum8(&a0[A0_OPTIONS], A0_CC_EXT - A0_OPTIONS);
+
+    a2[A2_TEMP_HIGH_ALARM] = 75;
+    a2[A2_TEMP_CURR]       = 30;
+}
+
+static bool write_file(const char *path, const uint8_t *data, size_t len)
+{
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return false;
+
+    bool ok = fwrite(data, 1, len, f) == len;
+    return fclose(f) == 0 && ok;
+}
+
+static void file_sink(void *user, const uint8_t *data, size_t len)
+{
+    fwrite(data, 1, len, (FILE *)user);
+}
+
+static uint8_t dump_buf[SFP_TRACE_HDR_SIZE + 16 * SFP_TRACE_REC_SIZE + 1024];
+static size_t dump_len;
+
+static void mem_sink(void *user, const uint8_t *data, size_t len)
+{
+    (void)user;
+    if (dump_len + len <= sizeof(dump_buf)) {
+        memcpy(dump_buf + dump_len, data, len);
+        dump_len += len;
+    }
+}
+
+/* Sessão de campo: identificação + duas sondagens com a temperatura mudando */
+static void record_session(sfp_host_eeprom_t *dev, sfp_transport_t *t, sfp_trace_t *tr)
+{
+    uint8_t buf[128];
+
+    t->trace = tr;
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A0, 0, buf, 128));
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A2, 0, buf, 128));
+    dev->mem[1][A2_TEMP_CURR] = 31;
+    CHECK(sfp_read_block(t, SFP_I2C_ADDR_A2, A2_TEMP_CURR, buf, 10));
+    CHECK(!sfp_probe(t, 0x52));
+    t->trace = NULL;
+}
+
+static void test_dump_decode(const sfp_trace_t *tr)
+{
+    sfp_trace_rec_t r;
+    const uint8_t *payload;
+    uint16_t plen;
+
+    dump_len = 0;
+    CHECK(sfp_trace_dump(tr, mem_sink, NULL) == 4);
+    CHECK(sfp_trace_decode_header(dump_buf, dump_len) == 4);
+
+    size_t pos = SFP_TRACE_HDR_SIZE, used;
+
+    used = sfp_trace_decode(dump_buf + pos, dump_len - pos, &r, &payload, &plen);
+    CHECK(used && r.kind == SFP_TRACE_READ && r.addr == SFP_I2C_ADDR_A0);
+    CHECK(r.offset == 0 && r.len == 128 && r.result == 128);
+    CHECK(plen == 128 && payload && payload[A0_IDENTIFIER] == 0x03);
+    CHECK(r.hash == sfp_trace_hash(payload, plen));
+    pos += used;
+
+    used = sfp_trace_decode(dump_buf + pos, dump_len - pos, &r, &payload, &plen);
+    pos += used;
+    used = sfp_trace_decode(dump_buf + pos, dump_len - pos, &r, &payload, &plen);
+    CHECK(used && r.offset == A2_TEMP_CURR && plen == 10 && payload[0] == 31);
+    pos += used;
+
+    used = sfp_trace_decode(dump_buf + pos, dump_len - pos, &r, &payload, &plen);
+    CHECK(used && r.kind == SFP_TRACE_PROBE && r.addr == 0x52 && r.result < 0);
+    CHECK(pos + used == dump_len);
+}
+
+int main(void)
+{
+    static sfp_host_eeprom_t dev;
+    static sfp_trace_t full, hash_only;
+    uint8_t a0[SFP_HOST_EEPROM_SIZE], a2[SFP_HOST_EEPROM_SIZE];
+    sfp_transport_t t;
+    FILE *f;
+
+    build_module(a0, a2);
+    CHECK(write_file("trace_a0.bin", a0, sizeof(a0)));
+    CHECK(write_file("trace_a2.bin", a2, sizeof(a2)));
+
+    sfp_host_eeprom_init(&dev);
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A0, a0, sizeof(a0)));
+    CHECK(sfp_host_eeprom_set(&dev, SFP_I2C_ADDR_A2, a2, sizeof(a2)));
+    sfp_host_transport_init(&t, &dev);
+
+    sfp_trace_init(&full, true);
+    record_session(&dev, &t, &full);
+    CHECK(sfp_trace_count(&full) == 4);
+    test_dump_decode(&full);
+
+    /* Sem conteúdo: só o hash vai para o dump */
+    dev.mem[1][A2_TEMP_CURR] = 30;
+    sfp_trace_init(&hash_only, false);
+    record_session(&dev, &t, &hash_only);
+
+    f = fopen("trace_session.bin", "wb");
+    CHECK(f && sfp_trace_dump(&full, file_sink, f) == 4);
+    if (f)
+        fclose(f);
+    f = fopen("trace_hash_only.bin", "wb");
+    CHECK(f && sfp_trace_dump(&hash_only, file_sink, f) == 4);
+    if (f)
+        fclose(f);
+
+    /* Módulo devolvido com um byte do SN diferente do que foi lido em campo */
+    a0[A0_VENDOR_SN + 5] = '2';
+    CHECK(write_file("trace_a0_other.bin", a0, sizeof(a0)));
+
+    return CHECK_DONE();
+}
@@ -0,0 +1,205 @@
+/**
+ * @file test_vendor_db.c
+ * @brief Hash perfeito e prefixos da base de fabricantes (sfp_8472/vendor_db.c)
+ *
+ * @details
+ *  Relê sfp_8472/vendor_db.txt (caminho em VENDOR_DB_TXT) e confere a
+ *  tabela gerada contra a fonte: cada OUI cai na própria entrada e cada
+ *  prefixo, completado com espaços como no A0h, devolve a própria família
+ *  e os quirks somados aos do fabricante. Depois percorre todo o espaço
+ *  de 24 bits: uma OUI fora da base, mesmo caindo num slot ocupado, é
+ *  recusada. Por fim, o prefixo mais longo vence o mais curto da mesma OUI.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sfp_8472/vendor_db.h"
+#include "check.h"
+
+#define MAX_ROWS    128
+#define PN_LEN      16
+
+typedef struct {
+    uint32_t oui;
+    char     pn[PN_LEN + 1];     /* "*" = linha do fabricante */
+    char     vendor[32];
+    char     family[32];
+    uint16_t quirks;
+} db_row_t;
+
+static db_row_t rows[MAX_ROWS];
+static size_t row_count;
+
+static char *trim(char *s)
+{
+    while (*s == ' ' || *s == '\t')
+        s++;
+
+    size_t n = strlen(s);
+    while (n && (s[n - 1] == ' ' || s[n - 1] == '\t' || s[n - 1] == '\n' || s[n - 1] == '\r'))
+        s[--n] = '\0';
+    return s;
+}
+
+static uint16_t parse_quirks(char *s)
+{
+    uint16_t q = 0;
+
+    for (char *tok = strtok(s, "|"); tok; tok = strtok(NULL, "|")) {
+        tok = trim(tok);
+        if (strcmp(tok, "IGNORE_LOS") == 0)           q |= SFP_QUIRK_IGNORE_LOS;
+        else if (strcmp(tok, "IGNORE_TX_FAULT") == 0) q |= SFP_QUIRK_IGNORE_TX_FAULT;
+        else if (strcmp(tok, "I2C_STD_ONLY") == 0)    q |= SFP_QUIRK_I2C_STD_ONLY;
+        else CHECK(!"quirk desconhecido na base");
+    }
+    return q;
+}
+
+static bool load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[256];
+
+    if (!f) {
+        fprintf(stderr, "test_vendor_db: %s: não foi possível abrir\n", path);
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), f) && row_count < MAX_ROWS) {
+        char *col[5];
+        int n = 0;
+        char *p = line;
+
+        if (*trim(line) == '#' || *trim(line) == '\0')
+            continue;
+
+        for (; n < 5; n++) {
+            col[n] = p;
+            p = strchr(p, ';');
+            if (!p)
+                break;
+            *p++ = '\0';
+        }
+        CHECK(n == 4);
+        if (n != 4)
+            continue;
+
+        db_row_t *r = &rows[row_count++];
+        unsigned b0, b1, b2;
+        CHECK(sscanf(trim(col[0]), "%x:%x:%x", &b0, &b1, &b2) == 3);
+        r->oui = (b0 << 16) | (b1 << 8) | b2;
+        snprintf(r->pn, sizeof(r->pn), "%s", trim(col[1]));
+        snprintf(r->vendor, sizeof(r->vendor), "%s", trim(col[2]));
+        snprintf(r->family, sizeof(r->family), "%s", trim(col[3]));
+        r->quirks = parse_quirks(col[4]);
+    }
+    fclose(f);
+    return row_count > 0;
+}
+
+static const db_row_t *vendor_row(uint32_t oui)
+{
+    for (size_t i = 0; i < row_count; i++) {
+        if (rows[i].oui == oui && strcmp(rows[i].pn, "*") == 0)
+            return &rows[i];
+    }
+    return NULL;
+}
+
+/* PN como vem no A0h: 16 bytes completados com espaços */
+static void pad_pn(char *dst, const char *pn)
+{
+    memset(dst, ' ', PN_LEN);
+    memcpy(dst, pn, strlen(pn));
+}
+
+static void test_every_row(void)
+{
+    char pn[PN_LEN];
+    sfp_vendor_info_t info;
+
+    for (size_t i = 0; i < row_count; i++) {
+        const db_row_t *r = &rows[i];
+        const db_row_t *v = vendor_row(r->oui);
+        bool is_vendor = strcmp(r->pn, "*") == 0;
+
+        CHECK(v != NULL);
+        if (!v)
+            continue;
+
+        /* PN que não casa com nenhum prefixo: só o fabricante */
+        pad_pn(pn, is_vendor ? "#" : r->pn);
+        bool ok = sfp_vendor_lookup(r->oui, pn, sizeof(pn), &info) &&
+                  info.oui == r->oui && strcmp(info.vendor, v->vendor) == 0;
+
+        if (is_vendor)
+            ok = ok && info.family == NULL && info.quirks == v->quirks;
+        else
+            ok = ok && info.family && strcmp(info.family, r->family) == 0 &&
+                 info.quirks == (uint16_t)(v->quirks | r->quirks);
+
+        if (!ok)
+            fprintf(stderr, "linha %zu: %06lX %s\n", i, (unsigned long)r->oui, r->pn);
+        CHECK(ok);
+    }
+}
+
+/* Todo o espaço de OUIs: só as da base são aceitas */
+static void test_unknown_rejected(void)
+{
+    static const char pn[PN_LEN] = "FTLX8571D3BCL   ";
+    sfp_vendor_info_t info;
+    uint32_t accepted = 0, wrong = 0;
+
+    for (uint32_t oui = 0; oui <= 0xFFFFFFu; oui++) {
+        if (!sfp_vendor_lookup(oui, pn, sizeof(pn), &info))
+            continue;
+        accepted++;
+        wrong += vendor_row(oui) == NULL || info.oui != oui;
+    }
+
+    size_t vendors = 0;
+    for (size_t i = 0; i < row_count; i++)
+        vendors += strcmp(rows[i].pn, "*") == 0;
+
+    CHECK(wrong == 0);
+    CHECK(accepted == vendors);
+
+    /* Bits acima dos 24 da OUI são ignorados */
+    CHECK(sfp_vendor_lookup(0xFF009065u, pn, sizeof(pn), &info) && info.oui == 0x009065u);
+    CHECK(!sfp_vendor_lookup(0x009065u, pn, sizeof(pn), NULL));
+}
+
+/* FINISAR: "FTLX" (SFP+ 10G) e "FTLX8571" (SR) na mesma OUI */
+static void test_longest_prefix(void)
+{
+    char pn[PN_LEN];
+    sfp_vendor_info_t info;
+
+    pad_pn(pn, "FTLX8571D3BCL");
+    CHECK(sfp_vendor_lookup(0x009065u, pn, sizeof(pn), &info));
+    CHECK(info.family && strcmp(info.family, "SFP+ 10G SR") == 0);
+
+    pad_pn(pn, "FTLX2071D327");
+    CHECK(sfp_vendor_lookup(0x009065u, pn, sizeof(pn), &info));
+    CHECK(info.family && strcmp(info.family, "SFP+ 10G") == 0);
+
+    /* PN mais curto que o prefixo não casa */
+    CHECK(sfp_vendor_lookup(0x009065u, "FTLX857", 7, &info));
+    CHECK(info.family && strcmp(info.family, "SFP+ 10G") == 0);
+    CHECK(sfp_vendor_lookup(0x009065u, "FTL", 3, &info) && info.family == NULL);
+    CHECK(sfp_vendor_lookup(0x009065u, NULL, 0, &info) && info.family == NULL);
+}
+
+int main(void)
+{
+    if (!load(VENDOR_DB_TXT))
+        return 1;
+
+    test_every_row();
+    test_unknown_rejected();
+    test_longest_prefix();
+    return CHECK_DONE();
+}
@@ -0,0 +1,410 @@
+/**
+ * @file trace_replay.c
+ * @brief Reprodução no host de um trace de transações I2C (I2C/trace.h)
+ *
+ * @details
+ *  Aceita o dump binário ("SFPT...") ou a captura de terminal do comando
+ *  't' da USB (#TRACE BEGIN ... #TRACE END, em hexadecimal).
+ *
+ *  Para cada transação imprime instante relativo, intervalo desde a
+ *  anterior, duração e resultado. O conteúdo gravado é conferido com o
+ *  próprio hash.
+ *
+ *  Com o dump do módulo (-a0/-a2, 256 bytes crus, ex.: lido do módulo
+ *  devolvido pelo cliente), cada leitura de 0x50/0x51 é reexecutada por
+ *  sfp_read_block() contra a EEPROM emulada carregada com ele, e o hash
+ *  do resultado é comparado com o gravado em campo — inclusive nos
+ *  registros que só guardaram o hash. Leitura que diverge mostra que o
+ *  módulo respondeu na sessão algo diferente do dump (byte corrompido,
+ *  offset errado, módulo trocado). A2h 96-255 muda durante a sessão: ali
+ *  vale o conteúdo gravado, e só a parte estática (0-95) das leituras que
+ *  o cruzam é comparada, byte a byte. Sem dump, a imagem é reconstruída a
+ *  partir do conteúdo gravado. Nos dois casos ela passa pelos parsers
+ *  (sfp_parse_a0_base e sfp_parse_a2h_rx_power).
+ *
+ *  Ao final, os pontos quentes do barramento: transações agrupadas por
+ *  (tipo, endereço, offset, tamanho), ordenadas pelo tempo total, e os
+ *  histogramas de latência por endereço (I2C/stats.h) das durações gravadas.
+ *
+ *  Uso: trace_replay <arquivo> [-q] [-a0 <dump A0h>] [-a2 <dump A2h>]
+ *       -q omite a listagem por transação; sai com 1 se houver divergência
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "I2C/trace.h"
+#include "I2C/stats.h"
+#include "I2C/transport_host.h"
+#include "sfp_8472/a0h.h"
+#include "sfp_8472/a2h.h"
+
+#define MAX_HOTSPOTS  256
+
+typedef struct {
+    uint8_t  kind;
+    uint8_t  addr;
+    uint8_t  offset;
+    uint16_t len;
+    uint32_t count;
+    uint32_t errors;
+    uint64_t total_us;
+    uint32_t max_us;
+} hotspot_t;
+
+static hotspot_t hot[MAX_HOTSPOTS];
+static size_t hot_count;
+
+static const char *kind_name[] = { "READ ", "WRITE", "PROBE" };
+
+/* ============================================
+ * Entrada: binário ou captura hexadecimal
+ * ============================================ */
+static uint8_t *read_file(const char *path, size_t *len)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return NULL;
+
+    size_t cap = 4096, n = 0, r;
+    uint8_t *buf = malloc(cap);
+
+    while (buf && (r = fread(buf + n, 1, cap - n, f)) > 0) {
+        n += r;
+        if (n < cap)
+            continue;
+
+        uint8_t *nb = realloc(buf, cap * 2);
+        if (!nb) {
+            free(buf);
+            buf = NULL;
+            n = 0;
+        } else {
+            buf = nb;
+            cap *= 2;
+        }
+    }
+    fclose(f);
+
+    *len = n;
+    return buf;
+}
+
+static int hex_nibble(int c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
+
+/* Converte o trecho entre #TRACE BEGIN e #TRACE END (no lugar) */
+static bool unhex_capture(uint8_t *buf, size_t *len)
+{
+    const char *begin = NULL;
+    for (size_t i = 0; i + 12 <= *len; i++) {
+        if (memcmp(buf + i, "#TRACE BEGIN", 12) == 0) {
+            begin = (const char *)buf + i + 12;
+            break;
+        }
+    }
+    if (!begin)
+        return false;
+
+    const char *end = (const char *)buf + *len;
+    size_t out = 0;
+    int hi = -1;
+
+    for (const char *p = begin; p < end; p++) {
+        if (*p == '#')
+            break;
+        int v = hex_nibble(*p);
+        if (v < 0)
+            continue;
+        if (hi < 0) {
+            hi = v;
+        } else {
+            buf[out++] = (uint8_t)((hi << 4) | v);
+            hi = -1;
+        }
+    }
+
+    *len = out;
+    return true;
+}
+
+/* ============================================
+ * Pontos quentes
+ * ============================================ */
+static void hot_add(const sfp_trace_rec_t *r)
+{
+    hotspot_t *h = NULL;
+
+    for (size_t i = 0; i < hot_count; i++) {
+        if (hot[i].kind == r->kind && hot[i].addr == r->addr &&
+            hot[i].offset == r->offset && hot[i].len == r->len) {
+            h = &hot[i];
+            break;
+        }
+    }
+    if (!h) {
+        if (hot_count == MAX_HOTSPOTS)
+            return;
+        h = &hot[hot_count++];
+        memset(h, 0, sizeof(*h));
+        h->kind   = r->kind;
+        h->addr   = r->addr;
+        h->offset = r->offset;
+        h->len    = r->len;
+    }
+
+    h->count++;
+    h->total_us += r->dur_us;
+    if (r->dur_us > h->max_us)
+        h->max_us = r->dur_us;
+    if (r->result < 0)
+        h->errors++;
+}
+
+static int hot_cmp(const void *a, const void *b)
+{
+    const hotspot_t *x = a, *y = b;
+    return (x->total_us < y->total_us) - (x->total_us > y->total_us);
+}
+
+/* ============================================
+ * Reprodução contra os parsers
+ * ============================================ */
+static sfp_host_eeprom_t dev;
+static sfp_transport_t bus;
+static sfp_stats_t latency;
+
+static bool have_dump[2];   /* EEPROM emulada carregada de um dump do módulo */
+
+/* Primeiro byte em que a leitura reproduzida difere do conteúdo gravado */
+static int first_diff(const uint8_t *a, const uint8_t *b, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++)
+        if (a[i] != b[i])
+            return i;
+    return -1;
+}
+
+static void replay_read(const sfp_trace_rec_t *r, const uint8_t *payload, uint16_t plen,
+                        uint32_t *mismatches, bool quiet)
+{
+    int idx = (r->addr == SFP_I2C_ADDR_A0) ? 0 : (r->addr == SFP_I2C_ADDR_A2) ? 1 : -1;
+    if (idx < 0 || r->len == 0 || r->len > 255)
+        return;
+
+    /* A2h 96-255 (medidas, flags, seleção de página) muda durante a sessão */
+    if (have_dump[idx] && idx == 1 && r->offset + r->len > A2_TEMP_CURR) {
+        if (!payload || plen != r->len)
+            return;
+        for (uint16_t i = 0; i < plen; i++) {
+            uint8_t off = (uint8_t)(r->offset + i);
+            if (off >= A2_TEMP_CURR) {
+                dev.mem[1][off] = payload[i];
+            } else if (payload[i] != dev.mem[1][off]) {
+                (*mismatches)++;
+                printf("      !! diverge do dump (seq %lu): byte %u gravado 0x%02X, dump 0x%02X\n",
+                       (unsigned long)r->seq, off, payload[i], dev.mem[1][off]);
+                return;
+            }
+        }
+    } else if (have_dump[idx]) {
+        /* Mesma leitura contra o dump: o hash precisa bater com o gravado */
+        uint8_t buf[256];
+
+        if (!sfp_read_block(&bus, r->addr, r->offset, buf, (uint8_t)r->len)) {
+            (*mismatches)++;
+            printf("      !! leitura falhou na reprodução (seq %lu)\n", (unsigned long)r->seq);
+            return;
+        }
+        if (sfp_trace_hash(buf, r->len) != r->hash) {
+            (*mismatches)++;
+            int at = (payload && plen == r->len) ? first_diff(buf, payload, plen) : -1;
+            if (at >= 0)
+                printf("      !! diverge do dump (seq %lu): byte %u gravado 0x%02X, dump 0x%02X\n",
+                       (unsigned long)r->seq, (unsigned)(uint8_t)(r->offset + at),
+                       payload[at], buf[at]);
+            else
+                printf("      !! diverge do dump (seq %lu): hash %08lX, dump %08lX\n",
+                       (unsigned long)r->seq, (unsigned long)r->hash,
+                       (unsigned long)sfp_trace_hash(buf, r->len));
+            return;
+        }
+    } else {
+        /* Sem dump: o conteúdo gravado é a melhor imagem do módulo */
+        if (!payload || plen != r->len)
+            return;
+        for (uint16_t i = 0; i < plen; i++)
+            dev.mem[idx][(uint8_t)(r->offset + i)] = payload[i];
+    }
+
+    if (quiet)
+        return;
+
+    /* Parsers sobre a imagem (dump ou reconstruída) */
+    if (idx == 0 && r->offset == 0 && r->len >= 64) {
+        sfp_a0h_base_t a0;
+        char name[17] = { 0 };
+        const char *pn = NULL;
+
+        memset(&a0, 0, sizeof(a0));
+        sfp_parse_a0_base(dev.mem[0], &a0);
+        sfp_a0_get_vendor_name(&a0, name);
+        sfp_a0_get_vendor_pn(&a0, &pn);
+        printf("      A0h: id 0x%02X vendor '%s' pn '%.16s' CC_BASE %s\n",
+               sfp_a0_get_identifier(&a0), name, pn ? pn : "",
+               sfp_a0_get_cc_base_is_valid(&a0) ? "ok" : "INVÁLIDO");
+    } else if (idx == 1 && r->offset <= A2_RX_POWER && r->offset + r->len >= A2_RX_POWER + 2) {
+        sfp_a2h_t a2;
+        sfp_parse_a2h_rx_power(dev.mem[1], &a2);
+        printf("      A2h: RX %.4f mW (%.2f dBm)\n",
+               sfp_a2h_get_rx_power(&a2), sfp_a2h_get_rx_power_dbm(&a2));
+    }
+}
+
+/* ============================================
+ * Programa
+ * ============================================ */
+int main(int argc, char **argv)
+{
+    const char *dump[2] = { NULL, NULL };
+    bool quiet = false;
+
+    for (int a = 2; a < argc; a++) {
+        if (strcmp(argv[a], "-q") == 0)
+            quiet = true;
+        else if (strcmp(argv[a], "-a0") == 0 && a + 1 < argc)
+            dump[0] = argv[++a];
+        else if (strcmp(argv[a], "-a2") == 0 && a + 1 < argc)
+            dump[1] = argv[++a];
+        else
+            argc = 0;
+    }
+    if (argc < 2) {
+        fprintf(stderr, "uso: %s <trace> [-q] [-a0 <dump A0h>] [-a2 <dump A2h>]\n",
+                argv[0] ? argv[0] : "trace_replay");
+        return 2;
+    }
+
+    size_t len = 0;
+    uint8_t *buf = read_file(argv[1], &len);
+    if (!buf || len == 0) {
+        fprintf(stderr, "erro: não foi possível ler %s\n", argv[1]);
+        return 1;
+    }
+
+    if (sfp_trace_decode_header(buf, len) < 0 && !unhex_capture(buf, &len)) {
+        fprintf(stderr, "erro: formato de trace desconhecido\n");
+        free(buf);
+        return 1;
+    }
+
+    int32_t count = sfp_trace_decode_header(buf, len);
+    if (count < 0) {
+        fprintf(stderr, "erro: cabeçalho SFPT inválido\n");
+        free(buf);
+        return 1;
+    }
+
+    sfp_host_eeprom_init(&dev);
+    for (int d = 0; d < 2; d++) {
+        if (!dump[d])
+            continue;
+        if (!sfp_host_eeprom_load(&dev, d ? SFP_I2C_ADDR_A2 : SFP_I2C_ADDR_A0, dump[d])) {
+            fprintf(stderr, "erro: não foi possível carregar %s\n", dump[d]);
+            free(buf);
+            return 1;
+        }
+        have_dump[d] = true;
+    }
+    sfp_host_transport_init(&bus, &dev);
+    sfp_stats_init(&latency);
+
+    size_t pos = SFP_TRACE_HDR_SIZE;
+    uint32_t first_us = 0, prev_us = 0, end_us = 0, prev_seq = 0, lost = 0, mismatches = 0;
+    uint64_t busy_us = 0;
+
+    if (!quiet)
+        printf("  seq      t(us)    gap(us)   dur(us)  tipo  addr  off   len  res\n");
+
+    for (int32_t i = 0; i < count; i++) {
+        sfp_trace_rec_t r;
+        const uint8_t *payload;
+        uint16_t plen;
+
+        size_t used = sfp_trace_decode(buf + pos, len - pos, &r, &payload, &plen);
+        if (!used) {
+            fprintf(stderr, "erro: trace truncado no registro %ld\n", (long)i);
+            break;
+        }
+        pos += used;
+
+        if (i == 0) {
+            first_us = prev_us = r.start_us;
+            end_us = r.start_us + r.dur_us;
+            lost = r.seq;     /* registros sobrescritos antes do primeiro */
+        } else if (r.seq != prev_seq + 1) {
+            lost += r.seq - prev_seq - 1;
+        }
+
+        if (!quiet) {
+            printf("%5lu %10lu %10lu %9lu  %s  0x%02X  %3u %5u  %d%s\n",
+                   (unsigned long)r.seq,
+                   (unsigned long)(r.start_us - first_us),
+                   (unsigned long)(r.start_us - prev_us),
+                   (unsigned long)r.dur_us,
+                   r.kind < 3 ? kind_name[r.kind] : "?    ",
+                   r.addr, r.offset, r.len, r.result,
+                   (r.len && r.result > 0 && !plen) ? "  (só hash)" : "");
+        }
+
+        if (payload && sfp_trace_hash(payload, plen) != r.hash) {
+            mismatches++;
+            printf("      !! conteúdo não confere com o hash (seq %lu)\n", (unsigned long)r.seq);
+        } else if (r.kind == SFP_TRACE_READ && r.result > 0) {
+            replay_read(&r, payload, plen, &mismatches, quiet);
+        }
+
+        hot_add(&r);
+        sfp_stats_record(&latency, r.addr, r.dur_us, r.result >= 0);
+        busy_us += r.dur_us;
+        prev_us  = r.start_us;
+        if (r.start_us + r.dur_us - first_us > end_us - first_us)
+            end_us = r.start_us + r.dur_us;
+        prev_seq = r.seq;
+    }
+
+    qsort(hot, hot_count, sizeof(hot[0]), hot_cmp);
+
+    printf("\nPontos quentes (tempo total de barramento):\n");
+    printf("  tipo  addr  off   len  qtd   erros  total(us)  médio(us)  máx(us)\n");
+    for (size_t i = 0; i < hot_count; i++) {
+        const hotspot_t *h = &hot[i];
+        printf("  %s  0x%02X  %3u %5u  %5lu %5lu %10llu %10llu %8lu\n",
+               h->kind < 3 ? kind_name[h->kind] : "?    ",
+               h->addr, h->offset, h->len,
+               (unsigned long)h->count, (unsigned long)h->errors,
+               (unsigned long long)h->total_us,
+               (unsigned long long)(h->total_us / h->count),
+               (unsigned long)h->max_us);
+    }
+
+    printf("\nLatência por endereço:\n");
+    sfp_stats_report(&latency);
+
+    uint32_t span = end_us - first_us;
+    printf("\n%ld transações, %lu perdidas (buffer circular), %lu divergências\n",
+           (long)count, (unsigned long)lost, (unsigned long)mismatches);
+    printf("barramento ocupado %llu us de %lu us (%.1f%%)\n",
+           (unsigned long long)busy_us, (unsigned long)span,
+           span ? 100.0 * (double)busy_us / span : 0.0);
+
+    free(buf);
+    return mismatches ? 1 : 0;
+}